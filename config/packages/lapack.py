@@ -116,7 +116,7 @@ class Lapack(package.Package):
 
     # check for pairs of advanced and basic subroutines
     # if advanced is missing (only available in recent Lapack) then check the basic one
-    for pair in [['ggsvd3','ggsvd'],['ggev3','ggev'],['gges3','']]:   # gges is checked in PETSc
+    for pair in [['ggsvd3','ggsvd'],['ggev3','ggev'],['gges3',''],['gesvdx','']]:   # gges is checked in PETSc
       for f in pair:
         if not f: continue
         i = prefix + f
@@ -51,6 +51,7 @@
 #define EPSLOBPCG      'lobpcg'
 #define EPSCISS        'ciss'
 #define EPSLYAPII      'lyapii'
+#define EPSCHFSI       'chfsi'
 #define EPSLAPACK      'lapack'
 #define EPSARPACK      'arpack'
 #define EPSTRLAN       'trlan'
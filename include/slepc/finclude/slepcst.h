@@ -19,6 +19,7 @@
 
 #define STType     character*(80)
 #define STMatMode  PetscEnum
+#define STFilterType PetscEnum
 
 #define STSHELL    'shell'
 #define STSHIFT    'shift'
@@ -26,5 +27,6 @@
 #define STCAYLEY   'cayley'
 #define STPRECOND  'precond'
 #define STFILTER   'filter'
+#define STCONTOUR  'contour'
 
 #endif
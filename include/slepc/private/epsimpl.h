@@ -96,8 +96,13 @@ struct _p_EPS {
   PetscReal      balance_cutoff;   /* cutoff value for balancing */
   PetscBool      trueres;          /* whether the true residual norm must be computed */
   PetscBool      trackall;         /* whether all the residuals must be computed */
+  PetscBool      nrmest;           /* whether the matrix norms are estimated instead of computed */
   PetscBool      purify;           /* whether eigenvectors need to be purified */
   PetscBool      twosided;         /* whether to compute left eigenvectors (two-sided solver) */
+  PetscBool      recycle;          /* whether to recycle the subspace of the previous solve */
+  PetscBool      autosel;          /* whether the solver is selected automatically at setup */
+  PetscReal      autotime;         /* time budget of each trial in the automatic selection */
+  char           *autocache;       /* file with the cache of automatic selections */
 
   /*-------------- User-provided functions and contexts -----------------*/
   EPSConvergenceTestFn      *converged;
@@ -125,6 +130,7 @@ struct _p_EPS {
   Vec            D;                /* diagonal matrix for balancing */
   Vec            *IS,*ISL;         /* references to user-provided initial spaces */
   Vec            *defl;            /* references to user-provided deflation space */
+  BV             R;                /* subspace kept from the previous solve for recycling */
   PetscScalar    *eigr,*eigi;      /* real and imaginary parts of eigenvalues */
   PetscReal      *errest;          /* error estimates */
   PetscScalar    *rr,*ri;          /* values computed by user's arbitrary selection function */
@@ -138,8 +144,14 @@ struct _p_EPS {
   EPSSolverType  categ;            /* solver category */
   PetscInt       nconv;            /* number of converged eigenvalues */
   PetscInt       its;              /* number of iterations so far computed */
+  PetscInt       nrest;            /* number of restart vectors after the converged ones */
+  PetscInt       nrec;             /* number of recycled vectors in the initial space */
+  char           *autosig;         /* signature of the problem in the last automatic selection */
+  PetscBool      autost;           /* the ST type was set by the automatic selection */
   PetscInt       n,nloc;           /* problem dimensions (global, local) */
   PetscReal      nrma,nrmb;        /* computed matrix norms */
+  PetscBool      nrmritz;          /* nrma has been estimated from the Ritz values */
+  PetscBool      nrmisest;         /* nrma or nrmb has been estimated with MatNormEstimate() */
   PetscBool      useds;            /* whether the solver uses the DS object or not */
   PetscBool      isgeneralized;
   PetscBool      ispositive;
@@ -292,22 +304,46 @@ static inline PetscErrorCode EPS_SetInnerProduct(EPS eps)
 }
 
 /*
-  EPS_Purify - purify the first k vectors in the V basis
+  EPS_Purify - purify the first k vectors in the V basis, applying the operator to blocks
+  of columns (the operator matrix uses STApplyMat() when the ST supports it); the unused
+  columns of V after the first k are the workspace, so that no additional basis is needed
 */
 static inline PetscErrorCode EPS_Purify(EPS eps,PetscInt k)
 {
-  PetscInt       i;
-  Vec            v,z;
+  PetscInt       i,c,s,l,m,n;
+  BV             L,R;
+  Vec            v,w;
+  Mat            Op;
 
   PetscFunctionBegin;
-  PetscCall(BVCreateVec(eps->V,&v));
-  for (i=0;i<k;i++) {
-    PetscCall(BVCopyVec(eps->V,i,v));
-    PetscCall(BVGetColumn(eps->V,i,&z));
-    PetscCall(STApply(eps->st,v,z));
-    PetscCall(BVRestoreColumn(eps->V,i,&z));
+  if (!k) PetscFunctionReturn(PETSC_SUCCESS);
+  PetscCall(BVGetActiveColumns(eps->V,&l,&m));
+  PetscCall(BVGetSizes(eps->V,NULL,NULL,&n));
+  PetscCall(STGetOperator(eps->st,&Op));
+  if (k<n) {
+    c = PetscMin(k,n-k);
+    PetscCall(BVSetActiveColumns(eps->V,k,n));
+    PetscCall(BVGetSplit(eps->V,&L,&R));
+    for (i=0;i<k;i+=s) {
+      s = PetscMin(c,k-i);
+      PetscCall(BVSetActiveColumns(L,i,i+s));
+      PetscCall(BVSetActiveColumns(R,0,s));
+      PetscCall(BVCopy(L,R));
+      PetscCall(BVMatMult(R,Op,L));
+    }
+    PetscCall(BVRestoreSplit(eps->V,&L,&R));
+  } else {  /* no free columns, purify one column at a time */
+    PetscCall(BVCreateVec(eps->V,&w));
+    for (i=0;i<k;i++) {
+      PetscCall(BVCopyVec(eps->V,i,w));
+      PetscCall(BVGetColumn(eps->V,i,&v));
+      PetscCall(MatMult(Op,w,v));
+      PetscCall(BVRestoreColumn(eps->V,i,&v));
+    }
+    PetscCall(VecDestroy(&w));
   }
-  PetscCall(VecDestroy(&v));
+  PetscCall(STRestoreOperator(eps->st,&Op));
+  PetscCall(BVSetActiveColumns(eps->V,l,m));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -422,6 +458,7 @@ SLEPC_INTERN PetscErrorCode EPSComputeRitzVector(EPS,PetscScalar*,PetscScalar*,B
 SLEPC_INTERN PetscErrorCode EPSGetStartVector(EPS,PetscInt,PetscBool*);
 SLEPC_INTERN PetscErrorCode EPSGetLeftStartVector(EPS,PetscInt,PetscBool*);
 SLEPC_INTERN PetscErrorCode MatEstimateSpectralRange_EPS(Mat,PetscReal*,PetscReal*);
+SLEPC_INTERN PetscErrorCode EPSComputeMatrixNorms(EPS);
 
 /* Private functions of the solver implementations */
 
@@ -431,6 +468,7 @@ SLEPC_INTERN PetscErrorCode EPSKrylovConvergence(EPS,PetscBool,PetscInt,PetscInt
 SLEPC_INTERN PetscErrorCode EPSPseudoLanczos(EPS,PetscReal*,PetscReal*,PetscReal*,PetscInt,PetscInt*,PetscBool*,PetscBool*,PetscReal*,Vec);
 SLEPC_INTERN PetscErrorCode EPSBuildBalance_Krylov(EPS);
 SLEPC_INTERN PetscErrorCode EPSSetDefaultST(EPS);
+SLEPC_INTERN PetscErrorCode EPSAutoSelect_Private(EPS);
 SLEPC_INTERN PetscErrorCode EPSSetDefaultST_Precond(EPS);
 SLEPC_INTERN PetscErrorCode EPSSetDefaultST_GMRES(EPS);
 SLEPC_INTERN PetscErrorCode EPSSetDefaultST_NoFactor(EPS);
@@ -28,6 +28,7 @@ struct _FNOps {
   PetscErrorCode (*evaluatefunctionmatcuda[FN_MAX_SOLVE])(FN,Mat,Mat);
   PetscErrorCode (*evaluatefunctionmatvec[FN_MAX_SOLVE])(FN,Mat,Vec);
   PetscErrorCode (*evaluatefunctionmatveccuda[FN_MAX_SOLVE])(FN,Mat,Vec);
+  PetscErrorCode (*evaluatefunctionmatbatched[FN_MAX_SOLVE])(FN,PetscInt,Mat*,Mat*);
   PetscErrorCode (*setfromoptions)(FN,PetscOptionItems*);
   PetscErrorCode (*view)(FN,PetscViewer);
   PetscErrorCode (*duplicate)(FN,MPI_Comm,FN*);
@@ -96,6 +97,8 @@ static inline PetscErrorCode FN_FreeWorkMat(FN fn,Mat *M)
 }
 
 SLEPC_INTERN PetscErrorCode FNSqrtmSchur(FN,PetscBLASInt,PetscScalar*,PetscBLASInt,PetscBool);
+SLEPC_INTERN PetscErrorCode FNSqrtmSchurWorkSize(PetscBLASInt,PetscBool,PetscInt*,PetscInt*,PetscInt*);
+SLEPC_INTERN PetscErrorCode FNSqrtmSchur_Private(PetscBLASInt,PetscScalar*,PetscBLASInt,PetscBool,PetscScalar*,PetscReal*,PetscBLASInt*);
 SLEPC_INTERN PetscErrorCode FNSqrtmDenmanBeavers(FN,PetscBLASInt,PetscScalar*,PetscBLASInt,PetscBool);
 SLEPC_INTERN PetscErrorCode FNSqrtmNewtonSchulz(FN,PetscBLASInt,PetscScalar*,PetscBLASInt,PetscBool);
 SLEPC_INTERN PetscErrorCode FNSqrtmSadeghi(FN,PetscBLASInt,PetscScalar*,PetscBLASInt);
@@ -103,6 +106,7 @@ SLEPC_INTERN PetscErrorCode SlepcNormAm(PetscBLASInt,PetscScalar*,PetscInt,Petsc
 SLEPC_INTERN PetscErrorCode FNEvaluateFunctionMat_Private(FN,Mat,Mat,PetscBool);
 SLEPC_INTERN PetscErrorCode FNEvaluateFunctionMatVec_Private(FN,Mat,Vec,PetscBool);
 SLEPC_INTERN PetscErrorCode FNEvaluateFunctionMat_Exp_Higham(FN,Mat,Mat); /* used in FNPHI */
+SLEPC_INTERN PetscErrorCode FNEvaluateFunctionMat_SchurParlett(FN,Mat,Mat);
 #if defined(PETSC_HAVE_CUDA)
 SLEPC_INTERN PetscErrorCode FNSqrtmDenmanBeavers_CUDAm(FN,PetscBLASInt,PetscScalar*,PetscBLASInt,PetscBool);
 SLEPC_INTERN PetscErrorCode FNSqrtmNewtonSchulz_CUDA(FN,PetscBLASInt,PetscScalar*,PetscBLASInt,PetscBool);
@@ -25,6 +25,9 @@ typedef struct _MFNOps *MFNOps;
 
 struct _MFNOps {
   PetscErrorCode (*solve)(MFN,Vec,Vec);
+  PetscErrorCode (*solvephi)(MFN,PetscInt,Vec*,Vec);
+  PetscErrorCode (*solvemat)(MFN,Mat,Mat);
+  PetscErrorCode (*solvetimes)(MFN,PetscInt,const PetscScalar*,Vec,Vec*);
   PetscErrorCode (*setup)(MFN);
   PetscErrorCode (*setfromoptions)(MFN,PetscOptionItems*);
   PetscErrorCode (*publishoptions)(MFN);
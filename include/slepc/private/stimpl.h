@@ -17,7 +17,7 @@
 
 SLEPC_EXTERN PetscBool STRegisterAllCalled;
 SLEPC_EXTERN PetscErrorCode STRegisterAll(void);
-SLEPC_EXTERN PetscLogEvent ST_SetUp,ST_ComputeOperator,ST_Apply,ST_ApplyTranspose,ST_ApplyHermitianTranspose,ST_MatSetUp,ST_MatMult,ST_MatMultTranspose,ST_MatSolve,ST_MatSolveTranspose;
+SLEPC_EXTERN PetscLogEvent ST_SetUp,ST_ComputeOperator,ST_Apply,ST_ApplyTranspose,ST_ApplyHermitianTranspose,ST_MatSetUp,ST_MatMult,ST_MatMultTranspose,ST_MatSolve,ST_MatSolveTranspose,ST_FactorCacheHit,ST_FactorCacheMiss;
 
 typedef struct _STOps *STOps;
 
@@ -48,6 +48,18 @@ typedef enum { ST_STATE_INITIAL,
                ST_STATE_SETUP,
                ST_STATE_UPDATED } STStateType;
 
+/*
+     Entry of the cache of factorizations, see STFactorCacheSwap()
+*/
+typedef struct {
+  PetscScalar      sigma;            /* shift corresponding to the factorization */
+  PetscObjectState *Astate;          /* state of the matrices when the factorization was computed */
+  Mat              P;                /* the matrix A-sigma*B */
+  PC               pc;               /* the preconditioner holding the factorization */
+  PetscInt         stamp;            /* time of last use, for the LRU policy */
+  PetscReal        mem;              /* memory of the factored matrix, in megabytes */
+} STFactorCacheEntry;
+
 struct _p_ST {
   PETSCHEADER(struct _STOps);
   /*------------------------- User parameters --------------------------*/
@@ -84,6 +96,25 @@ struct _p_ST {
   PetscBool        sigma_set;        /* whether the user provided the shift or not */
   PetscBool        asymm;            /* the user matrices are all symmetric */
   PetscBool        aherm;            /* the user matrices are all hermitian */
+  PetscInt         fcmax;            /* maximum number of cached factorizations */
+  PetscReal        fcmaxmem;         /* memory budget of the cache in megabytes, 0 if unlimited */
+  PetscInt         fcn;              /* number of cached factorizations */
+  STFactorCacheEntry *fc;            /* cache of factorizations for previous shifts */
+  PetscInt         fcclock;          /* clock for the LRU policy of the cache */
+  PetscInt         fchits,fcmisses;  /* statistics of the cache */
+  PC               fcsrc;            /* PC whose factor settings must be copied to the new one */
+  PetscInt         refineits;        /* maximum number of iterative refinement steps in STMatSolve */
+  PetscReal        refinetol;        /* tolerance for iterative refinement */
+  PetscReal        defrefinetol;     /* default tolerance for iterative refinement, set by the solver */
+  PetscBool        recycle;          /* whether STMatMatSolve() recycles the previous solutions */
+  BV               rQ,rZ;            /* orthonormal basis of previous right-hand sides, and P^{-1}*rQ */
+  PetscInt         rk;               /* number of columns of rQ and rZ */
+  BV               rW;               /* work basis for the initial guess of STMatMatSolve() */
+  Mat              rH;               /* work matrix for the coefficients of the initial guess */
+  PetscObjectId    rPid;             /* id and state of P when rQ and rZ were stored */
+  PetscObjectState rPstate;
+  PetscInt         mscalls,msrhs;    /* statistics of STMatMatSolve(): number of calls and right-hand sides */
+  PetscInt         msits,mslastits;  /* total number of linear iterations, and in the last call */
   void             *data;
 };
 
@@ -113,6 +144,9 @@ SLEPC_INTERN PetscErrorCode STCheckNullSpace_Default(ST,BV);
 SLEPC_INTERN PetscErrorCode STMatShellCreate(ST,PetscScalar,PetscInt,PetscInt*,PetscScalar*,Mat*);
 SLEPC_INTERN PetscErrorCode STMatShellShift(Mat,PetscScalar);
 SLEPC_INTERN PetscErrorCode STCheckFactorPackage(ST);
+SLEPC_INTERN PetscErrorCode STFactorCacheSwap(ST,PetscScalar,PetscBool*);
+SLEPC_INTERN PetscErrorCode STFactorCacheReset(ST);
+SLEPC_INTERN PetscErrorCode STFactorCacheSetUpPC(ST);
 SLEPC_INTERN PetscErrorCode STMatMAXPY_Private(ST,PetscScalar,PetscScalar,PetscInt,PetscScalar*,PetscBool,PetscBool,Mat*);
 SLEPC_INTERN PetscErrorCode STCoeffs_Monomial(ST,PetscScalar*);
 SLEPC_INTERN PetscErrorCode STSetDefaultKSP(ST);
@@ -136,6 +170,7 @@ static inline PetscErrorCode ST_KSPSetOperators(ST st,Mat A,Mat B)
   if (!st->ksp) PetscCall(STGetKSP(st,&st->ksp));
   PetscCall(STCheckFactorPackage(st));
   PetscCall(KSPSetOperators(st->ksp,A,B));
+  if (st->fcsrc) PetscCall(STFactorCacheSetUpPC(st));
   PetscCall(MatGetOptionsPrefix(B,&prefix));
   if (!prefix) {
     /* set Mat prefix to be the same as KSP to enable setting command-line options (e.g. MUMPS)
@@ -88,6 +88,7 @@
 #define LAPACKsytrd_ PETSCBLAS(sytrd,SYTRD)
 #endif
 #define LAPACKsyevd_ PETSCBLAS(syevd,SYEVD)
+#define LAPACKsyevr_ PETSCBLAS(syevr,SYEVR)
 #define LAPACKsygvd_ PETSCBLAS(sygvd,SYGVD)
 #else
 #if !defined(SLEPC_MISSING_LAPACK_ORGTR)
@@ -100,6 +101,7 @@
 #define LAPACKsytrd_ PETSCBLAS(hetrd,HETRD)
 #endif
 #define LAPACKsyevd_ PETSCBLAS(heevd,HEEVD)
+#define LAPACKsyevr_ PETSCBLAS(heevr,HEEVR)
 #define LAPACKsygvd_ PETSCBLAS(hegvd,HEGVD)
 #endif
 
@@ -132,6 +134,9 @@
 #define LAPACKtrexc_ PETSCBLAS(trexc,TREXC)
 #endif
 #define LAPACKgesdd_ PETSCBLAS(gesdd,GESDD)
+#if !defined(SLEPC_MISSING_LAPACK_GESVDX)
+#define LAPACKgesvdx_ PETSCBLAS(gesvdx,GESVDX)
+#endif
 #if !defined(SLEPC_MISSING_LAPACK_TGEVC)
 #define LAPACKtgevc_ PETSCBLAS(tgevc,TGEVC)
 #endif
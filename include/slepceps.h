@@ -54,6 +54,7 @@ typedef const char* EPSType;
 #define EPSLOBPCG      "lobpcg"
 #define EPSCISS        "ciss"
 #define EPSLYAPII      "lyapii"
+#define EPSCHFSI       "chfsi"
 #define EPSLAPACK      "lapack"
 #define EPSARPACK      "arpack"
 #define EPSTRLAN       "trlan"
@@ -248,6 +249,7 @@ SLEPC_EXTERN PetscErrorCode EPSGetEigenvector(EPS,PetscInt,Vec,Vec);
 SLEPC_EXTERN PetscErrorCode EPSGetLeftEigenvector(EPS,PetscInt,Vec,Vec);
 
 SLEPC_EXTERN PetscErrorCode EPSComputeError(EPS,PetscInt,EPSErrorType,PetscReal*);
+SLEPC_EXTERN PetscErrorCode EPSComputeErrors(EPS,EPSErrorType,PetscReal[]);
 PETSC_DEPRECATED_FUNCTION(3, 6, 0, "EPSComputeError()", ) static inline PetscErrorCode EPSComputeRelativeError(EPS eps,PetscInt i,PetscReal *r) {return EPSComputeError(eps,i,EPS_ERROR_RELATIVE,r);}
 PETSC_DEPRECATED_FUNCTION(3, 6, 0, "EPSComputeError() with EPS_ERROR_ABSOLUTE", ) static inline PetscErrorCode EPSComputeResidualNorm(EPS eps,PetscInt i,PetscReal *r) {return EPSComputeError(eps,i,EPS_ERROR_ABSOLUTE,r);}
 SLEPC_EXTERN PetscErrorCode EPSGetInvariantSubspace(EPS,Vec[]);
@@ -262,6 +264,12 @@ SLEPC_EXTERN PetscErrorCode EPSSetTrueResidual(EPS,PetscBool);
 SLEPC_EXTERN PetscErrorCode EPSGetTrueResidual(EPS,PetscBool*);
 SLEPC_EXTERN PetscErrorCode EPSSetPurify(EPS,PetscBool);
 SLEPC_EXTERN PetscErrorCode EPSGetPurify(EPS,PetscBool*);
+SLEPC_EXTERN PetscErrorCode EPSSetRecycle(EPS,PetscBool);
+SLEPC_EXTERN PetscErrorCode EPSGetRecycle(EPS,PetscBool*);
+SLEPC_EXTERN PetscErrorCode EPSSetAutoSelect(EPS,PetscBool,PetscReal);
+SLEPC_EXTERN PetscErrorCode EPSGetAutoSelect(EPS,PetscBool*,PetscReal*);
+SLEPC_EXTERN PetscErrorCode EPSSetAutoSelectCache(EPS,const char[]);
+SLEPC_EXTERN PetscErrorCode EPSGetAutoSelectCache(EPS,const char*[]);
 SLEPC_EXTERN PetscErrorCode EPSIsGeneralized(EPS,PetscBool*);
 SLEPC_EXTERN PetscErrorCode EPSIsHermitian(EPS,PetscBool*);
 SLEPC_EXTERN PetscErrorCode EPSIsPositive(EPS,PetscBool*);
@@ -269,6 +277,8 @@ SLEPC_EXTERN PetscErrorCode EPSIsStructured(EPS,PetscBool*);
 
 SLEPC_EXTERN PetscErrorCode EPSSetTrackAll(EPS,PetscBool);
 SLEPC_EXTERN PetscErrorCode EPSGetTrackAll(EPS,PetscBool*);
+SLEPC_EXTERN PetscErrorCode EPSSetEstimateNorms(EPS,PetscBool);
+SLEPC_EXTERN PetscErrorCode EPSGetEstimateNorms(EPS,PetscBool*);
 
 SLEPC_EXTERN PetscErrorCode EPSSetDeflationSpace(EPS,PetscInt,Vec[]);
 SLEPC_EXTERN PetscErrorCode EPSSetInitialSpace(EPS,PetscInt,Vec[]);
@@ -396,6 +406,12 @@ SLEPC_EXTERN PetscErrorCode EPSKrylovSchurSetRestart(EPS,PetscReal);
 SLEPC_EXTERN PetscErrorCode EPSKrylovSchurGetRestart(EPS,PetscReal*);
 SLEPC_EXTERN PetscErrorCode EPSKrylovSchurSetLocking(EPS,PetscBool);
 SLEPC_EXTERN PetscErrorCode EPSKrylovSchurGetLocking(EPS,PetscBool*);
+SLEPC_EXTERN PetscErrorCode EPSKrylovSchurSetAdaptiveRestart(EPS,PetscBool,PetscInt);
+SLEPC_EXTERN PetscErrorCode EPSKrylovSchurGetAdaptiveRestart(EPS,PetscBool*,PetscInt*);
+SLEPC_EXTERN PetscErrorCode EPSKrylovSchurSetMixedPrecision(EPS,PetscBool,PetscReal);
+SLEPC_EXTERN PetscErrorCode EPSKrylovSchurGetMixedPrecision(EPS,PetscBool*,PetscReal*);
+SLEPC_EXTERN PetscErrorCode EPSKrylovSchurSetMixedPrecisionMat(EPS,Mat);
+SLEPC_EXTERN PetscErrorCode EPSKrylovSchurGetMixedPrecisionMat(EPS,Mat*);
 SLEPC_EXTERN PetscErrorCode EPSKrylovSchurSetPartitions(EPS,PetscInt);
 SLEPC_EXTERN PetscErrorCode EPSKrylovSchurGetPartitions(EPS,PetscInt*);
 SLEPC_EXTERN PetscErrorCode EPSKrylovSchurSetDetectZeros(EPS,PetscBool);
@@ -471,6 +487,8 @@ SLEPC_EXTERN PetscErrorCode EPSGDSetBOrth(EPS,PetscBool);
 SLEPC_EXTERN PetscErrorCode EPSGDGetBOrth(EPS,PetscBool*);
 SLEPC_EXTERN PetscErrorCode EPSGDSetDoubleExpansion(EPS,PetscBool);
 SLEPC_EXTERN PetscErrorCode EPSGDGetDoubleExpansion(EPS,PetscBool*);
+SLEPC_EXTERN PetscErrorCode EPSGDSetPreconditionerRefresh(EPS,PetscInt,PetscReal);
+SLEPC_EXTERN PetscErrorCode EPSGDGetPreconditionerRefresh(EPS,PetscInt*,PetscReal*);
 
 SLEPC_EXTERN PetscErrorCode EPSJDSetKrylovStart(EPS,PetscBool);
 SLEPC_EXTERN PetscErrorCode EPSJDGetKrylovStart(EPS,PetscBool*);
@@ -486,6 +504,10 @@ SLEPC_EXTERN PetscErrorCode EPSJDSetConstCorrectionTol(EPS,PetscBool);
 SLEPC_EXTERN PetscErrorCode EPSJDGetConstCorrectionTol(EPS,PetscBool*);
 SLEPC_EXTERN PetscErrorCode EPSJDSetBOrth(EPS,PetscBool);
 SLEPC_EXTERN PetscErrorCode EPSJDGetBOrth(EPS,PetscBool*);
+SLEPC_EXTERN PetscErrorCode EPSJDSetPreconditionerRefresh(EPS,PetscInt,PetscReal,PetscInt);
+SLEPC_EXTERN PetscErrorCode EPSJDGetPreconditionerRefresh(EPS,PetscInt*,PetscReal*,PetscInt*);
+SLEPC_EXTERN PetscErrorCode EPSJDSetBlockCorrection(EPS,PetscBool);
+SLEPC_EXTERN PetscErrorCode EPSJDGetBlockCorrection(EPS,PetscBool*);
 
 SLEPC_EXTERN PetscErrorCode EPSRQCGSetReset(EPS,PetscInt);
 SLEPC_EXTERN PetscErrorCode EPSRQCGGetReset(EPS,PetscInt*);
@@ -496,6 +518,10 @@ SLEPC_EXTERN PetscErrorCode EPSLOBPCGSetRestart(EPS,PetscReal);
 SLEPC_EXTERN PetscErrorCode EPSLOBPCGGetRestart(EPS,PetscReal*);
 SLEPC_EXTERN PetscErrorCode EPSLOBPCGSetLocking(EPS,PetscBool);
 SLEPC_EXTERN PetscErrorCode EPSLOBPCGGetLocking(EPS,PetscBool*);
+SLEPC_EXTERN PetscErrorCode EPSLOBPCGSetImplicitGram(EPS,PetscBool);
+SLEPC_EXTERN PetscErrorCode EPSLOBPCGGetImplicitGram(EPS,PetscBool*);
+SLEPC_EXTERN PetscErrorCode EPSLOBPCGSetImplicitRecompute(EPS,PetscInt);
+SLEPC_EXTERN PetscErrorCode EPSLOBPCGGetImplicitRecompute(EPS,PetscInt*);
 
 /*E
     EPSCISSQuadRule - determines the quadrature rule in the CISS solver
@@ -538,6 +564,9 @@ SLEPC_EXTERN PetscErrorCode EPSLyapIIGetLME(EPS,LME*);
 SLEPC_EXTERN PetscErrorCode EPSLyapIISetRanks(EPS,PetscInt,PetscInt);
 SLEPC_EXTERN PetscErrorCode EPSLyapIIGetRanks(EPS,PetscInt*,PetscInt*);
 
+SLEPC_EXTERN PetscErrorCode EPSChFSISetDegree(EPS,PetscInt,PetscInt);
+SLEPC_EXTERN PetscErrorCode EPSChFSIGetDegree(EPS,PetscInt*,PetscInt*);
+
 SLEPC_EXTERN PetscErrorCode EPSBLOPEXSetBlockSize(EPS,PetscInt);
 SLEPC_EXTERN PetscErrorCode EPSBLOPEXGetBlockSize(EPS,PetscInt*);
 
@@ -96,6 +96,8 @@ SLEPC_EXTERN PetscErrorCode FNEvaluateFunction(FN,PetscScalar,PetscScalar*);
 SLEPC_EXTERN PetscErrorCode FNEvaluateDerivative(FN,PetscScalar,PetscScalar*);
 SLEPC_EXTERN PetscErrorCode FNEvaluateFunctionMat(FN,Mat,Mat);
 SLEPC_EXTERN PetscErrorCode FNEvaluateFunctionMatVec(FN,Mat,Vec);
+SLEPC_EXTERN PetscErrorCode FNEvaluateFunctionMatBatched(FN,PetscInt,Mat[],Mat[]);
+SLEPC_EXTERN PetscErrorCode FNEvaluateFunctionsMat(PetscInt,FN[],Mat,Mat[]);
 
 SLEPC_EXTERN PetscFunctionList FNList;
 SLEPC_EXTERN PetscErrorCode FNRegister(const char[],PetscErrorCode(*)(FN));
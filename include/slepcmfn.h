@@ -55,6 +55,9 @@ SLEPC_EXTERN PetscErrorCode MFNSetFromOptions(MFN);
 SLEPC_EXTERN PetscErrorCode MFNSetUp(MFN);
 SLEPC_EXTERN PetscErrorCode MFNSolve(MFN,Vec,Vec);
 SLEPC_EXTERN PetscErrorCode MFNSolveTranspose(MFN,Vec,Vec);
+SLEPC_EXTERN PetscErrorCode MFNSolvePhi(MFN,PetscInt,Vec[],Vec);
+SLEPC_EXTERN PetscErrorCode MFNSolveMat(MFN,Mat,Mat);
+SLEPC_EXTERN PetscErrorCode MFNSolveTimes(MFN,PetscInt,const PetscScalar[],Vec,Vec[]);
 SLEPC_EXTERN PetscErrorCode MFNView(MFN,PetscViewer);
 SLEPC_EXTERN PetscErrorCode MFNViewFromOptions(MFN,PetscObject,const char[]);
 SLEPC_EXTERN PetscErrorCode MFNConvergedReasonView(MFN,PetscViewer);
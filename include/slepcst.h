@@ -15,6 +15,7 @@
 
 #include <slepcsys.h>
 #include <slepcbv.h>
+#include <slepcrg.h>
 #include <petscksp.h>
 
 /* SUBMANSEC = ST */
@@ -46,6 +47,7 @@ typedef const char* STType;
 #define STCAYLEY    "cayley"
 #define STPRECOND   "precond"
 #define STFILTER    "filter"
+#define STCONTOUR   "contour"
 
 /* Logging support */
 SLEPC_EXTERN PetscClassId ST_CLASSID;
@@ -147,6 +149,14 @@ SLEPC_EXTERN PetscErrorCode STSetMatMode(ST,STMatMode);
 SLEPC_EXTERN PetscErrorCode STGetMatMode(ST,STMatMode*);
 SLEPC_EXTERN PetscErrorCode STSetMatStructure(ST,MatStructure);
 SLEPC_EXTERN PetscErrorCode STGetMatStructure(ST,MatStructure*);
+SLEPC_EXTERN PetscErrorCode STSetFactorCache(ST,PetscInt,PetscReal);
+SLEPC_EXTERN PetscErrorCode STGetFactorCache(ST,PetscInt*,PetscReal*,PetscInt*,PetscInt*);
+SLEPC_EXTERN PetscErrorCode STSetSolveRefinement(ST,PetscInt,PetscReal);
+SLEPC_EXTERN PetscErrorCode STGetSolveRefinement(ST,PetscInt*,PetscReal*);
+SLEPC_EXTERN PetscErrorCode STSetDefaultSolveRefinementTol(ST,PetscReal);
+SLEPC_EXTERN PetscErrorCode STSetMatSolveRecycle(ST,PetscBool);
+SLEPC_EXTERN PetscErrorCode STGetMatSolveRecycle(ST,PetscBool*);
+SLEPC_EXTERN PetscErrorCode STGetMatSolveStatistics(ST,PetscInt*,PetscInt*,PetscInt*,PetscInt*);
 
 SLEPC_EXTERN PetscFunctionList STList;
 SLEPC_EXTERN PetscErrorCode STRegister(const char[],PetscErrorCode(*)(ST));
@@ -168,6 +178,19 @@ PETSC_DEPRECATED_FUNCTION(3, 15, 0, "STSetPreconditionerMat()", ) static inline
 SLEPC_EXTERN PetscErrorCode STPrecondGetKSPHasMat(ST,PetscBool*);
 SLEPC_EXTERN PetscErrorCode STPrecondSetKSPHasMat(ST,PetscBool);
 
+/*E
+    STFilterType - The method used to build the polynomial filter in STFILTER
+
+    Level: intermediate
+
+.seealso: STFilterSetType(), STFilterGetType()
+E*/
+typedef enum { STFILTER_FILTLAN,
+               STFILTER_CHEBYSHEV } STFilterType;
+SLEPC_EXTERN const char *STFilterTypes[];
+
+SLEPC_EXTERN PetscErrorCode STFilterSetType(ST,STFilterType);
+SLEPC_EXTERN PetscErrorCode STFilterGetType(ST,STFilterType*);
 SLEPC_EXTERN PetscErrorCode STFilterSetInterval(ST,PetscReal,PetscReal);
 SLEPC_EXTERN PetscErrorCode STFilterGetInterval(ST,PetscReal*,PetscReal*);
 SLEPC_EXTERN PetscErrorCode STFilterSetRange(ST,PetscReal,PetscReal);
@@ -175,3 +198,9 @@ SLEPC_EXTERN PetscErrorCode STFilterGetRange(ST,PetscReal*,PetscReal*);
 SLEPC_EXTERN PetscErrorCode STFilterSetDegree(ST,PetscInt);
 SLEPC_EXTERN PetscErrorCode STFilterGetDegree(ST,PetscInt*);
 SLEPC_EXTERN PetscErrorCode STFilterGetThreshold(ST,PetscReal*);
+
+SLEPC_EXTERN PetscErrorCode STContourSetRG(ST,RG);
+SLEPC_EXTERN PetscErrorCode STContourGetRG(ST,RG*);
+SLEPC_EXTERN PetscErrorCode STContourSetSizes(ST,PetscInt,PetscInt);
+SLEPC_EXTERN PetscErrorCode STContourGetSizes(ST,PetscInt*,PetscInt*);
+SLEPC_EXTERN PetscErrorCode STContourGetKSPs(ST,PetscInt*,KSP**);
@@ -26,15 +26,23 @@
        [2] A. V. Knyazev et al., "Block Locally Optimal Preconditioned
            Eigenvalue Xolvers (BLOPEX) in Hypre and PETSc", SIAM J. Sci.
            Comput. 29(5):2224-2239, 2007.
+
+       [3] J. A. Duersch, M. Shao, C. Yang, and M. Gu, "A robust and
+           efficient implementation of LOBPCG", SIAM J. Sci. Comput.
+           40(5):C655-C676, 2018.
 */
 
 #include <slepc/private/epsimpl.h>                /*I "slepceps.h" I*/
+#include <slepcblaslapack.h>
 
 typedef struct {
   PetscInt  bs;        /* block size */
   PetscBool lock;      /* soft locking active/inactive */
   PetscReal restart;   /* restart parameter */
   PetscInt  guard;     /* number of guard vectors */
+  PetscBool implicit;  /* update the Gram matrices implicitly */
+  PetscInt  recompute; /* recompute the images and Gram matrices explicitly every this number of its */
+  PetscInt  nexpl;     /* number of explicit recomputations of the Gram matrices */
 } EPS_LOBPCG;
 
 static PetscErrorCode EPSSetDimensions_LOBPCG(EPS eps,PetscInt nev,PetscInt *ncv,PetscInt *mpd)
@@ -82,16 +90,137 @@ static PetscErrorCode EPSSetUp_LOBPCG(EPS eps)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   Copies the blocks X, R and P (the latter only if its>1) to Z
+*/
+static PetscErrorCode EPSLOBPCGCopyBlocks_Private(BV X,BV R,BV P,BV Z,PetscInt bs,PetscInt ini,PetscInt its)
+{
+  PetscFunctionBegin;
+  PetscCall(BVSetActiveColumns(Z,0,bs));
+  PetscCall(BVSetActiveColumns(X,0,bs));
+  PetscCall(BVCopy(X,Z));
+  PetscCall(BVSetActiveColumns(Z,bs,2*bs-ini));
+  PetscCall(BVCopy(R,Z));
+  if (its>1) {
+    PetscCall(BVSetActiveColumns(Z,2*bs-ini,3*bs-2*ini));
+    PetscCall(BVCopy(P,Z));
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   Computes the images Q = [A*R A*P B*R B*P] of the active columns of R and P, where
+   A*P and B*P are taken from AP and BP unless explicit is true (if B is NULL, the
+   last two blocks are copies of R and P)
+*/
+static PetscErrorCode EPSLOBPCGComputeImages(Mat A,Mat B,BV R,BV P,BV AP,BV BP,BV Q,PetscInt nr,PetscInt np,PetscBool explicit)
+{
+  PetscInt nq=nr+np;
+
+  PetscFunctionBegin;
+  PetscCall(BVSetActiveColumns(Q,0,nr));
+  PetscCall(BVMatMult(R,A,Q));
+  PetscCall(BVSetActiveColumns(Q,nq,nq+nr));
+  if (B) PetscCall(BVMatMult(R,B,Q));
+  else PetscCall(BVCopy(R,Q));
+  if (np) {
+    PetscCall(BVSetActiveColumns(Q,nr,nq));
+    if (explicit) PetscCall(BVMatMult(P,A,Q));
+    else PetscCall(BVCopy(AP,Q));
+    PetscCall(BVSetActiveColumns(Q,nq+nr,2*nq));
+    if (B && explicit) PetscCall(BVMatMult(P,B,Q));
+    else PetscCall(BVCopy(B?BP:P,Q));
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   Builds the projected pencil from G = Z'*Q, with Z = [X R P] and Q as computed in
+   EPSLOBPCGComputeImages(), obtained with a single global reduction. The blocks
+   associated with X are not computed, since they are diag(theta) and the identity.
+   The columns of R and P in Z and Q are scaled to unit B-norm, and ok is set to false
+   if the scaled B-matrix is too ill-conditioned (or singular) to be trusted
+*/
+static PetscErrorCode EPSLOBPCGImplicitGram(EPS eps,BV Z,BV Q,Mat G,PetscInt bs,PetscInt nv,PetscScalar *theta,PetscBool flip,PetscBool *ok)
+{
+  PetscInt     i,j,nq=nv-bs,ld,ldg;
+  PetscScalar  *pA,*pB,*pG,*T;
+  PetscReal    *d,sgn=flip?-1.0:1.0,lmin=PETSC_MAX_REAL,lmax=0.0;
+  PetscBLASInt n,ldt,info;
+
+  PetscFunctionBegin;
+  *ok = PETSC_TRUE;
+  PetscCall(BVSetActiveColumns(Z,0,nv));
+  PetscCall(BVSetActiveColumns(Q,0,2*nq));
+  PetscCall(BVDot(Q,Z,G));
+  PetscCall(MatDenseGetLDA(G,&ldg));
+  PetscCall(MatDenseGetArray(G,&pG));
+  PetscCall(PetscMalloc2(nv,&d,nv*nv,&T));
+  for (i=0;i<bs;i++) d[i] = 1.0;
+  for (i=bs;i<nv;i++) {
+    d[i] = PetscSqrtReal(PetscAbsReal(PetscRealPart(pG[i+(nq+i-bs)*ldg])));
+    if (d[i]==0.0) *ok = PETSC_FALSE;
+  }
+  if (*ok) {
+    PetscCall(DSGetLeadingDimension(eps->ds,&ld));
+    PetscCall(DSGetArray(eps->ds,DS_MAT_A,&pA));
+    PetscCall(DSGetArray(eps->ds,DS_MAT_B,&pB));
+    for (j=0;j<nv;j++) {
+      for (i=0;i<=j;i++) {
+        if (j<bs) {
+          pA[i+j*ld] = (i==j)? theta[j]: 0.0;
+          pB[i+j*ld] = (i==j)? 1.0: 0.0;
+        } else {
+          pA[i+j*ld] = sgn*pG[i+(j-bs)*ldg]/(d[i]*d[j]);
+          pB[i+j*ld] = pG[i+(nq+j-bs)*ldg]/(d[i]*d[j]);
+        }
+        if (i==j) {
+          pA[i+j*ld] = PetscRealPart(pA[i+j*ld]);
+          pB[i+j*ld] = PetscRealPart(pB[i+j*ld]);
+        } else {
+          pA[j+i*ld] = PetscConj(pA[i+j*ld]);
+          pB[j+i*ld] = PetscConj(pB[i+j*ld]);
+        }
+      }
+    }
+    for (j=0;j<nv;j++) for (i=0;i<nv;i++) T[i+j*nv] = pB[i+j*ld];
+    PetscCall(DSRestoreArray(eps->ds,DS_MAT_A,&pA));
+    PetscCall(DSRestoreArray(eps->ds,DS_MAT_B,&pB));
+    for (i=bs;i<nv;i++) {
+      PetscCall(BVScaleColumn(Z,i,1.0/d[i]));
+      PetscCall(BVScaleColumn(Q,i-bs,1.0/d[i]));
+      PetscCall(BVScaleColumn(Q,nq+i-bs,1.0/d[i]));
+    }
+    /* estimate the conditioning of the B-matrix from its Cholesky factor */
+    PetscCall(PetscBLASIntCast(nv,&n));
+    ldt = n;
+    PetscCall(PetscFPTrapPush(PETSC_FP_TRAP_OFF));
+    PetscCallBLAS("LAPACKpotrf",LAPACKpotrf_("U",&n,T,&ldt,&info));
+    PetscCall(PetscFPTrapPop());
+    if (info) *ok = PETSC_FALSE;
+    else {
+      for (i=0;i<nv;i++) {
+        lmin = PetscMin(lmin,PetscAbsScalar(T[i+i*nv]));
+        lmax = PetscMax(lmax,PetscAbsScalar(T[i+i*nv]));
+      }
+      if (lmin*lmin<PETSC_SQRT_MACHINE_EPSILON*lmax*lmax) *ok = PETSC_FALSE;
+    }
+  }
+  PetscCall(MatDenseRestoreArray(G,&pG));
+  PetscCall(PetscFree2(d,T));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode EPSSolve_LOBPCG(EPS eps)
 {
   EPS_LOBPCG     *ctx = (EPS_LOBPCG*)eps->data;
-  PetscInt       i,j,k,nv,ini,nmat,nc,nconv,locked,its,prev=0;
+  PetscInt       i,j,k,nv,nq,ini,nmat,nc,nconv,locked,its,prev=0,ldc,ldm;
   PetscReal      norm;
-  PetscScalar    *eigr,dot;
-  PetscBool      breakdown,countc,flip=PETSC_FALSE,checkprecond=PETSC_FALSE;
-  Mat            A,B,M,V=NULL,W=NULL;
+  PetscScalar    *eigr,dot,*pC,*pM;
+  PetscBool      breakdown,countc,flip=PETSC_FALSE,checkprecond=PETSC_FALSE,bxvalid=PETSC_FALSE,ok,refresh,periodic,exact=PETSC_TRUE,verify;
+  Mat            A,B,M,V=NULL,W=NULL,G=NULL,C=NULL;
   Vec            v,z,w=eps->work[0];
-  BV             X,Y=NULL,Z,R,P,AX,BX;
+  BV             X,Y=NULL,Z,R,P,AX,BX,Q=NULL,AP=NULL,BP=NULL;
   SlepcSC        sc;
 
   PetscFunctionBegin;
@@ -117,6 +246,16 @@ static PetscErrorCode EPSSolve_LOBPCG(EPS eps)
   PetscCall(BVDuplicateResize(eps->V,ctx->bs,&P));
   PetscCall(BVDuplicateResize(eps->V,ctx->bs,&AX));
   if (B) PetscCall(BVDuplicateResize(eps->V,ctx->bs,&BX));
+  if (ctx->implicit) {
+    PetscCall(BVDuplicateResize(eps->V,4*ctx->bs,&Q));
+    PetscCall(BVDuplicateResize(eps->V,ctx->bs,&AP));
+    if (B) PetscCall(BVDuplicateResize(eps->V,ctx->bs,&BP));
+    PetscCall(BVSetMatrix(Z,NULL,PETSC_FALSE));
+    PetscCall(BVSetMatrix(Q,NULL,PETSC_FALSE));
+    PetscCall(MatCreateSeqDense(PETSC_COMM_SELF,3*ctx->bs,4*ctx->bs,NULL,&G));
+    PetscCall(MatCreateSeqDense(PETSC_COMM_SELF,4*ctx->bs,ctx->bs,NULL,&C));
+    ctx->nexpl = 0;
+  }
   nc = eps->nds;
   if (nc>0 || eps->nev>ctx->bs-ctx->guard) PetscCall(BVDuplicateResize(eps->V,nc+eps->nev,&Y));
   if (nc>0) {
@@ -173,33 +312,50 @@ static PetscErrorCode EPSSolve_LOBPCG(EPS eps)
       if (B) PetscCall(BVSetActiveColumns(BX,nconv,ctx->bs));
     }
 
-    /* 7. Compute residuals */
     ini = (ctx->lock)? nconv: 0;
-    PetscCall(BVCopy(AX,R));
-    if (B) PetscCall(BVMatMult(X,B,BX));
-    for (j=ini;j<ctx->bs;j++) {
-      PetscCall(BVGetColumn(R,j,&v));
-      PetscCall(BVGetColumn(B?BX:X,j,&z));
-      PetscCall(VecAXPY(v,-eps->eigr[locked+j],z));
-      PetscCall(BVRestoreColumn(R,j,&v));
-      PetscCall(BVRestoreColumn(B?BX:X,j,&z));
-    }
+    do {
+      /* 7. Compute residuals */
+      PetscCall(BVCopy(AX,R));
+      if (B && !bxvalid) PetscCall(BVMatMult(X,B,BX));
+      for (j=ini;j<ctx->bs;j++) {
+        PetscCall(BVGetColumn(R,j,&v));
+        PetscCall(BVGetColumn(B?BX:X,j,&z));
+        PetscCall(VecAXPY(v,-eps->eigr[locked+j],z));
+        PetscCall(BVRestoreColumn(R,j,&v));
+        PetscCall(BVRestoreColumn(B?BX:X,j,&z));
+      }
 
-    /* 8. Compute residual norms and update index set of active iterates */
-    k = ini;
-    countc = PETSC_TRUE;
-    for (j=ini;j<ctx->bs;j++) {
-      i = locked+j;
-      PetscCall(BVGetColumn(R,j,&v));
-      PetscCall(VecNorm(v,NORM_2,&norm));
-      PetscCall(BVRestoreColumn(R,j,&v));
-      PetscCall((*eps->converged)(eps,eps->eigr[i],eps->eigi[i],norm,&eps->errest[i],eps->convergedctx));
-      if (countc) {
-        if (eps->errest[i] < eps->tol) k++;
-        else countc = PETSC_FALSE;
+      /* 8. Compute residual norms and update index set of active iterates */
+      k = ini;
+      countc = PETSC_TRUE;
+      for (j=ini;j<ctx->bs;j++) {
+        i = locked+j;
+        PetscCall(BVGetColumn(R,j,&v));
+        PetscCall(VecNorm(v,NORM_2,&norm));
+        PetscCall(BVRestoreColumn(R,j,&v));
+        PetscCall((*eps->converged)(eps,eps->eigr[i],eps->eigi[i],norm,&eps->errest[i],eps->convergedctx));
+        if (countc) {
+          if (eps->errest[i] < eps->tol) k++;
+          else countc = PETSC_FALSE;
+        }
+        if (!countc && !eps->trackall) break;
       }
-      if (!countc && !eps->trackall) break;
-    }
+
+      /* the residuals of the implicit variant are obtained from updated images of X,
+         so convergence is confirmed with explicitly computed residuals */
+      verify = (ctx->implicit && !exact && k>ini)? PETSC_TRUE: PETSC_FALSE;
+      if (verify) {
+        PetscCall(PetscInfo(eps,"Checking convergence with explicitly computed residuals\n"));
+        ctx->nexpl++;
+        PetscCall(BVSetActiveColumns(X,ini,ctx->bs));
+        PetscCall(BVMatMult(X,A,AX));
+        if (B) {
+          PetscCall(BVMatMult(X,B,BX));
+          bxvalid = PETSC_TRUE;
+        }
+        exact = PETSC_TRUE;
+      }
+    } while (verify);
     nconv = k;
     eps->nconv = locked + nconv;
     if (its) PetscCall(EPSMonitor(eps,eps->its+its,eps->nconv,eps->eigr,eps->eigi,eps->errest,locked+ctx->bs));
@@ -276,6 +432,8 @@ static PetscErrorCode EPSSolve_LOBPCG(EPS eps)
       PetscCall(BVMultInPlace(X,M,0,nv));
       PetscCall(BVMultInPlace(AX,M,0,nv));
       PetscCall(DSRestoreMat(eps->ds,DS_MAT_X,&M));
+      bxvalid = PETSC_FALSE;
+      exact   = PETSC_TRUE;
 
       continue;   /* skip the rest of the iteration */
     }
@@ -326,35 +484,63 @@ static PetscErrorCode EPSSolve_LOBPCG(EPS eps)
     PetscCall(MatCopy(W,V,SAME_NONZERO_PATTERN));
     PetscCall(BVRestoreMat(R,&V));
 
-    /* 11. B-orthonormalize preconditioned residuals */
-    PetscCall(BVOrthogonalize(R,NULL));
-
-    /* 13-16. B-orthonormalize conjugate directions */
-    if (its>1) PetscCall(BVOrthogonalize(P,NULL));
+    refresh = PETSC_TRUE;
+    if (ctx->implicit) {
+      /* 17-23. Compute the Gram matrices with a single reduction, using the images of P
+         updated in the previous iteration, and without orthonormalizing R and P */
+      nq = (its>1)? 2*(ctx->bs-ini): ctx->bs-ini;
+      nv = ctx->bs+nq;
+      PetscCall(DSSetDimensions(eps->ds,nv,0,0));
+      PetscCall(EPSLOBPCGCopyBlocks_Private(X,R,P,Z,ctx->bs,ini,its));
+      if (its>1) {
+        PetscCall(BVSetActiveColumns(AP,ini,ctx->bs));
+        if (B) PetscCall(BVSetActiveColumns(BP,ini,ctx->bs));
+      }
+      /* every ctx->recompute iterations, discard the updated images to avoid drift */
+      periodic = (ctx->recompute>0 && !((eps->its+its)%ctx->recompute))? PETSC_TRUE: PETSC_FALSE;
+      ok = PETSC_FALSE;
+      if (!periodic) {
+        PetscCall(EPSLOBPCGComputeImages(A,B,R,P,AP,BP,Q,ctx->bs-ini,(its>1)?ctx->bs-ini:0,PETSC_FALSE));
+        PetscCall(EPSLOBPCGImplicitGram(eps,Z,Q,G,ctx->bs,nv,eigr,flip,&ok));
+        if (ok) refresh = PETSC_FALSE;
+        else PetscCall(PetscInfo(eps,"Ill-conditioned Gram matrix, recomputing it explicitly\n"));
+      } else PetscCall(PetscInfo(eps,"Periodic explicit recomputation of the Gram matrix\n"));
+      if (!ok) {  /* explicit recomputation with B-orthonormalized R and P */
+        ctx->nexpl++;
+        PetscCall(BVOrthogonalize(R,NULL));
+        if (its>1) PetscCall(BVOrthogonalize(P,NULL));
+        PetscCall(EPSLOBPCGCopyBlocks_Private(X,R,P,Z,ctx->bs,ini,its));
+        PetscCall(EPSLOBPCGComputeImages(A,B,R,P,AP,BP,Q,ctx->bs-ini,(its>1)?ctx->bs-ini:0,PETSC_TRUE));
+        PetscCall(EPSLOBPCGImplicitGram(eps,Z,Q,G,ctx->bs,nv,eigr,flip,&ok));
+        if (!ok) {
+          PetscCall(PetscInfo(eps,"Breakdown in the explicitly computed Gram matrix\n"));
+          eps->reason = EPS_DIVERGED_BREAKDOWN;
+          goto diverged;
+        }
+      }
+      exact = refresh;
+    } else {
+      /* 11. B-orthonormalize preconditioned residuals */
+      PetscCall(BVOrthogonalize(R,NULL));
 
-    /* 17-23. Compute symmetric Gram matrices */
-    PetscCall(BVSetActiveColumns(Z,0,ctx->bs));
-    PetscCall(BVSetActiveColumns(X,0,ctx->bs));
-    PetscCall(BVCopy(X,Z));
-    PetscCall(BVSetActiveColumns(Z,ctx->bs,2*ctx->bs-ini));
-    PetscCall(BVCopy(R,Z));
-    if (its>1) {
-      PetscCall(BVSetActiveColumns(Z,2*ctx->bs-ini,3*ctx->bs-2*ini));
-      PetscCall(BVCopy(P,Z));
-    }
+      /* 13-16. B-orthonormalize conjugate directions */
+      if (its>1) PetscCall(BVOrthogonalize(P,NULL));
 
-    if (its>1) nv = 3*ctx->bs-2*ini;
-    else nv = 2*ctx->bs-ini;
+      /* 17-23. Compute symmetric Gram matrices */
+      PetscCall(EPSLOBPCGCopyBlocks_Private(X,R,P,Z,ctx->bs,ini,its));
+      if (its>1) nv = 3*ctx->bs-2*ini;
+      else nv = 2*ctx->bs-ini;
 
-    PetscCall(BVSetActiveColumns(Z,0,nv));
-    PetscCall(DSSetDimensions(eps->ds,nv,0,0));
-    PetscCall(DSGetMat(eps->ds,DS_MAT_A,&M));
-    PetscCall(BVMatProject(Z,A,Z,M));
-    if (flip) PetscCall(MatScale(M,-1.0));
-    PetscCall(DSRestoreMat(eps->ds,DS_MAT_A,&M));
-    PetscCall(DSGetMat(eps->ds,DS_MAT_B,&M));
-    PetscCall(BVMatProject(Z,B,Z,M)); /* covers also the case B=NULL */
-    PetscCall(DSRestoreMat(eps->ds,DS_MAT_B,&M));
+      PetscCall(BVSetActiveColumns(Z,0,nv));
+      PetscCall(DSSetDimensions(eps->ds,nv,0,0));
+      PetscCall(DSGetMat(eps->ds,DS_MAT_A,&M));
+      PetscCall(BVMatProject(Z,A,Z,M));
+      if (flip) PetscCall(MatScale(M,-1.0));
+      PetscCall(DSRestoreMat(eps->ds,DS_MAT_A,&M));
+      PetscCall(DSGetMat(eps->ds,DS_MAT_B,&M));
+      PetscCall(BVMatProject(Z,B,Z,M)); /* covers also the case B=NULL */
+      PetscCall(DSRestoreMat(eps->ds,DS_MAT_B,&M));
+    }
 
     /* 24. Solve the generalized eigenvalue problem */
     PetscCall(DSSetState(eps->ds,DS_STATE_RAW));
@@ -373,8 +559,44 @@ static PetscErrorCode EPSSolve_LOBPCG(EPS eps)
     if (ctx->lock) PetscCall(BVSetActiveColumns(P,nconv,ctx->bs));
     PetscCall(BVSetActiveColumns(Z,0,ctx->bs));
     PetscCall(BVMult(X,1.0,1.0,Z,M));
+    if (ctx->implicit) {
+      /* update the images of X and P with the same coefficients, e.g., AX=[AX AR AP]*M */
+      nq = nv-ctx->bs;
+      PetscCall(MatDenseGetLDA(C,&ldc));
+      PetscCall(MatDenseGetArray(C,&pC));
+      PetscCall(MatDenseGetArrayRead(M,(const PetscScalar**)&pM));
+      PetscCall(MatDenseGetLDA(M,&ldm));
+      for (j=0;j<ctx->bs;j++) {
+        for (i=0;i<nq;i++) pC[i+j*ldc] = pC[nq+i+j*ldc] = pM[ctx->bs+i+j*ldm];
+      }
+      PetscCall(MatDenseRestoreArrayRead(M,(const PetscScalar**)&pM));
+      PetscCall(MatDenseRestoreArray(C,&pC));
+      PetscCall(BVSetActiveColumns(Q,0,nq));
+      PetscCall(BVSetActiveColumns(AP,0,ctx->bs));
+      PetscCall(BVMult(AP,1.0,0.0,Q,C));
+      PetscCall(BVSetActiveColumns(AX,0,ctx->bs));
+      if (refresh) PetscCall(BVMatMult(X,A,AX));  /* X has all columns active here */
+      else {
+        PetscCall(BVMultInPlace(AX,M,0,ctx->bs));
+        PetscCall(BVMult(AX,1.0,1.0,Q,C));
+      }
+      PetscCall(BVSetActiveColumns(AX,ini,ctx->bs));
+      if (B) {
+        PetscCall(BVSetActiveColumns(Q,nq,2*nq));
+        PetscCall(BVSetActiveColumns(BP,0,ctx->bs));
+        PetscCall(BVMult(BP,1.0,0.0,Q,C));
+        PetscCall(BVSetActiveColumns(BX,0,ctx->bs));
+        if (refresh) PetscCall(BVMatMult(X,B,BX));
+        else {
+          PetscCall(BVMultInPlace(BX,M,0,ctx->bs));
+          PetscCall(BVMult(BX,1.0,1.0,Q,C));
+        }
+        PetscCall(BVSetActiveColumns(BX,ini,ctx->bs));
+      }
+      bxvalid = PETSC_TRUE;
+    }
     if (ctx->lock) PetscCall(BVSetActiveColumns(X,nconv,ctx->bs));
-    PetscCall(BVMatMult(X,A,AX));
+    if (!ctx->implicit) PetscCall(BVMatMult(X,A,AX));
     PetscCall(DSRestoreMat(eps->ds,DS_MAT_X,&M));
   }
 
@@ -392,6 +614,11 @@ diverged:
   PetscCall(BVDestroy(&AX));
   if (B) PetscCall(BVDestroy(&BX));
   if (nc>0 || eps->nev>ctx->bs-ctx->guard) PetscCall(BVDestroy(&Y));
+  PetscCall(BVDestroy(&Q));
+  PetscCall(BVDestroy(&AP));
+  PetscCall(BVDestroy(&BP));
+  PetscCall(MatDestroy(&G));
+  PetscCall(MatDestroy(&C));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -618,6 +845,176 @@ PetscErrorCode EPSLOBPCGGetLocking(EPS eps,PetscBool *lock)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode EPSLOBPCGSetImplicitGram_LOBPCG(EPS eps,PetscBool implicit)
+{
+  EPS_LOBPCG *ctx = (EPS_LOBPCG*)eps->data;
+
+  PetscFunctionBegin;
+  ctx->implicit = implicit;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSLOBPCGSetImplicitGram - Activates the variant of LOBPCG that updates the
+   Gram matrices implicitly.
+
+   Logically Collective
+
+   Input Parameters:
++  eps      - the eigenproblem solver context
+-  implicit - true if the Gram matrices must be updated implicitly
+
+   Options Database Key:
+.  -eps_lobpcg_implicit_gram - Sets the implicit Gram flag
+
+   Notes:
+   In the default variant, the preconditioned residuals and the conjugate
+   directions are B-orthonormalized in every iteration, and the projected
+   matrices are computed from scratch, which requires several global reductions
+   per iteration. In the implicit variant, the products of A and B with the
+   conjugate directions (and with the current iterate) are updated with the
+   same coefficients as the vectors themselves, so that only the products with
+   the preconditioned residuals need to be computed, and all blocks of the
+   projected matrices are obtained with a single global reduction.
+
+   The blocks are scaled to unit B-norm instead of orthonormalized, and the
+   conditioning of the projected B matrix is checked in every iteration. If the
+   check fails, the iteration is repeated with B-orthonormalized blocks and
+   explicitly computed products, as in the default variant [3]. To prevent the
+   accumulation of rounding errors in the updated products, they are also
+   recomputed explicitly every few iterations (see EPSLOBPCGSetImplicitRecompute()),
+   and the convergence of the Ritz pairs is always confirmed with explicitly
+   computed residuals.
+
+   Level: advanced
+
+.seealso: EPSLOBPCGGetImplicitGram(), EPSLOBPCGSetImplicitRecompute()
+@*/
+PetscErrorCode EPSLOBPCGSetImplicitGram(EPS eps,PetscBool implicit)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscValidLogicalCollectiveBool(eps,implicit,2);
+  PetscTryMethod(eps,"EPSLOBPCGSetImplicitGram_C",(EPS,PetscBool),(eps,implicit));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode EPSLOBPCGGetImplicitGram_LOBPCG(EPS eps,PetscBool *implicit)
+{
+  EPS_LOBPCG *ctx = (EPS_LOBPCG*)eps->data;
+
+  PetscFunctionBegin;
+  *implicit = ctx->implicit;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSLOBPCGGetImplicitGram - Gets the flag indicating whether the Gram matrices
+   are updated implicitly in the LOBPCG method.
+
+   Not Collective
+
+   Input Parameter:
+.  eps - the eigenproblem solver context
+
+   Output Parameter:
+.  implicit - the implicit Gram flag
+
+   Level: advanced
+
+.seealso: EPSLOBPCGSetImplicitGram()
+@*/
+PetscErrorCode EPSLOBPCGGetImplicitGram(EPS eps,PetscBool *implicit)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscAssertPointer(implicit,2);
+  PetscUseMethod(eps,"EPSLOBPCGGetImplicitGram_C",(EPS,PetscBool*),(eps,implicit));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode EPSLOBPCGSetImplicitRecompute_LOBPCG(EPS eps,PetscInt recompute)
+{
+  EPS_LOBPCG *ctx = (EPS_LOBPCG*)eps->data;
+
+  PetscFunctionBegin;
+  if (recompute == PETSC_DEFAULT || recompute == PETSC_DECIDE) recompute = 20;
+  else PetscCheck(recompute>=0,PetscObjectComm((PetscObject)eps),PETSC_ERR_ARG_OUTOFRANGE,"Invalid number of iterations %" PetscInt_FMT,recompute);
+  ctx->recompute = recompute;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSLOBPCGSetImplicitRecompute - Sets the number of iterations between explicit
+   recomputations of the products and Gram matrices in the implicit variant of
+   the LOBPCG method.
+
+   Logically Collective
+
+   Input Parameters:
++  eps       - the eigenproblem solver context
+-  recompute - the number of iterations
+
+   Options Database Key:
+.  -eps_lobpcg_implicit_recompute - Sets the number of iterations between explicit
+   recomputations
+
+   Notes:
+   This parameter is relevant only if the implicit variant has been activated
+   with EPSLOBPCGSetImplicitGram(). Every recompute iterations, the updated products
+   of A and B with the current iterate and the conjugate directions are discarded,
+   and the Gram matrices are computed explicitly. A value of 0 disables the periodic
+   recomputation, and then the products are recomputed only when the projected B
+   matrix is ill-conditioned. Use PETSC_DETERMINE to set the default value (20).
+
+   Level: advanced
+
+.seealso: EPSLOBPCGGetImplicitRecompute(), EPSLOBPCGSetImplicitGram()
+@*/
+PetscErrorCode EPSLOBPCGSetImplicitRecompute(EPS eps,PetscInt recompute)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscValidLogicalCollectiveInt(eps,recompute,2);
+  PetscTryMethod(eps,"EPSLOBPCGSetImplicitRecompute_C",(EPS,PetscInt),(eps,recompute));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode EPSLOBPCGGetImplicitRecompute_LOBPCG(EPS eps,PetscInt *recompute)
+{
+  EPS_LOBPCG *ctx = (EPS_LOBPCG*)eps->data;
+
+  PetscFunctionBegin;
+  *recompute = ctx->recompute;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSLOBPCGGetImplicitRecompute - Gets the number of iterations between explicit
+   recomputations of the products and Gram matrices in the implicit variant of
+   the LOBPCG method.
+
+   Not Collective
+
+   Input Parameter:
+.  eps - the eigenproblem solver context
+
+   Output Parameter:
+.  recompute - the number of iterations
+
+   Level: advanced
+
+.seealso: EPSLOBPCGSetImplicitRecompute()
+@*/
+PetscErrorCode EPSLOBPCGGetImplicitRecompute(EPS eps,PetscInt *recompute)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscAssertPointer(recompute,2);
+  PetscUseMethod(eps,"EPSLOBPCGGetImplicitRecompute_C",(EPS,PetscInt*),(eps,recompute));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode EPSView_LOBPCG(EPS eps,PetscViewer viewer)
 {
   EPS_LOBPCG     *ctx = (EPS_LOBPCG*)eps->data;
@@ -629,14 +1026,20 @@ static PetscErrorCode EPSView_LOBPCG(EPS eps,PetscViewer viewer)
     PetscCall(PetscViewerASCIIPrintf(viewer,"  block size %" PetscInt_FMT "\n",ctx->bs));
     PetscCall(PetscViewerASCIIPrintf(viewer,"  restart parameter=%g (using %" PetscInt_FMT " guard vectors)\n",(double)ctx->restart,ctx->guard));
     PetscCall(PetscViewerASCIIPrintf(viewer,"  soft locking %sactivated\n",ctx->lock?"":"de"));
+    if (ctx->implicit) {
+      if (ctx->recompute) PetscCall(PetscViewerASCIIPrintf(viewer,"  using implicit update of the Gram matrices, recomputed every %" PetscInt_FMT " iterations\n",ctx->recompute));
+      else PetscCall(PetscViewerASCIIPrintf(viewer,"  using implicit update of the Gram matrices, without periodic recomputation\n"));
+      PetscCall(PetscViewerASCIIPrintf(viewer,"  number of explicit recomputations: %" PetscInt_FMT "\n",ctx->nexpl));
+    }
   }
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
 static PetscErrorCode EPSSetFromOptions_LOBPCG(EPS eps,PetscOptionItems *PetscOptionsObject)
 {
-  PetscBool      lock,flg;
-  PetscInt       bs;
+  EPS_LOBPCG     *ctx = (EPS_LOBPCG*)eps->data;
+  PetscBool      lock,implicit,flg;
+  PetscInt       bs,recompute;
   PetscReal      restart;
 
   PetscFunctionBegin;
@@ -651,6 +1054,12 @@ static PetscErrorCode EPSSetFromOptions_LOBPCG(EPS eps,PetscOptionItems *PetscOp
     PetscCall(PetscOptionsBool("-eps_lobpcg_locking","Choose between locking and non-locking variants","EPSLOBPCGSetLocking",PETSC_TRUE,&lock,&flg));
     if (flg) PetscCall(EPSLOBPCGSetLocking(eps,lock));
 
+    PetscCall(PetscOptionsBool("-eps_lobpcg_implicit_gram","Update the Gram matrices implicitly with a single reduction per iteration","EPSLOBPCGSetImplicitGram",PETSC_FALSE,&implicit,&flg));
+    if (flg) PetscCall(EPSLOBPCGSetImplicitGram(eps,implicit));
+
+    PetscCall(PetscOptionsInt("-eps_lobpcg_implicit_recompute","Number of iterations between explicit recomputations of the Gram matrices","EPSLOBPCGSetImplicitRecompute",ctx->recompute,&recompute,&flg));
+    if (flg) PetscCall(EPSLOBPCGSetImplicitRecompute(eps,recompute));
+
   PetscOptionsHeadEnd();
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -665,6 +1074,10 @@ static PetscErrorCode EPSDestroy_LOBPCG(EPS eps)
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSLOBPCGGetRestart_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSLOBPCGSetLocking_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSLOBPCGGetLocking_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSLOBPCGSetImplicitGram_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSLOBPCGGetImplicitGram_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSLOBPCGSetImplicitRecompute_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSLOBPCGGetImplicitRecompute_C",NULL));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -675,7 +1088,8 @@ SLEPC_EXTERN PetscErrorCode EPSCreate_LOBPCG(EPS eps)
   PetscFunctionBegin;
   PetscCall(PetscNew(&lobpcg));
   eps->data = (void*)lobpcg;
-  lobpcg->lock = PETSC_TRUE;
+  lobpcg->lock      = PETSC_TRUE;
+  lobpcg->recompute = 20;
 
   eps->useds = PETSC_TRUE;
   eps->categ = EPS_CATEGORY_PRECOND;
@@ -695,5 +1109,9 @@ SLEPC_EXTERN PetscErrorCode EPSCreate_LOBPCG(EPS eps)
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSLOBPCGGetRestart_C",EPSLOBPCGGetRestart_LOBPCG));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSLOBPCGSetLocking_C",EPSLOBPCGSetLocking_LOBPCG));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSLOBPCGGetLocking_C",EPSLOBPCGGetLocking_LOBPCG));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSLOBPCGSetImplicitGram_C",EPSLOBPCGSetImplicitGram_LOBPCG));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSLOBPCGGetImplicitGram_C",EPSLOBPCGGetImplicitGram_LOBPCG));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSLOBPCGSetImplicitRecompute_C",EPSLOBPCGSetImplicitRecompute_LOBPCG));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSLOBPCGGetImplicitRecompute_C",EPSLOBPCGGetImplicitRecompute_LOBPCG));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -0,0 +1,442 @@
+/*
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+   SLEPc - Scalable Library for Eigenvalue Problem Computations
+   Copyright (c) 2002-, Universitat Politecnica de Valencia, Spain
+
+   This file is part of SLEPc.
+   SLEPc is distributed under a 2-clause BSD license (see LICENSE).
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+*/
+/*
+   SLEPc eigensolver: "chfsi"
+
+   Method: Chebyshev-filtered subspace iteration
+
+   Algorithm:
+
+       Subspace iteration for Hermitian problems in which the block is
+       multiplied at each iteration by a Chebyshev polynomial that damps
+       the unwanted part of the spectrum, followed by orthonormalization
+       and Rayleigh-Ritz projection, with locking. The degree of the
+       polynomial is adapted for each column from the convergence rate of
+       its Ritz value.
+
+   References:
+
+       [1] Y. Zhou, Y. Saad, M.L. Tiago, and J.R. Chelikowsky, "Self-consistent-
+           field calculations using Chebyshev-filtered subspace iteration",
+           J. Comput. Phys. 219(1):172-184, 2006.
+
+       [2] Y. Zhou and Y. Saad, "A Chebyshev-Davidson algorithm for large
+           symmetric eigenproblems", SIAM J. Matrix Anal. Appl. 29(3):954-971,
+           2007.
+
+       [3] J. Winkelmann, P. Springer, and E. Di Napoli, "ChASE: Chebyshev
+           accelerated subspace iteration eigensolver for sequences of
+           Hermitian eigenvalue problems", ACM Trans. Math. Software 45(2),
+           2019.
+*/
+
+#include <slepc/private/epsimpl.h>                /*I "slepceps.h" I*/
+#include <slepcblaslapack.h>
+
+typedef struct {
+  PetscInt  degree;       /* degree of the filter in the first iteration */
+  PetscInt  maxdegree;    /* maximum degree of the filter */
+  PetscReal lmin,lmax;    /* estimated bounds of the spectrum of the operator */
+} EPS_CHFSI;
+
+static PetscErrorCode EPSSetUp_ChFSI(EPS eps)
+{
+  PetscBool          isshift,flg;
+  BVOrthogType       otype;
+  BVOrthogRefineType oref;
+  BVOrthogBlockType  obtype;
+  PetscReal          eta;
+
+  PetscFunctionBegin;
+  EPSCheckHermitian(eps);
+  EPSCheckStandard(eps);
+  EPSCheckNotStructured(eps);
+  PetscCall(PetscObjectTypeCompare((PetscObject)eps->st,STSHIFT,&isshift));
+  PetscCheck(isshift,PetscObjectComm((PetscObject)eps),PETSC_ERR_SUP,"This solver requires the ST to be of type shift");
+  PetscCall(EPSSetDimensions_Default(eps,eps->nev,&eps->ncv,&eps->mpd));
+  if (eps->max_it==PETSC_DETERMINE) eps->max_it = PetscMax(100,2*eps->n/eps->ncv);
+  if (!eps->which) eps->which = EPS_SMALLEST_REAL;
+  PetscCheck(eps->which==EPS_SMALLEST_REAL || eps->which==EPS_LARGEST_REAL,PetscObjectComm((PetscObject)eps),PETSC_ERR_SUP,"This solver supports only smallest real or largest real eigenvalues");
+  EPSCheckUnsupported(eps,EPS_FEATURE_ARBITRARY | EPS_FEATURE_REGION | EPS_FEATURE_EXTRACTION | EPS_FEATURE_TWOSIDED);
+  EPSCheckIgnored(eps,EPS_FEATURE_BALANCE);
+  PetscCheck(!eps->nds,PetscObjectComm((PetscObject)eps),PETSC_ERR_SUP,"This solver does not support deflation spaces");
+
+  PetscCall(EPSAllocateSolution(eps,0));
+  PetscCall(EPS_SetInnerProduct(eps));
+  /* the filtered block is ill-conditioned, so use a block orthogonalization
+     unless the user has chosen one in the command line */
+  PetscCall(BVGetOrthogonalization(eps->V,&otype,&oref,&eta,&obtype));
+  PetscCall(PetscOptionsHasName(((PetscObject)eps->V)->options,((PetscObject)eps->V)->prefix,"-bv_orthog_block",&flg));
+  if (obtype==BV_ORTHOG_BLOCK_GS && !flg) {
+    PetscCall(BVSetOrthogonalization(eps->V,otype,oref,eta,BV_ORTHOG_BLOCK_SVQB));
+    PetscCall(PetscInfo(eps,"Switching to SVQB block orthogonalization\n"));
+  }
+  PetscCall(DSSetType(eps->ds,DSHEP));
+  PetscCall(DSAllocate(eps->ds,eps->ncv));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   EPSChFSILanczosBounds - Runs a few steps of Lanczos with full reorthogonalization
+   on S, using the columns of W as workspace. On output, tmin and tmax are the
+   extreme Ritz values, and lmin, lmax are estimates of the bounds of the spectrum
+   obtained by adding the norm of the last residual, as in [1].
+*/
+static PetscErrorCode EPSChFSILanczosBounds(Mat S,BV W,PetscReal *tmin,PetscReal *tmax,PetscReal *lmin,PetscReal *lmax)
+{
+  PetscInt     j,k,nc,maxk=10;
+  PetscReal    *d,*e,*w,*work,beta=0.0,abstol=0.0,vl,vu;
+  PetscScalar  *h;
+  PetscBool    breakdown=PETSC_FALSE;
+  PetscBLASInt n,il,iu,m,*isuppz,*iwork,lwork,liwork,info;
+
+  PetscFunctionBegin;
+  PetscCall(BVGetSizes(W,NULL,NULL,&nc));
+  k = PetscMin(maxk,nc-1);
+  PetscCall(PetscMalloc4(k,&d,k,&e,k,&w,k+1,&h));
+  PetscCall(BVSetActiveColumns(W,0,nc));
+  PetscCall(BVSetRandomColumn(W,0));
+  PetscCall(BVOrthonormalizeColumn(W,0,PETSC_TRUE,NULL,NULL));
+  for (j=0;j<k && !breakdown;j++) {
+    PetscCall(BVMatMultColumn(W,S,j));
+    PetscCall(BVOrthogonalizeColumn(W,j+1,h,&beta,&breakdown));
+    d[j] = PetscRealPart(h[j]);
+    e[j] = beta;
+    if (!breakdown) PetscCall(BVScaleColumn(W,j+1,1.0/beta));
+  }
+
+  /* eigenvalues of the tridiagonal matrix, in ascending order */
+  PetscCall(PetscBLASIntCast(j,&n));
+  PetscCall(PetscBLASIntCast(20*j,&lwork));
+  PetscCall(PetscBLASIntCast(10*j,&liwork));
+  PetscCall(PetscMalloc3(2*j,&isuppz,lwork,&work,liwork,&iwork));
+  PetscCall(PetscFPTrapPush(PETSC_FP_TRAP_OFF));
+  PetscCallBLAS("LAPACKstevr",LAPACKstevr_("N","A",&n,d,e,&vl,&vu,&il,&iu,&abstol,&m,w,NULL,&n,isuppz,work,&lwork,iwork,&liwork,&info));
+  PetscCall(PetscFPTrapPop());
+  SlepcCheckLapackInfo("stevr",info);
+  *tmin = w[0];
+  *tmax = w[j-1];
+  *lmin = w[0]-beta;
+  *lmax = w[j-1]+beta;
+  PetscCall(PetscFree3(isuppz,work,iwork));
+  PetscCall(PetscFree4(d,e,w,h));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   EPSChFSIFilter - Overwrites each non-locked column i of V with p_i(s*S)*V(:,i),
+   where p_i is the Chebyshev polynomial of degree deg[i] that damps the interval
+   [a,b], scaled so that p_i(a0)=1, with the three-term recurrence of [2].
+
+   The degrees must be nondecreasing, so that columns that have reached their
+   degree can leave the active window while the rest of the block goes on. The
+   three work BVs in Z are overwritten.
+*/
+static PetscErrorCode EPSChFSIFilter(EPS eps,Mat S,PetscReal s,PetscReal a,PetscReal b,PetscReal a0,PetscInt *deg,BV *Z)
+{
+  PetscInt  j,lo,hi,nv=eps->ncv;
+  PetscReal c,e,sigma,sigma1,sigma2,tau;
+  BV        X=Z[0],Y=Z[1],W=Z[2],T;
+
+  PetscFunctionBegin;
+  c = (b+a)/2.0;
+  e = (b-a)/2.0;
+  sigma1 = e/(a0-c);
+  sigma  = sigma1;
+  tau    = 2.0/sigma1;
+  lo = eps->nconv;
+  PetscCall(BVSetActiveColumns(eps->V,lo,nv));
+  PetscCall(BVSetActiveColumns(X,lo,nv));
+  PetscCall(BVCopy(eps->V,X));
+  for (j=1;lo<nv;j++) {
+    PetscCall(BVSetActiveColumns(X,lo,nv));
+    PetscCall(BVSetActiveColumns(Y,lo,nv));
+    if (j==1) {  /* Y = (s*S-c*I)*X*sigma1/e */
+      PetscCall(BVMatMult(X,S,Y));
+      PetscCall(BVMult(Y,-c*sigma1/e,s*sigma1/e,X,NULL));
+    } else {     /* W = 2*(s*S-c*I)*Y*sigma2/e-sigma*sigma2*X */
+      sigma2 = 1.0/(tau-sigma);
+      PetscCall(BVSetActiveColumns(W,lo,nv));
+      PetscCall(BVMatMult(Y,S,W));
+      PetscCall(BVMult(W,-2.0*c*sigma2/e,2.0*s*sigma2/e,Y,NULL));
+      PetscCall(BVMult(W,-sigma*sigma2,1.0,X,NULL));
+      sigma = sigma2;
+      T = X; X = Y; Y = W; W = T;
+    }
+    /* copy back the columns that have reached their degree */
+    for (hi=lo;hi<nv && deg[hi]==j;hi++);
+    if (hi>lo) {
+      PetscCall(BVSetActiveColumns(Y,lo,hi));
+      PetscCall(BVSetActiveColumns(eps->V,lo,hi));
+      PetscCall(BVCopy(Y,eps->V));
+    }
+    lo = hi;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode EPSSolve_ChFSI(EPS eps)
+{
+  EPS_CHFSI         *ctx = (EPS_CHFSI*)eps->data;
+  Mat               S,H,Q,T;
+  BV                Z[3],AV;
+  BVOrthogBlockType obtype;
+  PetscBool         twopass;
+  PetscInt          i,k,nv=eps->ncv,*deg;
+  PetscReal         s,a,b,a0,tmin,tmax,c,e,t,rho,*rsd;
+
+  PetscFunctionBegin;
+  s = (eps->which==EPS_SMALLEST_REAL)? 1.0: -1.0;  /* work with the eigenvalues of s*S */
+  PetscCall(PetscMalloc2(nv,&rsd,nv,&deg));
+  for (i=0;i<3;i++) PetscCall(BVDuplicate(eps->V,&Z[i]));
+  AV = Z[0];
+  PetscCall(STGetOperator(eps->st,&S));
+  /* CholQR and SVQB are repeated once to recover full orthogonality */
+  PetscCall(BVGetOrthogonalization(eps->V,NULL,NULL,NULL,&obtype));
+  twopass = (obtype==BV_ORTHOG_BLOCK_CHOL || obtype==BV_ORTHOG_BLOCK_SVQB)? PETSC_TRUE: PETSC_FALSE;
+
+  /* Estimate the spectral bounds, the cutoff is initially in the middle */
+  PetscCall(EPSChFSILanczosBounds(S,Z[0],&tmin,&tmax,&ctx->lmin,&ctx->lmax));
+  PetscCall(PetscInfo(eps,"Estimated spectral bounds [%g,%g]\n",(double)ctx->lmin,(double)ctx->lmax));
+  a0 = (s>0.0)? tmin: -tmax;
+  b  = (s>0.0)? ctx->lmax: -ctx->lmin;
+  a  = s*(tmin+tmax)/2.0;
+  for (i=0;i<nv;i++) deg[i] = ctx->degree;
+
+  /* Complete the initial basis with random vectors and orthonormalize them */
+  for (k=eps->nini;k<nv;k++) {
+    PetscCall(BVSetRandomColumn(eps->V,k));
+    PetscCall(BVOrthonormalizeColumn(eps->V,k,PETSC_TRUE,NULL,NULL));
+  }
+
+  while (eps->reason == EPS_CONVERGED_ITERATING) {
+    eps->its++;
+
+    /* V(:,idx) = p(s*S)*V(:,idx), and orthonormalize against the locked vectors */
+    PetscCall(EPSChFSIFilter(eps,S,s,a,b,a0,deg,Z));
+    PetscCall(BVSetActiveColumns(eps->V,eps->nconv,nv));
+    PetscCall(BVOrthogonalize(eps->V,NULL));
+    if (twopass) PetscCall(BVOrthogonalize(eps->V,NULL));
+
+    /* Rayleigh-Ritz, AV(:,idx) = S*V(:,idx) is kept for the residuals */
+    PetscCall(DSSetDimensions(eps->ds,nv,eps->nconv,0));
+    PetscCall(BVSetActiveColumns(AV,eps->nconv,nv));
+    PetscCall(BVMatMult(eps->V,S,AV));
+    PetscCall(BVSetActiveColumns(eps->V,0,nv));
+    PetscCall(DSGetMat(eps->ds,DS_MAT_A,&H));
+    PetscCall(BVDot(AV,eps->V,H));
+    PetscCall(DSRestoreMat(eps->ds,DS_MAT_A,&H));
+    PetscCall(DSSetState(eps->ds,DS_STATE_RAW));
+    PetscCall(DSSolve(eps->ds,eps->eigr,eps->eigi));
+    PetscCall(DSSort(eps->ds,eps->eigr,eps->eigi,NULL,NULL,NULL));
+    PetscCall(DSSynchronize(eps->ds,eps->eigr,eps->eigi));
+    PetscCall(DSGetMat(eps->ds,DS_MAT_Q,&Q));
+    PetscCall(BVMultInPlace(eps->V,Q,eps->nconv,nv));
+    PetscCall(BVMultInPlace(AV,Q,eps->nconv,nv));
+    PetscCall(DSRestoreMat(eps->ds,DS_MAT_Q,&Q));
+
+    /* Residual norms of the non-locked Ritz pairs */
+    PetscCall(DSGetMat(eps->ds,DS_MAT_A,&T));
+    PetscCall(BVMult(AV,-1.0,1.0,eps->V,T));
+    PetscCall(DSRestoreMat(eps->ds,DS_MAT_A,&T));
+    for (i=eps->nconv;i<nv;i++) PetscCall(BVNormColumnBegin(AV,i,NORM_2,rsd+i));
+    for (i=eps->nconv;i<nv;i++) PetscCall(BVNormColumnEnd(AV,i,NORM_2,rsd+i));
+    for (i=eps->nconv;i<nv;i++) PetscCall((*eps->converged)(eps,eps->eigr[i],0.0,rsd[i],&eps->errest[i],eps->convergedctx));
+
+    /* Lock the leading converged pairs */
+    for (k=eps->nconv;k<nv && eps->errest[k]<eps->tol;k++);
+    eps->nconv = k;
+    PetscCall(EPSMonitor(eps,eps->its,eps->nconv,eps->eigr,eps->eigi,eps->errest,nv));
+    PetscCall((*eps->stopping)(eps,eps->its,eps->max_it,eps->nconv,eps->nev,&eps->reason,eps->stoppingctx));
+    if (eps->reason != EPS_CONVERGED_ITERATING) break;
+
+    /* Update the filter interval from the Ritz values */
+    a0 = s*PetscRealPart(eps->eigr[0]);
+    a  = s*PetscRealPart(eps->eigr[nv-1]);
+    if (a>=b) a = (a0+b)/2.0;
+
+    /* Degree needed by each Ritz pair to converge, made nondecreasing */
+    c = (b+a)/2.0;
+    e = (b-a)/2.0;
+    for (i=eps->nconv;i<nv;i++) {
+      t = (s*PetscRealPart(eps->eigr[i])-c)/e;
+      if (t<-1.0) {
+        rho = -t+PetscSqrtReal(t*t-1.0);
+        deg[i] = (PetscInt)PetscCeilReal(PetscLogReal(eps->errest[i]/eps->tol)/PetscLogReal(rho));
+        deg[i] = PetscMax(1,PetscMin(deg[i],ctx->maxdegree));
+      } else deg[i] = ctx->degree;
+      if (i>eps->nconv) deg[i] = PetscMax(deg[i],deg[i-1]);
+    }
+  }
+
+  PetscCall(PetscFree2(rsd,deg));
+  for (i=0;i<3;i++) PetscCall(BVDestroy(&Z[i]));
+  PetscCall(STRestoreOperator(eps->st,&S));
+  PetscCall(DSTruncate(eps->ds,eps->nconv,PETSC_TRUE));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode EPSChFSISetDegree_ChFSI(EPS eps,PetscInt deg,PetscInt maxdeg)
+{
+  EPS_CHFSI *ctx = (EPS_CHFSI*)eps->data;
+
+  PetscFunctionBegin;
+  if (deg==PETSC_DETERMINE) ctx->degree = 20;
+  else if (deg!=PETSC_CURRENT) {
+    PetscCheck(deg>0,PetscObjectComm((PetscObject)eps),PETSC_ERR_ARG_OUTOFRANGE,"The degree must be positive");
+    ctx->degree = deg;
+  }
+  if (maxdeg==PETSC_DETERMINE) ctx->maxdegree = 36;
+  else if (maxdeg!=PETSC_CURRENT) {
+    PetscCheck(maxdeg>0,PetscObjectComm((PetscObject)eps),PETSC_ERR_ARG_OUTOFRANGE,"The maximum degree must be positive");
+    ctx->maxdegree = maxdeg;
+  }
+  ctx->maxdegree = PetscMax(ctx->maxdegree,ctx->degree);
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSChFSISetDegree - Sets the degree of the Chebyshev filter used in the
+   ChFSI eigensolver.
+
+   Logically Collective
+
+   Input Parameters:
++  eps    - the eigenproblem solver context
+.  deg    - the degree of the filter in the first iteration
+-  maxdeg - the maximum degree of the filter
+
+   Options Database Key:
+.  -eps_chfsi_degree <deg,maxdeg> - Sets the degree parameters
+
+   Notes:
+   PETSC_CURRENT can be used to preserve the current value of any of the
+   arguments, and PETSC_DETERMINE to set them to a default value.
+
+   In the first iteration, all columns of the block are filtered with a
+   polynomial of degree deg. In subsequent iterations, the degree of each
+   column is computed from the residual norm and the convergence rate of its
+   Ritz value, so that nearly converged columns require fewer products, and
+   it is bounded by maxdeg. If maxdeg is smaller than deg, it is set to deg.
+
+   Level: advanced
+
+.seealso: EPSChFSIGetDegree()
+@*/
+PetscErrorCode EPSChFSISetDegree(EPS eps,PetscInt deg,PetscInt maxdeg)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscValidLogicalCollectiveInt(eps,deg,2);
+  PetscValidLogicalCollectiveInt(eps,maxdeg,3);
+  PetscTryMethod(eps,"EPSChFSISetDegree_C",(EPS,PetscInt,PetscInt),(eps,deg,maxdeg));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode EPSChFSIGetDegree_ChFSI(EPS eps,PetscInt *deg,PetscInt *maxdeg)
+{
+  EPS_CHFSI *ctx = (EPS_CHFSI*)eps->data;
+
+  PetscFunctionBegin;
+  if (deg) *deg = ctx->degree;
+  if (maxdeg) *maxdeg = ctx->maxdegree;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSChFSIGetDegree - Gets the degree of the Chebyshev filter used in the
+   ChFSI eigensolver.
+
+   Not Collective
+
+   Input Parameter:
+.  eps - the eigenproblem solver context
+
+   Output Parameters:
++  deg    - the degree of the filter in the first iteration
+-  maxdeg - the maximum degree of the filter
+
+   Level: advanced
+
+.seealso: EPSChFSISetDegree()
+@*/
+PetscErrorCode EPSChFSIGetDegree(EPS eps,PetscInt *deg,PetscInt *maxdeg)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscUseMethod(eps,"EPSChFSIGetDegree_C",(EPS,PetscInt*,PetscInt*),(eps,deg,maxdeg));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode EPSSetFromOptions_ChFSI(EPS eps,PetscOptionItems *PetscOptionsObject)
+{
+  PetscInt  k,array[2]={PETSC_DETERMINE,PETSC_DETERMINE};
+  PetscBool flg;
+
+  PetscFunctionBegin;
+  PetscOptionsHeadBegin(PetscOptionsObject,"EPS ChFSI Options");
+
+    k = 2;
+    PetscCall(PetscOptionsIntArray("-eps_chfsi_degree","Degree of the Chebyshev filter (one or two comma-separated integers)","EPSChFSISetDegree",array,&k,&flg));
+    if (flg) PetscCall(EPSChFSISetDegree(eps,array[0],array[1]));
+
+  PetscOptionsHeadEnd();
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode EPSView_ChFSI(EPS eps,PetscViewer viewer)
+{
+  EPS_CHFSI *ctx = (EPS_CHFSI*)eps->data;
+  PetscBool isascii;
+
+  PetscFunctionBegin;
+  PetscCall(PetscObjectTypeCompare((PetscObject)viewer,PETSCVIEWERASCII,&isascii));
+  if (isascii) {
+    PetscCall(PetscViewerASCIIPrintf(viewer,"  Chebyshev filter degree: %" PetscInt_FMT " (maximum %" PetscInt_FMT ")\n",ctx->degree,ctx->maxdegree));
+    if (ctx->lmin<ctx->lmax) PetscCall(PetscViewerASCIIPrintf(viewer,"  estimated spectral bounds: [%g,%g]\n",(double)ctx->lmin,(double)ctx->lmax));
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode EPSDestroy_ChFSI(EPS eps)
+{
+  PetscFunctionBegin;
+  PetscCall(PetscFree(eps->data));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSChFSISetDegree_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSChFSIGetDegree_C",NULL));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+SLEPC_EXTERN PetscErrorCode EPSCreate_ChFSI(EPS eps)
+{
+  EPS_CHFSI *ctx;
+
+  PetscFunctionBegin;
+  PetscCall(PetscNew(&ctx));
+  eps->data = (void*)ctx;
+  ctx->degree    = 20;
+  ctx->maxdegree = 36;
+
+  eps->useds = PETSC_TRUE;
+  eps->categ = EPS_CATEGORY_OTHER;
+
+  eps->ops->solve          = EPSSolve_ChFSI;
+  eps->ops->setup          = EPSSetUp_ChFSI;
+  eps->ops->setupsort      = EPSSetUpSort_Default;
+  eps->ops->setfromoptions = EPSSetFromOptions_ChFSI;
+  eps->ops->destroy        = EPSDestroy_ChFSI;
+  eps->ops->view           = EPSView_ChFSI;
+  eps->ops->backtransform  = EPSBackTransform_Default;
+  eps->ops->computevectors = EPSComputeVectors_Hermitian;
+
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSChFSISetDegree_C",EPSChFSISetDegree_ChFSI));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSChFSIGetDegree_C",EPSChFSIGetDegree_ChFSI));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
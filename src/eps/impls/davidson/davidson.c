@@ -196,6 +196,7 @@ PetscErrorCode EPSSolve_XD(EPS eps)
 
   PetscFunctionBegin;
   PetscCall(PetscCitationsRegister(citation,&cited));
+  data->pcrefresh = 0;
   /* Call the starting routines */
   PetscCall(EPSDavidsonFLCall(d->startList,d));
 
@@ -212,6 +213,9 @@ PetscErrorCode EPSSolve_XD(EPS eps)
     PetscCall((*eps->stopping)(eps,eps->its,eps->max_it,eps->nconv,eps->nev,&eps->reason,eps->stoppingctx));
     if (eps->reason != EPS_CONVERGED_ITERATING) break;
 
+    /* Rebuild the preconditioner, if required by the refresh policy */
+    if (d->e_newIteration) PetscCall(d->e_newIteration(d));
+
     /* Expand the subspace */
     PetscCall(d->updateV(d));
 
@@ -357,6 +361,43 @@ PetscErrorCode EPSXDGetBOrth_XD(EPS eps,PetscBool *borth)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+PetscErrorCode EPSXDSetPreconditionerRefresh_XD(EPS eps,PetscInt lag,PetscReal tol,PetscInt its)
+{
+  EPS_DAVIDSON *data = (EPS_DAVIDSON*)eps->data;
+
+  PetscFunctionBegin;
+  if (lag == PETSC_DETERMINE) lag = 0;
+  if (lag != PETSC_CURRENT) {
+    PetscCheck(lag>=0,PetscObjectComm((PetscObject)eps),PETSC_ERR_ARG_OUTOFRANGE,"Invalid lag value, must be >=0");
+    if (data->pclag != lag) eps->state = EPS_STATE_INITIAL;
+    data->pclag = lag;
+  }
+  if (tol == (PetscReal)PETSC_DETERMINE) tol = 0.0;
+  if (tol != (PetscReal)PETSC_CURRENT) {
+    PetscCheck(tol>=0.0,PetscObjectComm((PetscObject)eps),PETSC_ERR_ARG_OUTOFRANGE,"Invalid shift tolerance, must be >=0");
+    if (data->pcshifttol != tol) eps->state = EPS_STATE_INITIAL;
+    data->pcshifttol = tol;
+  }
+  if (its == PETSC_DETERMINE) its = 0;
+  if (its != PETSC_CURRENT) {
+    PetscCheck(its>=0,PetscObjectComm((PetscObject)eps),PETSC_ERR_ARG_OUTOFRANGE,"Invalid number of iterations, must be >=0");
+    if (data->pcmaxits != its) eps->state = EPS_STATE_INITIAL;
+    data->pcmaxits = its;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+PetscErrorCode EPSXDGetPreconditionerRefresh_XD(EPS eps,PetscInt *lag,PetscReal *tol,PetscInt *its)
+{
+  EPS_DAVIDSON *data = (EPS_DAVIDSON*)eps->data;
+
+  PetscFunctionBegin;
+  if (lag) *lag = data->pclag;
+  if (tol) *tol = data->pcshifttol;
+  if (its) *its = data->pcmaxits;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*
   EPSComputeVectors_XD - Compute eigenvectors from the vectors
   provided by the eigensolver. This version is intended for solvers
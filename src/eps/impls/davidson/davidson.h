@@ -143,6 +143,7 @@ typedef struct _dvdDashboard {
   void *calcpairs_residual_data;
   PetscErrorCode (*improvex_precond)(struct _dvdDashboard*,PetscInt,Vec,Vec);
   void *improvex_precond_data;
+  PetscInt improvex_lits;     /* max iterations of the correction equations since the last check */
   PetscErrorCode (*improvex_jd_proj_uv)(struct _dvdDashboard*,PetscInt,PetscInt,Vec*,Vec*,Vec*,PetscScalar*,PetscScalar*,PetscScalar*,PetscScalar*,PetscInt);
   PetscErrorCode (*improvex_jd_lit)(struct _dvdDashboard*,PetscInt,PetscScalar*,PetscScalar*,PetscInt*,PetscReal*);
   PetscErrorCode (*calcpairs_W)(struct _dvdDashboard*);
@@ -181,6 +182,11 @@ typedef struct {
   PetscBool krylovstart;   /* true if the starting subspace is a Krylov basis */
   PetscBool dynamic;       /* true if dynamic stopping criterion is used */
   PetscBool doubleexp;     /* double expansion in GD (GD2) */
+  PetscBool blockcorr;     /* solve the correction equations of the block at once (JD) */
+  PetscInt  pclag;         /* rebuild the preconditioner every pclag iterations */
+  PetscReal pcshifttol;    /* rebuild the preconditioner if the shift moves more than this */
+  PetscInt  pcmaxits;      /* rebuild the preconditioner if the correction equation needs more its */
+  PetscInt  pcrefresh;     /* number of rebuilds of the preconditioner in the last solve */
 
   /*----------------- Child objects and working data -------------------*/
   dvdDashboard ddb;
@@ -290,5 +296,7 @@ SLEPC_INTERN PetscErrorCode EPSXDGetInitialSize_XD(EPS,PetscInt*);
 SLEPC_INTERN PetscErrorCode EPSXDSetInitialSize_XD(EPS,PetscInt);
 SLEPC_INTERN PetscErrorCode EPSXDSetBOrth_XD(EPS,PetscBool);
 SLEPC_INTERN PetscErrorCode EPSXDGetBOrth_XD(EPS,PetscBool*);
+SLEPC_INTERN PetscErrorCode EPSXDSetPreconditionerRefresh_XD(EPS,PetscInt,PetscReal,PetscInt);
+SLEPC_INTERN PetscErrorCode EPSXDGetPreconditionerRefresh_XD(EPS,PetscInt*,PetscReal*,PetscInt*);
 SLEPC_INTERN PetscErrorCode EPSJDGetFix_JD(EPS,PetscReal*);
 SLEPC_INTERN PetscErrorCode EPSJDGetConstCorrectionTol_JD(EPS,PetscBool*);
@@ -42,6 +42,16 @@ typedef struct {
   PetscInt     size_cX;            /* last value of d->size_cX */
   PetscInt     old_size_X;         /* last number of improved vectors */
   PetscBLASInt *iXKZPivots;        /* array of pivots */
+  PetscBool    block;              /* solve the correction equations of all pairs at once */
+  PetscInt     nb;                 /* number of columns of the current block solve */
+  PetscInt     col;                /* column being solved if KSPMatSolve() goes column by column */
+  PetscInt     blits;              /* maximum number of iterations of the columns solved one by one */
+  PetscInt     *bidx;              /* pair associated to each column of the block */
+  PetscScalar  *btheta;            /* the shifts used in each column of the block */
+  PetscScalar  *biXKZ;             /* inverse of U_j'*KZ_j for each column of the block */
+  PetscScalar  *bh;                /* work array for the block projector */
+  Mat          bU,bKZ;             /* U_j and KZ_j for each column of the block */
+  Mat          bAX,bBX;            /* work matrices for A*X and B*X */
 } dvdImprovex_jd;
 
 /*
@@ -142,12 +152,217 @@ static PetscErrorCode dvd_improvex_applytrans_proj(dvdDashboard *d,Vec *V,PetscI
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   Compute h_j <- Y_j'*X_j for the first nb columns of X and Y, with a single
+   reduction for all the columns
+*/
+static PetscErrorCode dvd_improvex_dot_block(Mat X,Mat Y,PetscInt nb,PetscScalar *h)
+{
+  PetscInt          i,j,m,ldx,ldy;
+  const PetscScalar *x,*y;
+
+  PetscFunctionBegin;
+  PetscCall(MatGetLocalSize(X,&m,NULL));
+  PetscCall(MatDenseGetLDA(X,&ldx));
+  PetscCall(MatDenseGetLDA(Y,&ldy));
+  PetscCall(MatDenseGetArrayRead(X,&x));
+  PetscCall(MatDenseGetArrayRead(Y,&y));
+  for (j=0;j<nb;j++) {
+    h[j] = 0.0;
+    for (i=0;i<m;i++) h[j] += PetscConj(y[i+j*ldy])*x[i+j*ldx];
+  }
+  PetscCall(MatDenseRestoreArrayRead(Y,&y));
+  PetscCall(MatDenseRestoreArrayRead(X,&x));
+  PetscCallMPI(MPIU_Allreduce(MPI_IN_PLACE,h,nb,MPIU_SCALAR,MPIU_SUM,PetscObjectComm((PetscObject)X)));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   Compute (I - KZ_j*inv(U_j'*KZ_j)*U_j')*X_j for each column j of X (block mode)
+*/
+static PetscErrorCode dvd_improvex_apply_proj_block(dvdImprovex_jd *data,Mat X)
+{
+  PetscInt          i,j,m,nb,ldx,ldk;
+  PetscScalar       *x,*h = data->bh;
+  const PetscScalar *kz;
+
+  PetscFunctionBegin;
+  PetscCall(MatGetSize(X,NULL,&nb));
+  PetscAssert(nb==data->nb,PETSC_COMM_SELF,PETSC_ERR_PLIB,"Consistency broken");
+
+  /* h <- U'*X */
+  PetscCall(dvd_improvex_dot_block(X,data->bU,nb,h));
+
+  /* X_j <- X_j - KZ_j*iXKZ_j*h_j */
+  PetscCall(MatGetLocalSize(X,&m,NULL));
+  PetscCall(MatDenseGetLDA(X,&ldx));
+  PetscCall(MatDenseGetLDA(data->bKZ,&ldk));
+  PetscCall(MatDenseGetArray(X,&x));
+  PetscCall(MatDenseGetArrayRead(data->bKZ,&kz));
+  for (j=0;j<nb;j++) {
+    h[j] *= data->biXKZ[j];
+    for (i=0;i<m;i++) x[i+j*ldx] -= h[j]*kz[i+j*ldk];
+  }
+  PetscCall(MatDenseRestoreArrayRead(data->bKZ,&kz));
+  PetscCall(MatDenseRestoreArray(X,&x));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   Compute (I - KZ_j*inv(U_j'*KZ_j)*U_j')*x for the column j of the block
+*/
+static PetscErrorCode dvd_improvex_apply_proj_col(dvdImprovex_jd *data,PetscInt j,Vec x)
+{
+  PetscScalar h;
+  Vec         u;
+
+  PetscFunctionBegin;
+  PetscCall(MatDenseGetColumnVecRead(data->bU,j,&u));
+  PetscCall(VecDot(x,u,&h));
+  PetscCall(MatDenseRestoreColumnVecRead(data->bU,j,&u));
+  PetscCall(MatDenseGetColumnVecRead(data->bKZ,j,&u));
+  PetscCall(VecAXPY(x,-h*data->biXKZ[j],u));
+  PetscCall(MatDenseRestoreColumnVecRead(data->bKZ,j,&u));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   C <- theta_j[1]*A*X_j - theta_j[0]*B*X_j for each column j of X, followed by
+   the projector in case of right preconditioning (block mode)
+*/
+static PetscErrorCode MatMatMult_dvd_jd_block(Mat A,Mat X,Mat C,void *ctx)
+{
+  dvdImprovex_jd *data;
+  PetscInt       j,nb,m1,m2;
+  Vec            c,ax,bx;
+  PCSide         side;
+
+  PetscFunctionBegin;
+  PetscCall(MatShellGetContext(A,&data));
+  PetscCall(MatGetSize(X,NULL,&nb));
+  PetscAssert(nb==data->nb,PETSC_COMM_SELF,PETSC_ERR_PLIB,"Consistency broken");
+  if (data->bAX) {  /* check if work matrices must be resized */
+    PetscCall(MatGetSize(data->bAX,NULL,&m1));
+    PetscCall(MatGetSize(X,NULL,&m2));
+    if (m1!=m2) {
+      PetscCall(MatDestroy(&data->bAX));
+      PetscCall(MatDestroy(&data->bBX));
+    }
+  }
+  if (!data->bAX) {
+    PetscCall(MatDuplicate(X,MAT_DO_NOT_COPY_VALUES,&data->bAX));
+    if (data->d->B) PetscCall(MatDuplicate(X,MAT_DO_NOT_COPY_VALUES,&data->bBX));
+  }
+  PetscCall(MatMatMult(data->d->A,X,MAT_REUSE_MATRIX,PETSC_DEFAULT,&data->bAX));
+  if (data->d->B) PetscCall(MatMatMult(data->d->B,X,MAT_REUSE_MATRIX,PETSC_DEFAULT,&data->bBX));
+  for (j=0;j<nb;j++) {
+    PetscCall(MatDenseGetColumnVecWrite(C,j,&c));
+    PetscCall(MatDenseGetColumnVecRead(data->bAX,j,&ax));
+    PetscCall(MatDenseGetColumnVecRead(data->d->B?data->bBX:X,j,&bx));
+    PetscCall(VecCopy(ax,c));
+    PetscCall(VecAXPBY(c,-data->btheta[2*j],data->btheta[2*j+1],bx));
+    PetscCall(MatDenseRestoreColumnVecRead(data->d->B?data->bBX:X,j,&bx));
+    PetscCall(MatDenseRestoreColumnVecRead(data->bAX,j,&ax));
+    PetscCall(MatDenseRestoreColumnVecWrite(C,j,&c));
+  }
+  PetscCall(KSPGetPCSide(data->ksp,&side));
+  if (side == PC_RIGHT) PetscCall(dvd_improvex_apply_proj_block(data,C));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   Single-vector version of MatMatMult_dvd_jd_block(), for the column data->col
+*/
+static PetscErrorCode MatMult_dvd_jd_block(Mat A,Vec in,Vec out)
+{
+  dvdImprovex_jd *data;
+  PetscInt       j;
+  Vec            Bx;
+  PCSide         side;
+
+  PetscFunctionBegin;
+  PetscCall(MatShellGetContext(A,&data));
+  j = PetscMax(data->col,0);
+  PetscCall(MatMult(data->d->A,in,out));
+  if (data->d->B) {
+    PetscCall(SlepcVecPoolGetVecs(data->d->auxV,1,&Bx));
+    PetscCall(MatMult(data->d->B,in,Bx[0]));
+    PetscCall(VecAXPBY(out,-data->btheta[2*j],data->btheta[2*j+1],Bx[0]));
+    PetscCall(SlepcVecPoolRestoreVecs(data->d->auxV,1,&Bx));
+  } else PetscCall(VecAXPBY(out,-data->btheta[2*j],data->btheta[2*j+1],in));
+  PetscCall(KSPGetPCSide(data->ksp,&side));
+  if (side == PC_RIGHT) PetscCall(dvd_improvex_apply_proj_col(data,j,out));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode PCMatApply_dvd_block(PC pc,Mat X,Mat Y)
+{
+  dvdImprovex_jd *data;
+  Mat            A;
+
+  PetscFunctionBegin;
+  PetscCall(PCGetOperators(pc,&A,NULL));
+  PetscCall(MatShellGetContext(A,&data));
+  /* Y <- K*X */
+  PetscCall(PCMatApply(data->old_pc,X,Y));
+  /* Y <- Y - v*(u'*Y) */
+  PetscCall(dvd_improvex_apply_proj_block(data,Y));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode PCApply_dvd_block(PC pc,Vec in,Vec out)
+{
+  dvdImprovex_jd *data;
+  Mat            A;
+
+  PetscFunctionBegin;
+  PetscCall(PCGetOperators(pc,&A,NULL));
+  PetscCall(MatShellGetContext(A,&data));
+  /* out <- K*in */
+  PetscCall(PCApply(data->old_pc,in,out));
+  /* out <- out - v*(u'*out) */
+  PetscCall(dvd_improvex_apply_proj_col(data,PetscMax(data->col,0),out));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   KSPMatSolve() solves the columns one after the other with KSPSolve() if the
+   KSP type has no block implementation; keep track of the current column
+*/
+static PetscErrorCode KSPPreSolve_dvd_block(KSP ksp,Vec b,Vec x,void *ctx)
+{
+  dvdImprovex_jd *data = (dvdImprovex_jd*)ctx;
+
+  PetscFunctionBegin;
+  data->col++;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   In that case KSPGetIterationNumber() only reports the last column after
+   KSPMatSolve(), so keep the maximum over all the columns
+*/
+static PetscErrorCode KSPPostSolve_dvd_block(KSP ksp,Vec b,Vec x,void *ctx)
+{
+  dvdImprovex_jd *data = (dvdImprovex_jd*)ctx;
+  PetscInt       lits;
+
+  PetscFunctionBegin;
+  PetscCall(KSPGetIterationNumber(ksp,&lits));
+  data->blits = PetscMax(data->blits,lits);
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode dvd_improvex_jd_end(dvdDashboard *d)
 {
   dvdImprovex_jd *data = (dvdImprovex_jd*)d->improveX_data;
 
   PetscFunctionBegin;
   PetscCall(VecDestroy(&data->friends));
+  if (data->block) {
+    PetscCall(KSPSetPreSolve(data->ksp,NULL,NULL));
+    PetscCall(KSPSetPostSolve(data->ksp,NULL,NULL));
+  }
 
   /* Restore the pc of ksp */
   if (data->old_pc) {
@@ -168,6 +383,11 @@ static PetscErrorCode dvd_improvex_jd_d(dvdDashboard *d)
   PetscCall(PetscFree(data->iXKZPivots));
   PetscCall(BVDestroy(&data->KZ));
   PetscCall(BVDestroy(&data->U));
+  PetscCall(PetscFree4(data->bidx,data->btheta,data->biXKZ,data->bh));
+  PetscCall(MatDestroy(&data->bU));
+  PetscCall(MatDestroy(&data->bKZ));
+  PetscCall(MatDestroy(&data->bAX));
+  PetscCall(MatDestroy(&data->bBX));
   PetscCall(PetscFree(data));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -431,7 +651,7 @@ static PetscErrorCode MatCreateVecs_dvd_jd(Mat A,Vec *right,Vec *left)
 static PetscErrorCode dvd_improvex_jd_start(dvdDashboard *d)
 {
   dvdImprovex_jd *data = (dvdImprovex_jd*)d->improveX_data;
-  PetscInt       rA, cA, rlA, clA;
+  PetscInt       rA, cA, rlA, clA, bs;
   Mat            A;
   PetscBool      t;
   PC             pc;
@@ -443,11 +663,14 @@ static PetscErrorCode dvd_improvex_jd_start(dvdDashboard *d)
 
   /* Setup the ksp */
   if (data->ksp) {
-    /* Create the reference vector */
-    PetscCall(BVGetColumn(d->eps->V,0,&v0[0]));
-    v0[1] = v0[0];
-    PetscCall(VecCreateCompWithVecs(v0,data->ksp_max_size,NULL,&data->friends));
-    PetscCall(BVRestoreColumn(d->eps->V,0,&v0[0]));
+    /* Create the reference vector, in block mode the KSP works with plain vectors */
+    bs = data->block? 1: data->ksp_max_size;
+    if (!data->block) {
+      PetscCall(BVGetColumn(d->eps->V,0,&v0[0]));
+      v0[1] = v0[0];
+      PetscCall(VecCreateCompWithVecs(v0,data->ksp_max_size,NULL,&data->friends));
+      PetscCall(BVRestoreColumn(d->eps->V,0,&v0[0]));
+    } else data->friends = NULL;
 
     /* Save the current pc and set a PCNONE */
     PetscCall(KSPGetPC(data->ksp, &data->old_pc));
@@ -460,9 +683,14 @@ static PetscErrorCode dvd_improvex_jd_start(dvdDashboard *d)
       PetscCall(PCSetType(pc,PCSHELL));
       PetscCall(PCSetOperators(pc,d->A,d->A));
       PetscCall(PCSetReusePreconditioner(pc,PETSC_TRUE));
-      PetscCall(PCShellSetApply(pc,PCApply_dvd));
-      PetscCall(PCShellSetApplyBA(pc,PCApplyBA_dvd));
-      PetscCall(PCShellSetApplyTranspose(pc,PCApplyTranspose_dvd));
+      if (data->block) {
+        PetscCall(PCShellSetApply(pc,PCApply_dvd_block));
+        PetscCall(PCShellSetMatApply(pc,PCMatApply_dvd_block));
+      } else {
+        PetscCall(PCShellSetApply(pc,PCApply_dvd));
+        PetscCall(PCShellSetApplyBA(pc,PCApplyBA_dvd));
+        PetscCall(PCShellSetApplyTranspose(pc,PCApplyTranspose_dvd));
+      }
       PetscCall(KSPSetPC(data->ksp,pc));
       PetscCall(PCDestroy(&pc));
     }
@@ -470,10 +698,17 @@ static PetscErrorCode dvd_improvex_jd_start(dvdDashboard *d)
     /* Create the (I-v*u')*K*(A-s*B) matrix */
     PetscCall(MatGetSize(d->A,&rA,&cA));
     PetscCall(MatGetLocalSize(d->A,&rlA,&clA));
-    PetscCall(MatCreateShell(PetscObjectComm((PetscObject)d->A),rlA*data->ksp_max_size,clA*data->ksp_max_size,rA*data->ksp_max_size,cA*data->ksp_max_size,data,&A));
-    PetscCall(MatShellSetOperation(A,MATOP_MULT,(void(*)(void))MatMult_dvd_jd));
-    PetscCall(MatShellSetOperation(A,MATOP_MULT_TRANSPOSE,(void(*)(void))MatMultTranspose_dvd_jd));
-    PetscCall(MatShellSetOperation(A,MATOP_CREATE_VECS,(void(*)(void))MatCreateVecs_dvd_jd));
+    PetscCall(MatCreateShell(PetscObjectComm((PetscObject)d->A),rlA*bs,clA*bs,rA*bs,cA*bs,data,&A));
+    if (data->block) {
+      PetscCall(MatShellSetOperation(A,MATOP_MULT,(void(*)(void))MatMult_dvd_jd_block));
+      PetscCall(MatShellSetMatProductOperation(A,MATPRODUCT_AB,NULL,MatMatMult_dvd_jd_block,NULL,MATDENSE,MATDENSE));
+      PetscCall(KSPSetPreSolve(data->ksp,KSPPreSolve_dvd_block,data));
+      PetscCall(KSPSetPostSolve(data->ksp,KSPPostSolve_dvd_block,data));
+    } else {
+      PetscCall(MatShellSetOperation(A,MATOP_MULT,(void(*)(void))MatMult_dvd_jd));
+      PetscCall(MatShellSetOperation(A,MATOP_MULT_TRANSPOSE,(void(*)(void))MatMultTranspose_dvd_jd));
+      PetscCall(MatShellSetOperation(A,MATOP_CREATE_VECS,(void(*)(void))MatCreateVecs_dvd_jd));
+    }
 
     /* Try to avoid KSPReset */
     PetscCall(KSPGetOperatorsSet(data->ksp,&t,NULL));
@@ -482,7 +717,7 @@ static PetscErrorCode dvd_improvex_jd_start(dvdDashboard *d)
       PetscInt rM;
       PetscCall(KSPGetOperators(data->ksp,&M,NULL));
       PetscCall(MatGetSize(M,&rM,NULL));
-      if (rM != rA*data->ksp_max_size) PetscCall(KSPReset(data->ksp));
+      if (rM != rA*bs) PetscCall(KSPReset(data->ksp));
     }
     PetscCall(EPS_KSPSetOperators(data->ksp,A,A));
     PetscCall(KSPSetReusePreconditioner(data->ksp,PETSC_TRUE));
@@ -576,6 +811,116 @@ static PetscErrorCode dvd_improvex_jd_proj_cuv(dvdDashboard *d,PetscInt i_s,Pets
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   Block mode: the correction equations of the n selected pairs are solved at
+   once with KSPMatSolve(), each column with its own shift and projector. The
+   projector of each pair is built with dvd_improvex_jd_proj_cuv(), as in the
+   per-pair code, and then saved in the columns of bU and bKZ
+*/
+static PetscErrorCode dvd_improvex_jd_gen_block(dvdDashboard *d,PetscInt r_s,PetscInt n,PetscInt kV,PetscInt *size_D)
+{
+  dvdImprovex_jd *data = (dvdImprovex_jd*)d->improveX_data;
+  PetscInt       i,j,k,ld,maxits=0,maxits0,lits,oldnpreconv,mA,nA;
+  PetscScalar    *pX,*pY;
+  PetscReal      tol=1.0,tol0;
+  Vec            *kr,x;
+  Mat            R,X;
+
+  PetscFunctionBegin;
+  PetscCall(DSGetLeadingDimension(d->eps->ds,&ld));
+  PetscCall(MatGetSize(d->A,&mA,NULL));
+  PetscCall(MatGetLocalSize(d->A,&nA,NULL));
+  if (!data->bU) {
+    PetscCall(MatCreateDense(PetscObjectComm((PetscObject)d->A),nA,PETSC_DECIDE,mA,data->size_X,NULL,&data->bU));
+    PetscCall(MatDuplicate(data->bU,MAT_DO_NOT_COPY_VALUES,&data->bKZ));
+  }
+  PetscCall(SlepcVecPoolGetVecs(d->auxV,n,&kr));
+
+  data->nb = 0;
+  for (i=0;i<n;i++) {
+    PetscCall(d->improvex_jd_lit(d,r_s+i,data->theta,data->thetai,&maxits0,&tol0));
+
+    /* Compute u, v and kr */
+    k = r_s+i;
+    PetscCall(DSVectors(d->eps->ds,DS_MAT_X,&k,NULL));
+    k = r_s+i;
+    PetscCall(DSVectors(d->eps->ds,DS_MAT_Y,&k,NULL));
+    PetscCall(DSGetArray(d->eps->ds,DS_MAT_X,&pX));
+    PetscCall(DSGetArray(d->eps->ds,DS_MAT_Y,&pY));
+    PetscCall(dvd_improvex_jd_proj_cuv(d,r_s+i,r_s+i+1,&kr[i],data->theta,data->thetai,pX,pY,ld));
+    PetscCall(DSRestoreArray(d->eps->ds,DS_MAT_X,&pX));
+    PetscCall(DSRestoreArray(d->eps->ds,DS_MAT_Y,&pY));
+
+    /* Check if the first eigenpair is converged */
+    if (i == 0) {
+      oldnpreconv = d->npreconv;
+      PetscCall(d->preTestConv(d,0,r_s+1,r_s+1,&d->npreconv));
+      if (d->npreconv > oldnpreconv) {
+        PetscCall(SlepcVecPoolRestoreVecs(d->auxV,n,&kr));
+        *size_D = 0;
+        PetscFunctionReturn(PETSC_SUCCESS);
+      }
+    }
+
+    if (data->theta[0] == 1. && data->theta[1] == 0. && d->B == NULL) {
+      /* The coefficient matrix is the identity, expand as in GD */
+      PetscCall(BVGetColumn(d->eps->V,kV+i,&x));
+      PetscCall(d->improvex_precond(d,r_s+i,kr[i],x));
+      PetscCall(dvd_improvex_apply_proj(d,&x,1));
+      PetscCall(BVRestoreColumn(d->eps->V,kV+i,&x));
+    } else {
+      /* Save the shifts and the projector of the pair, that has size one */
+      PetscAssert(data->size_iXKZ==1,PETSC_COMM_SELF,PETSC_ERR_PLIB,"Consistency broken");
+      j = data->nb++;
+      maxits += maxits0;
+      tol *= tol0;
+      data->bidx[j]       = i;
+      data->btheta[2*j]   = data->theta[0];
+      data->btheta[2*j+1] = data->theta[1];
+      data->biXKZ[j]      = 1.0/data->iXKZ[0];
+      PetscCall(MatDenseGetColumnVecWrite(data->bU,j,&x));
+      PetscCall(BVCopyVec(data->U,0,x));
+      PetscCall(MatDenseRestoreColumnVecWrite(data->bU,j,&x));
+      PetscCall(MatDenseGetColumnVecWrite(data->bKZ,j,&x));
+      PetscCall(BVCopyVec(data->KZ,0,x));
+      PetscCall(MatDenseRestoreColumnVecWrite(data->bKZ,j,&x));
+    }
+  }
+
+  /* Solve the correction equations of the block */
+  if (data->nb) {
+    maxits /= data->nb;
+    tol = data->dynamic?data->lastTol:PetscExpReal(PetscLogReal(tol)/data->nb);
+    PetscCall(MatCreateDense(PetscObjectComm((PetscObject)d->A),nA,PETSC_DECIDE,mA,data->nb,NULL,&R));
+    PetscCall(MatDuplicate(R,MAT_DO_NOT_COPY_VALUES,&X));
+    for (j=0;j<data->nb;j++) {  /* R_j <- -kr_j */
+      PetscCall(MatDenseGetColumnVecWrite(R,j,&x));
+      PetscCall(VecCopy(kr[data->bidx[j]],x));
+      PetscCall(VecScale(x,-1.0));
+      PetscCall(MatDenseRestoreColumnVecWrite(R,j,&x));
+    }
+    PetscCall(KSPSetTolerances(data->ksp,tol,PETSC_CURRENT,PETSC_CURRENT,maxits));
+    data->col   = -1;
+    data->blits = 0;
+    PetscCall(KSPMatSolve(data->ksp,R,X));
+    PetscCall(KSPGetIterationNumber(data->ksp,&lits));
+    d->improvex_lits = PetscMax(d->improvex_lits,PetscMax(lits,data->blits));
+    for (j=0;j<data->nb;j++) {
+      PetscCall(MatDenseGetColumnVecRead(X,j,&x));
+      PetscCall(BVInsertVec(d->eps->V,kV+data->bidx[j],x));
+      PetscCall(MatDenseRestoreColumnVecRead(X,j,&x));
+    }
+    PetscCall(MatDestroy(&R));
+    PetscCall(MatDestroy(&X));
+  }
+
+  /* Prevent that short vectors are discarded in the orthogonalization */
+  if (d->eps->errest[d->nconv+r_s] > PETSC_MACHINE_EPSILON && d->eps->errest[d->nconv+r_s] < PETSC_MAX_REAL) PetscCall(BVScaleColumn(d->eps->V,kV,1.0/d->eps->errest[d->nconv+r_s]));
+  PetscCall(SlepcVecPoolRestoreVecs(d->auxV,n,&kr));
+  *size_D = n;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode dvd_improvex_jd_gen(dvdDashboard *d,PetscInt r_s,PetscInt r_e,PetscInt *size_D)
 {
   dvdImprovex_jd *data = (dvdImprovex_jd*)d->improveX_data;
@@ -604,6 +949,12 @@ static PetscErrorCode dvd_improvex_jd_gen(dvdDashboard *d,PetscInt r_s,PetscInt
   if (data->dynamic && data->size_cX < lV)
     data->lastTol = 0.5;
 
+  if (data->block) {
+    PetscCall(dvd_improvex_jd_gen_block(d,r_s,n,kV,size_D));
+    if (data->dynamic && *size_D) data->lastTol = PetscMax(data->lastTol/2.0,PETSC_MACHINE_EPSILON*10.0);
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
+
   for (i=0;i<n;i+=s) {
     /* If the selected eigenvalue is complex, but the arithmetic is real... */
 #if !defined(PETSC_USE_COMPLEX)
@@ -672,6 +1023,7 @@ static PetscErrorCode dvd_improvex_jd_gen(dvdDashboard *d,PetscInt r_s,PetscInt
       PetscCall(KSPSetTolerances(data->ksp,tol,PETSC_CURRENT,PETSC_CURRENT,maxits));
       PetscCall(KSPSolve(data->ksp,kr_comp,D_comp));
       PetscCall(KSPGetIterationNumber(data->ksp,&lits));
+      d->improvex_lits = PetscMax(d->improvex_lits,lits);
 
       /* Destroy the composed ks and D */
       PetscCall(VecDestroy(&kr_comp));
@@ -702,7 +1054,7 @@ static PetscErrorCode dvd_improvex_jd_gen(dvdDashboard *d,PetscInt r_s,PetscInt
 PetscErrorCode dvd_improvex_jd(dvdDashboard *d,dvdBlackboard *b,KSP ksp,PetscInt max_bs,PetscBool dynamic)
 {
   dvdImprovex_jd *data;
-  PetscBool      useGD;
+  PetscBool      useGD,blockcorr = ((EPS_DAVIDSON*)d->eps->data)->blockcorr;
   PC             pc;
   PetscInt       size_P;
 
@@ -748,6 +1100,13 @@ PetscErrorCode dvd_improvex_jd(dvdDashboard *d,dvdBlackboard *b,KSP ksp,PetscInt
     else
 #endif
       data->ksp_max_size = 1;
+    /* Block mode is not available if complex conjugate pairs must be handled */
+    if (blockcorr && data->ksp) {
+      if (data->ksp_max_size == 1) {
+        data->block = PETSC_TRUE;
+        PetscCall(PetscMalloc4(data->size_X,&data->bidx,2*data->size_X,&data->btheta,data->size_X,&data->biXKZ,data->size_X,&data->bh));
+      } else PetscCall(PetscInfo(d->eps,"Block correction equation not available for real non-Hermitian problems, solving one pair at a time\n"));
+    }
     /* Create various vector basis */
     PetscCall(BVDuplicateResize(d->eps->V,size_P,&data->KZ));
     PetscCall(BVSetMatrix(data->KZ,NULL,PETSC_FALSE));
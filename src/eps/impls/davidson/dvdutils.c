@@ -16,7 +16,10 @@
 #include "davidson.h"
 
 typedef struct {
-  PC pc;
+  PC          pc;
+  Mat         P;       /* A-sigma*B, used when the preconditioner is refreshed */
+  PetscScalar sigma;   /* shift of the matrix used to build the preconditioner */
+  PetscInt    it;      /* iterations since the last rebuild */
 } dvdPCWrapper;
 
 /*
@@ -48,6 +51,7 @@ static PetscErrorCode dvd_improvex_precond_d(dvdDashboard *d)
   PetscFunctionBegin;
   /* Free local data */
   PetscCall(PCDestroy(&dvdpc->pc));
+  PetscCall(MatDestroy(&dvdpc->P));
   PetscCall(PetscFree(d->improvex_precond_data));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -61,6 +65,50 @@ static PetscErrorCode dvd_static_precond_PC_0(dvdDashboard *d,PetscInt i,Vec x,V
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+  Rebuild the preconditioner from A-theta*B, where theta is the current
+  approximate eigenvalue, if any criterion of the refresh policy is met
+*/
+static PetscErrorCode dvd_precond_refresh(dvdDashboard *d)
+{
+  dvdPCWrapper   *dvdpc = (dvdPCWrapper*)d->improvex_precond_data;
+  EPS_DAVIDSON   *data = (EPS_DAVIDSON*)d->eps->data;
+  PetscScalar    theta = d->eigr[0];
+  PetscReal      nrm;
+  PetscBool      rebuild = PETSC_FALSE;
+
+  PetscFunctionBegin;
+  if (PetscIsInfOrNanScalar(theta)) PetscFunctionReturn(PETSC_SUCCESS);
+  dvdpc->it++;
+  if (data->pclag && dvdpc->it>=data->pclag) rebuild = PETSC_TRUE;
+  if (data->pcshifttol>0.0) {
+    nrm = PetscMax(PetscAbsScalar(dvdpc->sigma),PetscAbsScalar(theta));
+    if (PetscAbsScalar(theta-dvdpc->sigma)>data->pcshifttol*nrm) rebuild = PETSC_TRUE;
+  }
+  if (data->pcmaxits && d->improvex_lits>data->pcmaxits) rebuild = PETSC_TRUE;
+  d->improvex_lits = 0;
+  if (!rebuild) PetscFunctionReturn(PETSC_SUCCESS);
+
+  /* P = A-theta*B, updating the shift of the previous matrix if possible */
+  if (!dvdpc->P) {
+    PetscCall(MatDuplicate(d->A,MAT_COPY_VALUES,&dvdpc->P));
+    if (d->B) PetscCall(MatAXPY(dvdpc->P,-theta,d->B,DIFFERENT_NONZERO_PATTERN));
+    else PetscCall(MatShift(dvdpc->P,-theta));
+  } else {
+    if (d->B) PetscCall(MatAXPY(dvdpc->P,dvdpc->sigma-theta,d->B,SUBSET_NONZERO_PATTERN));
+    else PetscCall(MatShift(dvdpc->P,dvdpc->sigma-theta));
+  }
+  PetscCall(PCSetOperators(dvdpc->pc,dvdpc->P,dvdpc->P));
+  PetscCall(PCSetReusePreconditioner(dvdpc->pc,PETSC_FALSE));
+  PetscCall(PCSetUp(dvdpc->pc));
+  PetscCall(PCSetReusePreconditioner(dvdpc->pc,PETSC_TRUE));
+  PetscCall(PetscInfo(d->eps,"Preconditioner rebuilt at iteration %" PetscInt_FMT " with shift %g (was %g)\n",d->eps->its,(double)PetscRealPart(theta),(double)PetscRealPart(dvdpc->sigma)));
+  dvdpc->sigma = theta;
+  dvdpc->it    = 0;
+  data->pcrefresh++;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*
   Create a trivial preconditioner
 */
@@ -77,8 +125,10 @@ static PetscErrorCode dvd_precond_none(dvdDashboard *d,PetscInt i,Vec x,Vec Px)
 PetscErrorCode dvd_static_precond_PC(dvdDashboard *d,dvdBlackboard *b,PC pc)
 {
   dvdPCWrapper   *dvdpc;
+  EPS_DAVIDSON   *data = (EPS_DAVIDSON*)d->eps->data;
   Mat            P;
-  PetscBool      t0,t1,t2;
+  STMatMode      matmode;
+  PetscBool      t0,t1,t2,t3,t4=PETSC_TRUE;
 
   PetscFunctionBegin;
   /* Setup the step */
@@ -102,6 +152,18 @@ PetscErrorCode dvd_static_precond_PC(dvdDashboard *d,dvdBlackboard *b,PC pc)
         PetscCall(PCSetOperators(pc,P,P));
         PetscCall(PCSetReusePreconditioner(pc,PETSC_TRUE));
         PetscCall(MatDestroy(&P));
+
+        /* The preconditioner can be rebuilt only if it was obtained from A-sigma*B */
+        if (data->pclag || data->pcshifttol>0.0 || data->pcmaxits) {
+          PetscCall(STGetPreconditionerMat(d->eps->st,&P));
+          PetscCall(STGetMatMode(d->eps->st,&matmode));
+          PetscCall(MatHasOperation(d->A,MATOP_DUPLICATE,&t3));
+          if (d->B) PetscCall(MatHasOperation(d->B,MATOP_AXPY,&t4));
+          if (!P && matmode!=ST_MATMODE_SHELL && t3 && t4) {
+            PetscCall(STGetShift(d->eps->st,&dvdpc->sigma));
+            d->e_newIteration = dvd_precond_refresh;
+          } else PetscCall(PetscInfo(d->eps,"The preconditioner will not be refreshed, since it is not built from the problem matrices\n"));
+        }
       } else if (t2) {
         PetscCall(PCSetOperators(pc,d->A,d->A));
         PetscCall(PCSetReusePreconditioner(pc,PETSC_TRUE));
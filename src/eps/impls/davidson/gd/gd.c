@@ -34,6 +34,7 @@ static PetscErrorCode EPSSetFromOptions_GD(EPS eps,PetscOptionItems *PetscOption
 {
   PetscBool      flg,flg2,op,orth;
   PetscInt       opi,opi0;
+  PetscReal      opf;
 
   PetscFunctionBegin;
   PetscOptionsHeadBegin(PetscOptionsObject,"EPS Generalized Davidson (GD) Options");
@@ -62,6 +63,11 @@ static PetscErrorCode EPSSetFromOptions_GD(EPS eps,PetscOptionItems *PetscOption
     PetscCall(PetscOptionsBool("-eps_gd_double_expansion","Use the doble-expansion variant of GD","EPSGDSetDoubleExpansion",PETSC_FALSE,&op,&flg));
     if (flg) PetscCall(EPSGDSetDoubleExpansion(eps,op));
 
+    PetscCall(EPSGDGetPreconditionerRefresh(eps,&opi,&opf));
+    PetscCall(PetscOptionsInt("-eps_gd_refresh_lag","Rebuild the preconditioner every this number of iterations","EPSGDSetPreconditionerRefresh",opi,&opi,&flg));
+    PetscCall(PetscOptionsReal("-eps_gd_refresh_shift_tol","Rebuild the preconditioner when the shift moves more than this relative amount","EPSGDSetPreconditionerRefresh",opf,&opf,&flg2));
+    if (flg || flg2) PetscCall(EPSGDSetPreconditionerRefresh(eps,opi,opf));
+
   PetscOptionsHeadEnd();
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -86,6 +92,7 @@ static PetscErrorCode EPSView_GD(EPS eps,PetscViewer viewer)
 {
   PetscBool      isascii,opb;
   PetscInt       opi,opi0;
+  PetscReal      opf;
   PetscBool      borth;
   EPS_DAVIDSON   *data = (EPS_DAVIDSON*)eps->data;
 
@@ -104,6 +111,10 @@ static PetscErrorCode EPSView_GD(EPS eps,PetscViewer viewer)
     PetscCall(EPSXDGetRestart_XD(eps,&opi,&opi0));
     PetscCall(PetscViewerASCIIPrintf(viewer,"  size of the subspace after restarting: %" PetscInt_FMT "\n",opi));
     PetscCall(PetscViewerASCIIPrintf(viewer,"  number of vectors after restarting from the previous iteration: %" PetscInt_FMT "\n",opi0));
+    PetscCall(EPSXDGetPreconditionerRefresh_XD(eps,&opi,&opf,NULL));
+    if (opi) PetscCall(PetscViewerASCIIPrintf(viewer,"  preconditioner rebuilt every %" PetscInt_FMT " iterations\n",opi));
+    if (opf>0.0) PetscCall(PetscViewerASCIIPrintf(viewer,"  preconditioner rebuilt when the shift moves more than %g (relative)\n",(double)opf));
+    if (opi || opf>0.0) PetscCall(PetscViewerASCIIPrintf(viewer,"  number of rebuilds of the preconditioner in the last solve: %" PetscInt_FMT "\n",data->pcrefresh));
   }
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -124,6 +135,8 @@ static PetscErrorCode EPSDestroy_GD(EPS eps)
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSGDGetInitialSize_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSGDSetDoubleExpansion_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSGDGetDoubleExpansion_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSGDSetPreconditionerRefresh_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSGDGetPreconditionerRefresh_C",NULL));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -478,6 +491,90 @@ PetscErrorCode EPSGDGetDoubleExpansion(EPS eps,PetscBool *doubleexp)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode EPSGDSetPreconditionerRefresh_GD(EPS eps,PetscInt lag,PetscReal tol)
+{
+  PetscFunctionBegin;
+  PetscCall(EPSXDSetPreconditionerRefresh_XD(eps,lag,tol,PETSC_CURRENT));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSGDSetPreconditionerRefresh - Sets the policy for rebuilding the
+   preconditioner during the iteration.
+
+   Logically Collective
+
+   Input Parameters:
++  eps - the eigenproblem solver context
+.  lag - rebuild the preconditioner every lag iterations
+-  tol - rebuild the preconditioner when the shift moves more than tol (relative)
+
+   Options Database Keys:
++  -eps_gd_refresh_lag - number of iterations between rebuilds
+-  -eps_gd_refresh_shift_tol - relative change of the shift that triggers a rebuild
+
+   Notes:
+   By default, the preconditioner is built once from A-sigma*B, where sigma is
+   the shift of the ST object, and it is kept fixed during the whole iteration.
+   With this policy, the preconditioner is rebuilt from A-theta*B, where theta
+   is the current approximation of the wanted eigenvalue, whenever lag iterations
+   have passed since the last rebuild, or whenever theta differs from the shift of
+   the current preconditioner more than tol in relative terms. A value of zero
+   deactivates the corresponding criterion. PETSC_CURRENT can be used to preserve
+   the current value of any of the arguments, and PETSC_DETERMINE to deactivate it.
+
+   The preconditioner can only be rebuilt if it is obtained from the problem
+   matrices, that is, not when the user has provided a preconditioner matrix
+   with STSetPreconditionerMat().
+
+   The number of rebuilds in the last solve is shown in EPSView().
+
+   Level: advanced
+
+.seealso: EPSGDGetPreconditionerRefresh(), STSetShift()
+@*/
+PetscErrorCode EPSGDSetPreconditionerRefresh(EPS eps,PetscInt lag,PetscReal tol)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscValidLogicalCollectiveInt(eps,lag,2);
+  PetscValidLogicalCollectiveReal(eps,tol,3);
+  PetscTryMethod(eps,"EPSGDSetPreconditionerRefresh_C",(EPS,PetscInt,PetscReal),(eps,lag,tol));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode EPSGDGetPreconditionerRefresh_GD(EPS eps,PetscInt *lag,PetscReal *tol)
+{
+  PetscFunctionBegin;
+  PetscCall(EPSXDGetPreconditionerRefresh_XD(eps,lag,tol,NULL));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSGDGetPreconditionerRefresh - Gets the policy for rebuilding the
+   preconditioner during the iteration.
+
+   Not Collective
+
+   Input Parameter:
+.  eps - the eigenproblem solver context
+
+   Output Parameters:
++  lag - number of iterations between rebuilds
+-  tol - relative change of the shift that triggers a rebuild
+
+   Level: advanced
+
+.seealso: EPSGDSetPreconditionerRefresh()
+@*/
+PetscErrorCode EPSGDGetPreconditionerRefresh(EPS eps,PetscInt *lag,PetscReal *tol)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscUseMethod(eps,"EPSGDGetPreconditionerRefresh_C",(EPS,PetscInt*,PetscReal*),(eps,lag,tol));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 SLEPC_EXTERN PetscErrorCode EPSCreate_GD(EPS eps)
 {
   EPS_DAVIDSON    *data;
@@ -521,5 +618,7 @@ SLEPC_EXTERN PetscErrorCode EPSCreate_GD(EPS eps)
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSGDGetInitialSize_C",EPSXDGetInitialSize_XD));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSGDSetDoubleExpansion_C",EPSGDSetDoubleExpansion_GD));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSGDGetDoubleExpansion_C",EPSGDGetDoubleExpansion_GD));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSGDSetPreconditionerRefresh_C",EPSGDSetPreconditionerRefresh_GD));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSGDGetPreconditionerRefresh_C",EPSGDGetPreconditionerRefresh_GD));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -33,7 +33,7 @@
 
 static PetscErrorCode EPSSetFromOptions_JD(EPS eps,PetscOptionItems *PetscOptionsObject)
 {
-  PetscBool      flg,flg2,op,orth;
+  PetscBool      flg,flg2,flg3,op,orth;
   PetscInt       opi,opi0;
   PetscReal      opf;
 
@@ -69,6 +69,16 @@ static PetscErrorCode EPSSetFromOptions_JD(EPS eps,PetscOptionItems *PetscOption
     PetscCall(PetscOptionsBool("-eps_jd_const_correction_tol","Disable the dynamic stopping criterion when solving the correction equation","EPSJDSetConstCorrectionTol",op,&op,&flg));
     if (flg) PetscCall(EPSJDSetConstCorrectionTol(eps,op));
 
+    PetscCall(EPSJDGetBlockCorrection(eps,&op));
+    PetscCall(PetscOptionsBool("-eps_jd_block_correction","Solve the correction equations of the block at once","EPSJDSetBlockCorrection",op,&op,&flg));
+    if (flg) PetscCall(EPSJDSetBlockCorrection(eps,op));
+
+    PetscCall(EPSJDGetPreconditionerRefresh(eps,&opi,&opf,&opi0));
+    PetscCall(PetscOptionsInt("-eps_jd_refresh_lag","Rebuild the preconditioner every this number of iterations","EPSJDSetPreconditionerRefresh",opi,&opi,&flg));
+    PetscCall(PetscOptionsReal("-eps_jd_refresh_shift_tol","Rebuild the preconditioner when the shift moves more than this relative amount","EPSJDSetPreconditionerRefresh",opf,&opf,&flg2));
+    PetscCall(PetscOptionsInt("-eps_jd_refresh_its","Rebuild the preconditioner when the correction equation needs more than this number of iterations","EPSJDSetPreconditionerRefresh",opi0,&opi0,&flg3));
+    if (flg || flg2 || flg3) PetscCall(EPSJDSetPreconditionerRefresh(eps,opi,opf,opi0));
+
   PetscOptionsHeadEnd();
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -111,6 +121,7 @@ static PetscErrorCode EPSView_JD(EPS eps,PetscViewer viewer)
   PetscBool      isascii,opb;
   PetscReal      opf;
   PetscInt       opi,opi0;
+  EPS_DAVIDSON   *data = (EPS_DAVIDSON*)eps->data;
 
   PetscFunctionBegin;
   PetscCall(PetscObjectTypeCompare((PetscObject)viewer,PETSCVIEWERASCII,&isascii));
@@ -132,6 +143,13 @@ static PetscErrorCode EPSView_JD(EPS eps,PetscViewer viewer)
 
     PetscCall(EPSJDGetConstCorrectionTol_JD(eps,&opb));
     if (!opb) PetscCall(PetscViewerASCIIPrintf(viewer,"  using dynamic tolerance for the correction equation\n"));
+    if (data->blockcorr) PetscCall(PetscViewerASCIIPrintf(viewer,"  solving the correction equations of the block at once\n"));
+
+    PetscCall(EPSXDGetPreconditionerRefresh_XD(eps,&opi,&opf,&opi0));
+    if (opi) PetscCall(PetscViewerASCIIPrintf(viewer,"  preconditioner rebuilt every %" PetscInt_FMT " iterations\n",opi));
+    if (opf>0.0) PetscCall(PetscViewerASCIIPrintf(viewer,"  preconditioner rebuilt when the shift moves more than %g (relative)\n",(double)opf));
+    if (opi0) PetscCall(PetscViewerASCIIPrintf(viewer,"  preconditioner rebuilt when the correction equation needs more than %" PetscInt_FMT " iterations\n",opi0));
+    if (opi || opf>0.0 || opi0) PetscCall(PetscViewerASCIIPrintf(viewer,"  number of rebuilds of the preconditioner in the last solve: %" PetscInt_FMT "\n",data->pcrefresh));
   }
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -154,6 +172,10 @@ static PetscErrorCode EPSDestroy_JD(EPS eps)
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSJDGetConstCorrectionTol_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSJDSetBOrth_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSJDGetBOrth_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSJDSetPreconditionerRefresh_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSJDGetPreconditionerRefresh_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSJDSetBlockCorrection_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSJDGetBlockCorrection_C",NULL));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -590,6 +612,167 @@ PetscErrorCode EPSJDGetBOrth(EPS eps,PetscBool *borth)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*@
+   EPSJDSetPreconditionerRefresh - Sets the policy for rebuilding the
+   preconditioner during the iteration.
+
+   Logically Collective
+
+   Input Parameters:
++  eps - the eigenproblem solver context
+.  lag - rebuild the preconditioner every lag iterations
+.  tol - rebuild the preconditioner when the shift moves more than tol (relative)
+-  its - rebuild the preconditioner when the correction equation needs more than its iterations
+
+   Options Database Keys:
++  -eps_jd_refresh_lag - number of iterations between rebuilds
+.  -eps_jd_refresh_shift_tol - relative change of the shift that triggers a rebuild
+-  -eps_jd_refresh_its - number of iterations of the correction equation that triggers a rebuild
+
+   Notes:
+   By default, the preconditioner is built once from A-sigma*B, where sigma is
+   the shift of the ST object, and it is kept fixed during the whole iteration.
+   With this policy, the preconditioner is rebuilt from A-theta*B, where theta
+   is the current approximation of the wanted eigenvalue, whenever lag iterations
+   have passed since the last rebuild, whenever theta differs from the shift of
+   the current preconditioner more than tol in relative terms, or whenever the
+   last correction equation required more than its iterations of the KSP solver.
+   A value of zero deactivates the corresponding criterion. PETSC_CURRENT can be
+   used to preserve the current value of any of the arguments, and PETSC_DETERMINE
+   to deactivate it.
+
+   The preconditioner can only be rebuilt if it is obtained from the problem
+   matrices, that is, not when the user has provided a preconditioner matrix
+   with STSetPreconditionerMat().
+
+   The number of rebuilds in the last solve is shown in EPSView().
+
+   Level: advanced
+
+.seealso: EPSJDGetPreconditionerRefresh(), STSetShift()
+@*/
+PetscErrorCode EPSJDSetPreconditionerRefresh(EPS eps,PetscInt lag,PetscReal tol,PetscInt its)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscValidLogicalCollectiveInt(eps,lag,2);
+  PetscValidLogicalCollectiveReal(eps,tol,3);
+  PetscValidLogicalCollectiveInt(eps,its,4);
+  PetscTryMethod(eps,"EPSJDSetPreconditionerRefresh_C",(EPS,PetscInt,PetscReal,PetscInt),(eps,lag,tol,its));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSJDGetPreconditionerRefresh - Gets the policy for rebuilding the
+   preconditioner during the iteration.
+
+   Not Collective
+
+   Input Parameter:
+.  eps - the eigenproblem solver context
+
+   Output Parameters:
++  lag - number of iterations between rebuilds
+.  tol - relative change of the shift that triggers a rebuild
+-  its - number of iterations of the correction equation that triggers a rebuild
+
+   Level: advanced
+
+.seealso: EPSJDSetPreconditionerRefresh()
+@*/
+PetscErrorCode EPSJDGetPreconditionerRefresh(EPS eps,PetscInt *lag,PetscReal *tol,PetscInt *its)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscUseMethod(eps,"EPSJDGetPreconditionerRefresh_C",(EPS,PetscInt*,PetscReal*,PetscInt*),(eps,lag,tol,its));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode EPSJDSetBlockCorrection_JD(EPS eps,PetscBool block)
+{
+  EPS_DAVIDSON *data = (EPS_DAVIDSON*)eps->data;
+
+  PetscFunctionBegin;
+  if (data->blockcorr != block) {
+    data->blockcorr = block;
+    eps->state      = EPS_STATE_INITIAL;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSJDSetBlockCorrection - Activates or deactivates solving the correction
+   equations of all the pairs selected in an iteration at once.
+
+   Logically Collective
+
+   Input Parameters:
++  eps   - the eigenproblem solver context
+-  block - whether to solve the correction equations as a block
+
+   Options Database Key:
+.  -eps_jd_block_correction - Solve the correction equations as a block
+
+   Notes:
+   When the block size is larger than one (see EPSJDSetBlockSize()), by default
+   the correction equation of each selected pair is solved with a separate call
+   to KSPSolve(). In block mode, all of them are solved with a single call to
+   KSPMatSolve(), where each column has its own shift and projector, so that the
+   coefficient matrix and the preconditioner are applied to all the columns at
+   once with matrix-matrix products and PCMatApply(). This is especially effective
+   with a block Krylov method such as KSPHPDDM; other KSP types solve the columns
+   one after the other.
+
+   The block mode is not available in real arithmetic for non-Hermitian problems,
+   where the pairs of complex conjugate eigenvalues require a different treatment.
+
+   Level: advanced
+
+.seealso: EPSJDGetBlockCorrection(), EPSJDSetBlockSize()
+@*/
+PetscErrorCode EPSJDSetBlockCorrection(EPS eps,PetscBool block)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscValidLogicalCollectiveBool(eps,block,2);
+  PetscTryMethod(eps,"EPSJDSetBlockCorrection_C",(EPS,PetscBool),(eps,block));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode EPSJDGetBlockCorrection_JD(EPS eps,PetscBool *block)
+{
+  EPS_DAVIDSON *data = (EPS_DAVIDSON*)eps->data;
+
+  PetscFunctionBegin;
+  *block = data->blockcorr;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSJDGetBlockCorrection - Returns a flag indicating if the correction equations
+   are solved as a block.
+
+   Not Collective
+
+   Input Parameter:
+.  eps - the eigenproblem solver context
+
+   Output Parameter:
+.  block - the flag
+
+   Level: advanced
+
+.seealso: EPSJDSetBlockCorrection()
+@*/
+PetscErrorCode EPSJDGetBlockCorrection(EPS eps,PetscBool *block)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscAssertPointer(block,2);
+  PetscUseMethod(eps,"EPSJDGetBlockCorrection_C",(EPS,PetscBool*),(eps,block));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 SLEPC_EXTERN PetscErrorCode EPSCreate_JD(EPS eps)
 {
   EPS_DAVIDSON   *data;
@@ -635,5 +818,9 @@ SLEPC_EXTERN PetscErrorCode EPSCreate_JD(EPS eps)
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSJDGetConstCorrectionTol_C",EPSJDGetConstCorrectionTol_JD));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSJDSetBOrth_C",EPSXDSetBOrth_XD));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSJDGetBOrth_C",EPSXDGetBOrth_XD));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSJDSetPreconditionerRefresh_C",EPSXDSetPreconditionerRefresh_XD));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSJDGetPreconditionerRefresh_C",EPSXDGetPreconditionerRefresh_XD));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSJDSetBlockCorrection_C",EPSJDSetBlockCorrection_JD));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSJDGetBlockCorrection_C",EPSJDGetBlockCorrection_JD));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -187,6 +187,33 @@ static PetscErrorCode EPSKrylovConvergence_Filter(EPS eps,PetscBool getall,Petsc
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   EPSKrylovNormEstimate - Raises the estimate of the norm of A to the largest
+   magnitude of the first n Ritz values, a lower bound of the 2-norm that improves
+   as the Krylov subspace grows (the value is never decreased, so the estimate
+   computed with MatNormEstimate() in the setup is kept if it is larger)
+*/
+static PetscErrorCode EPSKrylovNormEstimate(EPS eps,PetscInt n)
+{
+  PetscInt    k;
+  PetscScalar re,im;
+  PetscReal   nrm=0.0;
+
+  PetscFunctionBegin;
+  for (k=0;k<n;k++) {
+    re = eps->eigr[k];
+    im = eps->eigi[k];
+    PetscCall(STBackTransform(eps->st,1,&re,&im));
+    nrm = PetscMax(nrm,SlepcAbsEigenvalue(re,im));
+  }
+  if (nrm==0.0) PetscFunctionReturn(PETSC_SUCCESS);
+  if (nrm<=eps->nrma) PetscFunctionReturn(PETSC_SUCCESS);
+  PetscCall(PetscInfo(eps,"Norm of A estimated from the Ritz values: %g\n",(double)nrm));
+  eps->nrma    = nrm;
+  eps->nrmritz = PETSC_TRUE;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*
    EPSKrylovConvergence - Implements the loop that checks for convergence
    in Krylov methods.
@@ -236,6 +263,7 @@ PetscErrorCode EPSKrylovConvergence(EPS eps,PetscBool getall,PetscInt kini,Petsc
   PetscCall(DSGetLeadingDimension(eps->ds,&ld));
   PetscCall(DSGetRefined(eps->ds,&refined));
   PetscCall(PetscObjectTypeCompare((PetscObject)eps->st,STSHIFT,&isshift));
+  if (eps->nrmest && eps->conv==EPS_CONV_NORM && isshift && !eps->isgeneralized && eps->extraction==EPS_RITZ) PetscCall(EPSKrylovNormEstimate(eps,kini+nits));
   marker = -1;
   if (eps->trackall) getall = PETSC_TRUE;
   for (k=kini;k<kini+nits;k++) {
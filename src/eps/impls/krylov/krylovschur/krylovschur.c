@@ -30,6 +30,7 @@
 */
 
 #include <slepc/private/epsimpl.h>                /*I "slepceps.h" I*/
+#include <slepc/private/stimpl.h>
 #include "krylovschur.h"
 
 PetscErrorCode EPSGetArbitraryValues(EPS eps,PetscScalar *rr,PetscScalar *ri)
@@ -93,7 +94,9 @@ static PetscErrorCode EPSSetUp_KrylovSchur_Filter(EPS eps)
 static PetscErrorCode EPSSetUp_KrylovSchur(EPS eps)
 {
   PetscReal         eta;
-  PetscBool         isfilt=PETSC_FALSE;
+  PetscBool         isfilt=PETSC_FALSE,isshift;
+  PetscInt          m,n,ml,nl;
+  Mat               A;
   BVOrthogType      otype;
   BVOrthogBlockType obtype;
   EPS_KRYLOVSCHUR   *ctx = (EPS_KRYLOVSCHUR*)eps->data;
@@ -120,6 +123,13 @@ static PetscErrorCode EPSSetUp_KrylovSchur(EPS eps)
   PetscCheck(eps->extraction==EPS_RITZ || eps->extraction==EPS_HARMONIC,PetscObjectComm((PetscObject)eps),PETSC_ERR_SUP,"Unsupported extraction type");
 
   if (!ctx->keep) ctx->keep = 0.5;
+  ctx->akeep = ctx->keep;
+  ctx->rho   = 0.0;
+  if (ctx->adaptive && !eps->nds && eps->which!=EPS_ALL) {  /* V cannot be resized if it has constraints */
+    if (ctx->maxncv!=PETSC_DETERMINE) ctx->ncvcap = ctx->maxncv;
+    else if (!ctx->ncvcap) ctx->ncvcap = 2*eps->ncv;
+    ctx->ncvcap = PetscMax(PetscMin(ctx->ncvcap,eps->n),eps->ncv);
+  } else ctx->ncvcap = eps->ncv;
 
   PetscCall(EPSAllocateSolution(eps,1));
   PetscCall(EPS_SetInnerProduct(eps));
@@ -155,7 +165,7 @@ static PetscErrorCode EPSSetUp_KrylovSchur(EPS eps)
       eps->ops->computevectors = EPSComputeVectors_Schur;
       PetscCall(DSSetType(eps->ds,DSNHEP));
       PetscCall(DSSetExtraRow(eps->ds,PETSC_TRUE));
-      PetscCall(DSAllocate(eps->ds,eps->ncv+1));
+      PetscCall(DSAllocate(eps->ds,ctx->ncvcap+1));
       break;
     case EPS_KS_SYMM:
     case EPS_KS_FILTER:
@@ -164,7 +174,7 @@ static PetscErrorCode EPSSetUp_KrylovSchur(EPS eps)
       PetscCall(DSSetType(eps->ds,DSHEP));
       PetscCall(DSSetCompact(eps->ds,PETSC_TRUE));
       PetscCall(DSSetExtraRow(eps->ds,PETSC_TRUE));
-      PetscCall(DSAllocate(eps->ds,eps->ncv+1));
+      PetscCall(DSAllocate(eps->ds,ctx->ncvcap+1));
       break;
     case EPS_KS_SLICE:
       eps->ops->solve = EPSSolve_KrylovSchur_Slice;
@@ -190,6 +200,21 @@ static PetscErrorCode EPSSetUp_KrylovSchur(EPS eps)
       break;
     default: SETERRQ(PetscObjectComm((PetscObject)eps),PETSC_ERR_PLIB,"Unexpected error");
   }
+
+  if (ctx->mixed) {
+    PetscCheck(variant==EPS_KS_DEFAULT || variant==EPS_KS_SYMM,PetscObjectComm((PetscObject)eps),PETSC_ERR_SUP,"Mixed precision is only available in the default variant of Krylov-Schur");
+    EPSCheckStandardCondition(eps,PETSC_TRUE," with mixed precision");
+    EPSCheckUnsupportedCondition(eps,EPS_FEATURE_ARBITRARY | EPS_FEATURE_EXTRACTION,PETSC_TRUE," with mixed precision");
+    PetscCall(PetscObjectTypeCompare((PetscObject)eps->st,STSHIFT,&isshift));
+    PetscCheck(isshift,PetscObjectComm((PetscObject)eps),PETSC_ERR_SUP,"Mixed precision requires STSHIFT");
+    if (ctx->Alow) {
+      PetscCall(STGetMatrix(eps->st,0,&A));
+      PetscCall(MatGetLocalSize(A,&m,&n));
+      PetscCall(MatGetLocalSize(ctx->Alow,&ml,&nl));
+      PetscCheck(m==ml && n==nl,PetscObjectComm((PetscObject)eps),PETSC_ERR_ARG_INCOMP,"The companion matrix must have the same local sizes as A");
+    }
+    eps->ops->solve = EPSSolve_KrylovSchur_MixedPrecision;
+  }
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -224,14 +249,209 @@ static PetscErrorCode EPSSetUpSort_KrylovSchur(EPS eps)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   EPSKrylovSchurRecycle - Rayleigh-Ritz projection onto the nrec vectors recycled
+   from the previous solve, which EPSSetUp() has placed in the leading columns of V.
+   The leading Ritz pairs that already satisfy the convergence criterion are locked
+   (if locking is active), and the start vector of the Krylov decomposition is taken
+   as the sum of the remaining wanted Ritz vectors.
+*/
+static PetscErrorCode EPSKrylovSchurRecycle(EPS eps,PetscBool hermitian)
+{
+  EPS_KRYLOVSCHUR *ctx = (EPS_KRYLOVSCHUR*)eps->data;
+  PetscInt        i,j,k=eps->nrec,k0=0,nw,ld,ldh;
+  DS              ds;
+  SlepcSC         sc,sc0;
+  BV              AV;
+  Mat             Op,H,Q;
+  Vec             w;
+  PetscReal       *rsd,*T;
+  PetscScalar     *pH,*pA,*q;
+
+  PetscFunctionBegin;
+  /* projected matrix H = V'*Op*V, sorted with the same criterion as eps->ds */
+  PetscCall(DSCreate(PetscObjectComm((PetscObject)eps),&ds));
+  PetscCall(DSSetType(ds,hermitian?DSHEP:DSNHEP));
+  PetscCall(DSAllocate(ds,k));
+  PetscCall(DSSetDimensions(ds,k,0,0));
+  PetscCall(DSGetSlepcSC(eps->ds,&sc0));
+  PetscCall(DSGetSlepcSC(ds,&sc));
+  *sc = *sc0;
+  PetscCall(BVDuplicateResize(eps->V,k,&AV));
+  PetscCall(BVSetActiveColumns(eps->V,0,k));
+  PetscCall(STGetOperator(eps->st,&Op));
+  PetscCall(BVMatMult(eps->V,Op,AV));
+  PetscCall(STRestoreOperator(eps->st,&Op));
+  PetscCall(DSGetMat(ds,DS_MAT_A,&H));
+  PetscCall(BVDot(AV,eps->V,H));
+  PetscCall(DSRestoreMat(ds,DS_MAT_A,&H));
+  PetscCall(DSSetState(ds,DS_STATE_RAW));
+  PetscCall(DSSolve(ds,eps->eigr,eps->eigi));
+  PetscCall(DSSort(ds,eps->eigr,eps->eigi,NULL,NULL,NULL));
+  PetscCall(DSSynchronize(ds,eps->eigr,eps->eigi));
+  PetscCall(DSGetMat(ds,DS_MAT_Q,&Q));
+  PetscCall(BVMultInPlace(eps->V,Q,0,k));
+  PetscCall(BVMultInPlace(AV,Q,0,k));
+  PetscCall(DSRestoreMat(ds,DS_MAT_Q,&Q));
+
+  /* residual norms of the Schur vectors, Op*V-V*T */
+  PetscCall(PetscMalloc1(k,&rsd));
+  PetscCall(DSGetMat(ds,DS_MAT_A,&H));
+  PetscCall(BVMult(AV,-1.0,1.0,eps->V,H));
+  PetscCall(DSRestoreMat(ds,DS_MAT_A,&H));
+  for (i=0;i<k;i++) PetscCall(BVNormColumn(AV,i,NORM_2,rsd+i));
+
+  /* lock the leading converged pairs, without splitting complex conjugate pairs */
+  nw = PetscMin(k,eps->nev);
+  while (ctx->lock && k0<nw) {
+    j = (eps->eigi[k0]!=0.0 && k0<k-1)? 2: 1;
+    if (k0+j>=eps->ncv) break;
+    PetscCall((*eps->converged)(eps,eps->eigr[k0],eps->eigi[k0],(j==2)?SlepcAbs(rsd[k0],rsd[k0+1]):rsd[k0],&eps->errest[k0],eps->convergedctx));
+    if (eps->errest[k0]>=eps->tol) break;
+    if (j==2) eps->errest[k0+1] = eps->errest[k0];
+    k0 += j;
+  }
+  if (k0) {
+    PetscCall(DSGetLeadingDimension(eps->ds,&ld));
+    if (hermitian) {
+      PetscCall(DSGetArrayReal(eps->ds,DS_MAT_T,&T));
+      for (i=0;i<k0;i++) {
+        T[i]    = PetscRealPart(eps->eigr[i]);
+        T[i+ld] = 0.0;
+      }
+      PetscCall(DSRestoreArrayReal(eps->ds,DS_MAT_T,&T));
+    } else {
+      PetscCall(DSGetLeadingDimension(ds,&ldh));
+      PetscCall(DSGetArray(ds,DS_MAT_A,&pH));
+      PetscCall(DSGetArray(eps->ds,DS_MAT_A,&pA));
+      for (j=0;j<k0;j++) for (i=0;i<k0;i++) pA[i+j*ld] = pH[i+j*ldh];
+      PetscCall(DSRestoreArray(eps->ds,DS_MAT_A,&pA));
+      PetscCall(DSRestoreArray(ds,DS_MAT_A,&pH));
+    }
+    PetscCall(PetscInfo(eps,"Locking %" PetscInt_FMT " recycled eigenpairs\n",k0));
+  }
+  eps->nconv = k0;
+
+  /* start vector: sum of the wanted Ritz vectors that have not been locked */
+  if (k0<nw) {
+    PetscCall(BVCreateVec(eps->V,&w));
+    PetscCall(PetscMalloc1(nw-k0,&q));
+    for (i=0;i<nw-k0;i++) q[i] = 1.0;
+    PetscCall(BVSetActiveColumns(eps->V,k0,nw));
+    PetscCall(BVMultVec(eps->V,1.0,0.0,w,q));
+    PetscCall(BVInsertVec(eps->V,k0,w));
+    PetscCall(BVOrthonormalizeColumn(eps->V,k0,PETSC_TRUE,NULL,NULL));
+    PetscCall(PetscFree(q));
+    PetscCall(VecDestroy(&w));
+  } else PetscCall(EPSGetStartVector(eps,k0,NULL));
+
+  PetscCall(PetscFree(rsd));
+  PetscCall(BVDestroy(&AV));
+  PetscCall(DSDestroy(&ds));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   EPSKrylovSchurLogTimes - Cumulative time spent in the application of the operator
+   and in orthogonalization, taken from the log events (zero if logging is not active)
+*/
+static PetscErrorCode EPSKrylovSchurLogTimes(PetscLogDouble *top,PetscLogDouble *torth)
+{
+#if defined(PETSC_USE_LOG)
+  PetscBool          active;
+  PetscEventPerfInfo info;
+#endif
+
+  PetscFunctionBegin;
+  *top = *torth = 0.0;
+#if defined(PETSC_USE_LOG)
+  PetscCall(PetscLogIsActive(&active));
+  if (active) {
+    PetscCall(PetscLogEventGetPerfInfo(PETSC_DETERMINE,ST_Apply,&info));
+    *top = info.time;
+    PetscCall(PetscLogEventGetPerfInfo(PETSC_DETERMINE,BV_OrthogonalizeVec,&info));
+    *torth = info.time;
+  }
+#endif
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   EPSKrylovSchurAdaptRestart - Adaptive policy for the restart parameter and ncv, invoked
+   after each Krylov expansion with the number of converged pairs k (kprev in the previous
+   restart), the error estimate of the first unconverged pair (errprev in the previous
+   restart), and the time spent in the operator and in orthogonalization in the expansion.
+
+   The reduction of the error estimate per restart is smoothed in ctx->rho. If
+   orthogonalization is more expensive than the operator, the proportion of kept vectors
+   is decreased, so that new vectors are orthogonalized against fewer columns. Otherwise,
+   if convergence is slow, more vectors are kept to retain more spectral information, and
+   once the restart parameter reaches its maximum, ncv is increased (up to ctx->ncvcap).
+*/
+static PetscErrorCode EPSKrylovSchurAdaptRestart(EPS eps,PetscInt k,PetscInt kprev,PetscReal err,PetscReal errprev,PetscLogDouble top,PetscLogDouble torth,PetscBool *grow)
+{
+  EPS_KRYLOVSCHUR *ctx = (EPS_KRYLOVSCHUR*)eps->data;
+  PetscReal       r;
+
+  PetscFunctionBegin;
+  *grow = PETSC_FALSE;
+  if (k>kprev || errprev==0.0) PetscFunctionReturn(PETSC_SUCCESS);  /* progress in the number of converged pairs */
+  r = PetscMin(err/errprev,1.0);
+  ctx->rho = (ctx->rho==0.0)? r: 0.5*(ctx->rho+r);
+  if (top>0.0 && torth>top) ctx->akeep = PetscMax(ctx->akeep-0.1,0.1);
+  else if (ctx->rho>0.5) {
+    if (ctx->akeep<0.9-PETSC_SMALL) ctx->akeep = PetscMin(ctx->akeep+0.1,0.9);
+    else if (eps->ncv<ctx->ncvcap) *grow = PETSC_TRUE;
+  }
+  PetscCall(PetscInfo(eps,"Adaptive restart: reduction factor %g, time ratio orthogonalization/operator %g, keep=%g\n",(double)ctx->rho,(double)(top>0.0?torth/top:0.0),(double)ctx->akeep));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   EPSKrylovSchurGrowBasis - Increases ncv by 25% (up to ctx->ncvcap), keeping the current
+   content of V and the computed eigenvalues. The DS has been allocated for ctx->ncvcap.
+*/
+static PetscErrorCode EPSKrylovSchurGrowBasis(EPS eps)
+{
+  EPS_KRYLOVSCHUR *ctx = (EPS_KRYLOVSCHUR*)eps->data;
+  PetscInt        ncv,n=eps->ncv+1,*perm;
+  PetscScalar     *eigr,*eigi,*rr,*ri;
+  PetscReal       *errest;
+
+  PetscFunctionBegin;
+  ncv = PetscMin(ctx->ncvcap,eps->ncv+PetscMax(1,eps->ncv/4));
+  PetscCall(BVResize(eps->V,ncv+1,PETSC_TRUE));
+  PetscCall(PetscMalloc4(ncv+1,&eigr,ncv+1,&eigi,ncv+1,&errest,ncv+1,&perm));
+  PetscCall(PetscArraycpy(eigr,eps->eigr,n));
+  PetscCall(PetscArraycpy(eigi,eps->eigi,n));
+  PetscCall(PetscArraycpy(errest,eps->errest,n));
+  PetscCall(PetscFree4(eps->eigr,eps->eigi,eps->errest,eps->perm));
+  eps->eigr   = eigr;
+  eps->eigi   = eigi;
+  eps->errest = errest;
+  eps->perm   = perm;
+  if (eps->arbitrary) {
+    PetscCall(PetscMalloc2(ncv+1,&rr,ncv+1,&ri));
+    PetscCall(PetscFree2(eps->rr,eps->ri));
+    eps->rr = rr;
+    eps->ri = ri;
+  }
+  PetscCall(PetscInfo(eps,"Adaptive restart: increasing ncv from %" PetscInt_FMT " to %" PetscInt_FMT "\n",eps->ncv,ncv));
+  if (eps->mpd>=eps->ncv) eps->mpd = ncv;
+  else eps->mpd = PetscMax(eps->mpd,ncv-eps->nev);  /* keep ncv<=nev+mpd */
+  eps->ncv = ncv;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 PetscErrorCode EPSSolve_KrylovSchur_Default(EPS eps)
 {
   EPS_KRYLOVSCHUR *ctx = (EPS_KRYLOVSCHUR*)eps->data;
-  PetscInt        j,*pj,k,l,nv,ld,nconv;
+  PetscInt        j,*pj,k,l,nv,ld,nconv,kprev=0;
   Mat             U,Op,H,T;
   PetscScalar     *g;
-  PetscReal       beta,gamma=1.0;
-  PetscBool       breakdown,harmonic,hermitian;
+  PetscReal       beta,gamma=1.0,errprev=0.0;
+  PetscBool       breakdown,harmonic,hermitian,adaptive,grow=PETSC_FALSE;
+  PetscLogDouble  top0=0.0,torth0=0.0,top,torth;
 
   PetscFunctionBegin;
   PetscCall(DSGetLeadingDimension(eps->ds,&ld));
@@ -240,9 +460,11 @@ PetscErrorCode EPSSolve_KrylovSchur_Default(EPS eps)
   if (harmonic) PetscCall(PetscMalloc1(ld,&g));
   if (eps->arbitrary) pj = &j;
   else pj = NULL;
+  adaptive = (ctx->adaptive && eps->which!=EPS_ALL)? PETSC_TRUE: PETSC_FALSE;
 
   /* Get the starting Arnoldi vector */
-  PetscCall(EPSGetStartVector(eps,0,NULL));
+  if (eps->nrec && !harmonic && !eps->arbitrary) PetscCall(EPSKrylovSchurRecycle(eps,hermitian));
+  else PetscCall(EPSGetStartVector(eps,0,NULL));
   l = 0;
 
   /* Restart loop */
@@ -252,6 +474,7 @@ PetscErrorCode EPSSolve_KrylovSchur_Default(EPS eps)
     /* Compute an nv-step Arnoldi factorization */
     nv = PetscMin(eps->nconv+eps->mpd,eps->ncv);
     PetscCall(DSSetDimensions(eps->ds,nv,eps->nconv,eps->nconv+l));
+    if (adaptive) PetscCall(EPSKrylovSchurLogTimes(&top0,&torth0));
     PetscCall(STGetOperator(eps->st,&Op));
     if (hermitian) {
       PetscCall(DSGetMat(eps->ds,DS_MAT_T,&T));
@@ -285,14 +508,28 @@ PetscErrorCode EPSSolve_KrylovSchur_Default(EPS eps)
     PetscCall((*eps->stopping)(eps,eps->its,eps->max_it,k,eps->nev,&eps->reason,eps->stoppingctx));
     nconv = k;
 
+    /* Adapt the restart parameter and ncv */
+    if (adaptive && eps->reason == EPS_CONVERGED_ITERATING && k<nv) {
+      PetscCall(EPSKrylovSchurLogTimes(&top,&torth));
+      PetscCall(EPSKrylovSchurAdaptRestart(eps,k,kprev,eps->errest[k],errprev,top-top0,torth-torth0,&grow));
+      kprev   = k;
+      errprev = eps->errest[k];
+    }
+
     /* Update l */
     if (eps->reason != EPS_CONVERGED_ITERATING || breakdown || k==nv) l = 0;
     else {
-      l = PetscMax(1,(PetscInt)((nv-k)*ctx->keep));
+      l = PetscMax(1,(PetscInt)((nv-k)*ctx->akeep));
       if (!hermitian) PetscCall(DSGetTruncateSize(eps->ds,k,nv,&l));
     }
     if (!ctx->lock && l>0) { l += k; k = 0; } /* non-locking variant: reset no. of converged pairs */
     if (l) PetscCall(PetscInfo(eps,"Preparing to restart keeping l=%" PetscInt_FMT " vectors\n",l));
+    if (eps->recycle && eps->reason != EPS_CONVERGED_ITERATING && !breakdown && k<nv) {
+      /* compute also the restart vectors, to be recycled in the next solve */
+      l = PetscMax(1,(PetscInt)((nv-k)*ctx->akeep));
+      if (!hermitian) PetscCall(DSGetTruncateSize(eps->ds,k,nv,&l));
+      eps->nrest = l;
+    }
 
     if (eps->reason == EPS_CONVERGED_ITERATING) {
       if (PetscUnlikely(breakdown || k==nv)) {
@@ -329,6 +566,8 @@ PetscErrorCode EPSSolve_KrylovSchur_Default(EPS eps)
     if (eps->reason == EPS_CONVERGED_ITERATING && !breakdown) PetscCall(BVCopyColumn(eps->V,nv,k+l));
     eps->nconv = k;
     PetscCall(EPSMonitor(eps,eps->its,nconv,eps->eigr,eps->eigi,eps->errest,nv));
+    if (grow && eps->reason == EPS_CONVERGED_ITERATING) PetscCall(EPSKrylovSchurGrowBasis(eps));
+    grow = PETSC_FALSE;
   }
 
   if (harmonic) PetscCall(PetscFree(g));
@@ -336,6 +575,94 @@ PetscErrorCode EPSSolve_KrylovSchur_Default(EPS eps)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   EPSSolve_KrylovSchur_MixedPrecision - Two-stage solve. In the first stage, the
+   Krylov-Schur iteration is run on the companion matrix (e.g., a matrix that stores
+   its values in lower precision) with a relaxed tolerance. Then the iteration is run
+   in working precision with the original matrix, starting from a Rayleigh-Ritz
+   projection onto the invariant subspace computed in the first stage, so that the
+   pairs that are already accurate enough are locked from the beginning.
+*/
+PetscErrorCode EPSSolve_KrylovSchur_MixedPrecision(EPS eps)
+{
+  EPS_KRYLOVSCHUR *ctx = (EPS_KRYLOVSCHUR*)eps->data;
+  PetscInt        i,j,k;
+  PetscScalar     sigma;
+  PetscBool       lindep;
+  const char      *prefix;
+  ST              st;
+  BV              V;
+  Vec             *IS;
+
+  PetscFunctionBegin;
+  ctx->itsmp = 0;
+  if (!ctx->Alow) {  /* a first stage with A itself would only repeat the work */
+    PetscCall(PetscInfo(eps,"No companion matrix has been set, skipping the first stage of mixed precision\n"));
+    PetscCall(EPSSolve_KrylovSchur_Default(eps));
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
+  if (eps->nrec) {  /* already warm-started with the subspace of the previous solve */
+    PetscCall(EPSSolve_KrylovSchur_Default(eps));
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
+  if (!ctx->epsmp) {
+    PetscCall(EPSCreate(PetscObjectComm((PetscObject)eps),&ctx->epsmp));
+    PetscCall(PetscObjectIncrementTabLevel((PetscObject)ctx->epsmp,(PetscObject)eps,1));
+    PetscCall(EPSGetOptionsPrefix(eps,&prefix));
+    PetscCall(EPSSetOptionsPrefix(ctx->epsmp,prefix));
+    PetscCall(EPSAppendOptionsPrefix(ctx->epsmp,"mp_"));
+    PetscCall(EPSSetType(ctx->epsmp,EPSKRYLOVSCHUR));
+  }
+
+  /* first stage, with the companion matrix and relaxed tolerance */
+  PetscCall(EPSSetOperators(ctx->epsmp,ctx->Alow,NULL));
+  PetscCall(EPSSetProblemType(ctx->epsmp,eps->problem_type));
+  PetscCall(EPSSetWhichEigenpairs(ctx->epsmp,eps->which));
+  if (eps->which==EPS_WHICH_USER) PetscCall(EPSSetEigenvalueComparison(ctx->epsmp,eps->sc->comparison,eps->sc->comparisonctx));
+  else if (eps->which>=EPS_TARGET_MAGNITUDE && eps->which<=EPS_TARGET_IMAGINARY) PetscCall(EPSSetTarget(ctx->epsmp,eps->target));
+  PetscCall(EPSSetDimensions(ctx->epsmp,eps->nev,eps->ncv,eps->mpd));
+  PetscCall(EPSSetTolerances(ctx->epsmp,PetscMax(ctx->mtol,eps->tol),eps->max_it));
+  PetscCall(EPSSetConvergenceTest(ctx->epsmp,eps->conv));
+  PetscCall(EPSGetST(ctx->epsmp,&st));
+  PetscCall(STSetType(st,STSHIFT));
+  PetscCall(STGetShift(eps->st,&sigma));
+  PetscCall(STSetShift(st,sigma));
+  PetscCall(EPSKrylovSchurSetRestart(ctx->epsmp,ctx->keep));
+  PetscCall(EPSKrylovSchurSetLocking(ctx->epsmp,ctx->lock));
+  if (eps->nini>0) {  /* pass the initial space, which EPSSetUp() left in V */
+    PetscCall(PetscMalloc1(eps->nini,&IS));
+    for (i=0;i<eps->nini;i++) {
+      PetscCall(BVCreateVec(eps->V,IS+i));
+      PetscCall(BVCopyVec(eps->V,i,IS[i]));
+    }
+    PetscCall(EPSSetInitialSpace(ctx->epsmp,eps->nini,IS));
+    PetscCall(VecDestroyVecs(eps->nini,&IS));
+  }
+  PetscCall(EPSSetFromOptions(ctx->epsmp));
+  PetscCall(EPSSolve(ctx->epsmp));
+  PetscCall(EPSGetIterationNumber(ctx->epsmp,&ctx->itsmp));
+  PetscCall(EPSGetConverged(ctx->epsmp,&k));
+  PetscCall(PetscInfo(eps,"First stage of mixed precision: %" PetscInt_FMT " eigenpairs converged in %" PetscInt_FMT " iterations\n",k,ctx->itsmp));
+
+  /* second stage, warm-started with the invariant subspace of the first stage */
+  k = PetscMin(k,eps->ncv);
+  if (k) {
+    PetscCall(EPSGetBV(ctx->epsmp,&V));
+    PetscCall(BVSetActiveColumns(V,0,k));
+    PetscCall(BVSetActiveColumns(eps->V,0,k));
+    PetscCall(BVCopy(V,eps->V));
+    for (i=j=0;i<k;i++) {
+      if (j<i) PetscCall(BVCopyColumn(eps->V,i,j));
+      PetscCall(BVOrthonormalizeColumn(eps->V,j,PETSC_FALSE,NULL,&lindep));
+      if (!lindep) j++;
+    }
+    eps->nrec = j;
+  }
+  PetscCall(EPSSolve_KrylovSchur_Default(eps));
+  eps->nrec = 0;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode EPSKrylovSchurSetRestart_KrylovSchur(EPS eps,PetscReal keep)
 {
   EPS_KRYLOVSCHUR *ctx = (EPS_KRYLOVSCHUR*)eps->data;
@@ -413,6 +740,292 @@ PetscErrorCode EPSKrylovSchurGetRestart(EPS eps,PetscReal *keep)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode EPSKrylovSchurSetAdaptiveRestart_KrylovSchur(EPS eps,PetscBool adaptive,PetscInt maxncv)
+{
+  EPS_KRYLOVSCHUR *ctx = (EPS_KRYLOVSCHUR*)eps->data;
+
+  PetscFunctionBegin;
+  if (maxncv == PETSC_DETERMINE || maxncv == PETSC_DECIDE) maxncv = PETSC_DETERMINE;
+  else if (maxncv == PETSC_CURRENT) maxncv = ctx->maxncv;
+  else PetscCheck(maxncv>0,PetscObjectComm((PetscObject)eps),PETSC_ERR_ARG_OUTOFRANGE,"Illegal value of maxncv. Must be > 0");
+  if (ctx->adaptive != adaptive || ctx->maxncv != maxncv) {
+    ctx->adaptive = adaptive;
+    ctx->maxncv   = maxncv;
+    ctx->ncvcap   = 0;
+    eps->state    = EPS_STATE_INITIAL;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSKrylovSchurSetAdaptiveRestart - Activates an adaptive policy for the restart
+   parameter and the number of basis vectors in the Krylov-Schur method.
+
+   Logically Collective
+
+   Input Parameters:
++  eps      - the eigenproblem solver context
+.  adaptive - whether the restart is adaptive or not
+-  maxncv   - maximum number of basis vectors that can be used
+
+   Options Database Keys:
++  -eps_krylovschur_adaptive_restart - Activates the adaptive restart
+-  -eps_krylovschur_adaptive_maxncv <maxncv> - Sets the maximum number of basis vectors
+
+   Notes:
+   The best values of the restart parameter (see EPSKrylovSchurSetRestart()) and
+   of ncv depend on the distribution of the eigenvalues, which is discovered during
+   the iteration. With the adaptive policy, the proportion of vectors kept at restart
+   is updated after each restart according to the reduction of the residual of the
+   first unconverged eigenpair, and the time spent in orthogonalization relative to
+   the application of the operator (only when logging is active, e.g., with -log_view).
+   If convergence is slow and the restart parameter has reached its maximum value,
+   ncv is increased up to maxncv. The value set with EPSKrylovSchurSetRestart() is
+   used as the initial value.
+
+   Use PETSC_DETERMINE for maxncv to set it to twice the value of ncv at setup,
+   or PETSC_CURRENT to leave it unchanged. The value of ncv (and mpd, if it was not
+   smaller than ncv) reached in EPSSolve() is kept for subsequent solves, so the
+   final values can be checked with EPSGetDimensions() or EPSView().
+
+   Currently, the adaptive policy is only used in the default variant of Krylov-Schur,
+   that is, not in spectrum slicing, two-sided, indefinite or structured problems.
+   The number of basis vectors is not increased if a deflation space has been set.
+
+   Level: advanced
+
+.seealso: EPSKrylovSchurGetAdaptiveRestart(), EPSKrylovSchurSetRestart(), EPSSetDimensions()
+@*/
+PetscErrorCode EPSKrylovSchurSetAdaptiveRestart(EPS eps,PetscBool adaptive,PetscInt maxncv)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscValidLogicalCollectiveBool(eps,adaptive,2);
+  PetscValidLogicalCollectiveInt(eps,maxncv,3);
+  PetscTryMethod(eps,"EPSKrylovSchurSetAdaptiveRestart_C",(EPS,PetscBool,PetscInt),(eps,adaptive,maxncv));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode EPSKrylovSchurGetAdaptiveRestart_KrylovSchur(EPS eps,PetscBool *adaptive,PetscInt *maxncv)
+{
+  EPS_KRYLOVSCHUR *ctx = (EPS_KRYLOVSCHUR*)eps->data;
+
+  PetscFunctionBegin;
+  if (adaptive) *adaptive = ctx->adaptive;
+  if (maxncv) *maxncv = ctx->ncvcap? ctx->ncvcap: ctx->maxncv;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSKrylovSchurGetAdaptiveRestart - Gets the flag indicating whether the adaptive
+   restart policy is used in the Krylov-Schur method, and the maximum number of
+   basis vectors.
+
+   Not Collective
+
+   Input Parameter:
+.  eps - the eigenproblem solver context
+
+   Output Parameters:
++  adaptive - the adaptive flag
+-  maxncv   - the maximum number of basis vectors
+
+   Note:
+   After EPSSetUp(), maxncv contains the actual value used by the solver.
+
+   Level: advanced
+
+.seealso: EPSKrylovSchurSetAdaptiveRestart()
+@*/
+PetscErrorCode EPSKrylovSchurGetAdaptiveRestart(EPS eps,PetscBool *adaptive,PetscInt *maxncv)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscUseMethod(eps,"EPSKrylovSchurGetAdaptiveRestart_C",(EPS,PetscBool*,PetscInt*),(eps,adaptive,maxncv));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode EPSKrylovSchurSetMixedPrecision_KrylovSchur(EPS eps,PetscBool mixed,PetscReal tol)
+{
+  EPS_KRYLOVSCHUR *ctx = (EPS_KRYLOVSCHUR*)eps->data;
+
+  PetscFunctionBegin;
+  if (tol == (PetscReal)PETSC_DETERMINE || tol == (PetscReal)PETSC_DECIDE) ctx->mtol = 1e-5;
+  else if (tol != (PetscReal)PETSC_CURRENT) {
+    PetscCheck(tol>0.0,PetscObjectComm((PetscObject)eps),PETSC_ERR_ARG_OUTOFRANGE,"Illegal value of tol. Must be > 0");
+    ctx->mtol = tol;
+  }
+  if (ctx->mixed != mixed) {
+    ctx->mixed = mixed;
+    eps->state = EPS_STATE_INITIAL;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSKrylovSchurSetMixedPrecision - Activates a two-stage solve in the Krylov-Schur
+   method, where the first stage is carried out with a lower precision companion matrix.
+
+   Logically Collective
+
+   Input Parameters:
++  eps   - the eigenproblem solver context
+.  mixed - whether the two-stage solve is used or not
+-  tol   - the tolerance of the first stage
+
+   Options Database Keys:
++  -eps_krylovschur_mixed_precision - Activates the two-stage solve
+-  -eps_krylovschur_mixed_precision_tol <tol> - Sets the tolerance of the first stage
+
+   Notes:
+   In the first stage, a Krylov-Schur iteration is run on the companion matrix set
+   with EPSKrylovSchurSetMixedPrecisionMat(), until the wanted eigenpairs satisfy the
+   relaxed tolerance tol. The companion matrix is intended to be cheaper to apply than
+   A, for instance a shell matrix that stores the nonzero values in single precision,
+   which halves the memory traffic of the matrix-vector product in memory-bound
+   problems. If no companion matrix is given, the first stage is skipped and the
+   solve proceeds as usual.
+   Then the iteration continues in working precision with A, starting from a
+   Rayleigh-Ritz projection onto the invariant subspace computed in the first stage.
+   The eigenpairs that already satisfy the final tolerance are locked right away, and
+   the rest are refined by the Krylov-Schur iteration.
+
+   The first stage can be configured from the command line with the options
+   prefix -eps_mp_, e.g., -eps_mp_ncv. The default value of tol is 1e-5, roughly
+   the accuracy that can be attained in single precision arithmetic. Use
+   PETSC_DETERMINE to set the default value, or PETSC_CURRENT to leave it unchanged.
+
+   This is only available for standard eigenproblems with STSHIFT, in the default
+   variant of Krylov-Schur with Ritz extraction. It is not used if the solver is
+   warm-started with the subspace of a previous solve, see EPSSetRecycle().
+
+   Level: advanced
+
+.seealso: EPSKrylovSchurGetMixedPrecision(), EPSKrylovSchurSetMixedPrecisionMat()
+@*/
+PetscErrorCode EPSKrylovSchurSetMixedPrecision(EPS eps,PetscBool mixed,PetscReal tol)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscValidLogicalCollectiveBool(eps,mixed,2);
+  PetscValidLogicalCollectiveReal(eps,tol,3);
+  PetscTryMethod(eps,"EPSKrylovSchurSetMixedPrecision_C",(EPS,PetscBool,PetscReal),(eps,mixed,tol));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode EPSKrylovSchurGetMixedPrecision_KrylovSchur(EPS eps,PetscBool *mixed,PetscReal *tol)
+{
+  EPS_KRYLOVSCHUR *ctx = (EPS_KRYLOVSCHUR*)eps->data;
+
+  PetscFunctionBegin;
+  if (mixed) *mixed = ctx->mixed;
+  if (tol) *tol = ctx->mtol;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSKrylovSchurGetMixedPrecision - Gets the flag indicating whether the two-stage
+   mixed precision solve is used in the Krylov-Schur method, and the tolerance of
+   the first stage.
+
+   Not Collective
+
+   Input Parameter:
+.  eps - the eigenproblem solver context
+
+   Output Parameters:
++  mixed - the mixed precision flag
+-  tol   - the tolerance of the first stage
+
+   Level: advanced
+
+.seealso: EPSKrylovSchurSetMixedPrecision()
+@*/
+PetscErrorCode EPSKrylovSchurGetMixedPrecision(EPS eps,PetscBool *mixed,PetscReal *tol)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscUseMethod(eps,"EPSKrylovSchurGetMixedPrecision_C",(EPS,PetscBool*,PetscReal*),(eps,mixed,tol));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode EPSKrylovSchurSetMixedPrecisionMat_KrylovSchur(EPS eps,Mat A)
+{
+  EPS_KRYLOVSCHUR *ctx = (EPS_KRYLOVSCHUR*)eps->data;
+
+  PetscFunctionBegin;
+  if (A) PetscCall(PetscObjectReference((PetscObject)A));
+  PetscCall(MatDestroy(&ctx->Alow));
+  ctx->Alow  = A;
+  eps->state = EPS_STATE_INITIAL;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSKrylovSchurSetMixedPrecisionMat - Sets the companion matrix used in the first
+   stage of the mixed precision solve in the Krylov-Schur method.
+
+   Collective
+
+   Input Parameters:
++  eps - the eigenproblem solver context
+-  A   - the companion matrix (or NULL)
+
+   Notes:
+   The companion matrix must have the same dimensions and parallel layout as the
+   first matrix of the eigenproblem, of which it is an approximation, e.g., with the
+   values stored in lower precision. See EPSKrylovSchurSetMixedPrecision().
+
+   Level: advanced
+
+.seealso: EPSKrylovSchurGetMixedPrecisionMat(), EPSKrylovSchurSetMixedPrecision()
+@*/
+PetscErrorCode EPSKrylovSchurSetMixedPrecisionMat(EPS eps,Mat A)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  if (A) {
+    PetscValidHeaderSpecific(A,MAT_CLASSID,2);
+    PetscCheckSameComm(eps,1,A,2);
+  }
+  PetscTryMethod(eps,"EPSKrylovSchurSetMixedPrecisionMat_C",(EPS,Mat),(eps,A));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode EPSKrylovSchurGetMixedPrecisionMat_KrylovSchur(EPS eps,Mat *A)
+{
+  EPS_KRYLOVSCHUR *ctx = (EPS_KRYLOVSCHUR*)eps->data;
+
+  PetscFunctionBegin;
+  *A = ctx->Alow;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSKrylovSchurGetMixedPrecisionMat - Gets the companion matrix used in the first
+   stage of the mixed precision solve in the Krylov-Schur method.
+
+   Not Collective
+
+   Input Parameter:
+.  eps - the eigenproblem solver context
+
+   Output Parameter:
+.  A - the companion matrix (NULL if not set)
+
+   Level: advanced
+
+.seealso: EPSKrylovSchurSetMixedPrecisionMat()
+@*/
+PetscErrorCode EPSKrylovSchurGetMixedPrecisionMat(EPS eps,Mat *A)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscAssertPointer(A,2);
+  PetscUseMethod(eps,"EPSKrylovSchurGetMixedPrecisionMat_C",(EPS,Mat*),(eps,A));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode EPSKrylovSchurSetLocking_KrylovSchur(EPS eps,PetscBool lock)
 {
   EPS_KRYLOVSCHUR *ctx = (EPS_KRYLOVSCHUR*)eps->data;
@@ -1449,6 +2062,18 @@ static PetscErrorCode EPSSetFromOptions_KrylovSchur(EPS eps,PetscOptionItems *Pe
     PetscCall(PetscOptionsReal("-eps_krylovschur_restart","Proportion of vectors kept after restart","EPSKrylovSchurSetRestart",0.5,&keep,&flg));
     if (flg) PetscCall(EPSKrylovSchurSetRestart(eps,keep));
 
+    b = ctx->adaptive;
+    PetscCall(PetscOptionsBool("-eps_krylovschur_adaptive_restart","Adapt the restart parameter and ncv during the iteration","EPSKrylovSchurSetAdaptiveRestart",ctx->adaptive,&b,&f1));
+    i = ctx->maxncv;
+    PetscCall(PetscOptionsInt("-eps_krylovschur_adaptive_maxncv","Maximum number of basis vectors in adaptive restart","EPSKrylovSchurSetAdaptiveRestart",ctx->maxncv,&i,&f2));
+    if (f1 || f2) PetscCall(EPSKrylovSchurSetAdaptiveRestart(eps,b,f2?i:PETSC_CURRENT));
+
+    b = ctx->mixed;
+    PetscCall(PetscOptionsBool("-eps_krylovschur_mixed_precision","Run a first stage with a lower precision companion matrix","EPSKrylovSchurSetMixedPrecision",ctx->mixed,&b,&f1));
+    keep = ctx->mtol;
+    PetscCall(PetscOptionsReal("-eps_krylovschur_mixed_precision_tol","Tolerance of the first stage in mixed precision","EPSKrylovSchurSetMixedPrecision",ctx->mtol,&keep,&f2));
+    if (f1 || f2) PetscCall(EPSKrylovSchurSetMixedPrecision(eps,b,f2?keep:PETSC_CURRENT));
+
     PetscCall(PetscOptionsBool("-eps_krylovschur_locking","Choose between locking and non-locking variants","EPSKrylovSchurSetLocking",PETSC_TRUE,&lock,&flg));
     if (flg) PetscCall(EPSKrylovSchurSetLocking(eps,lock));
 
@@ -1497,7 +2122,9 @@ static PetscErrorCode EPSView_KrylovSchur(EPS eps,PetscViewer viewer)
   PetscCall(PetscObjectTypeCompare((PetscObject)viewer,PETSCVIEWERASCII,&isascii));
   if (isascii) {
     PetscCall(PetscViewerASCIIPrintf(viewer,"  %d%% of basis vectors kept after restart\n",(int)(100*ctx->keep)));
+    if (ctx->adaptive) PetscCall(PetscViewerASCIIPrintf(viewer,"  adaptive restart: %d%% of basis vectors kept in the last restart, ncv limited to %" PetscInt_FMT "\n",(int)(100*ctx->akeep),ctx->ncvcap? ctx->ncvcap: ctx->maxncv));
     PetscCall(PetscViewerASCIIPrintf(viewer,"  using the %slocking variant\n",ctx->lock?"":"non-"));
+    if (ctx->mixed) PetscCall(PetscViewerASCIIPrintf(viewer,"  mixed precision: first stage with tolerance %g, %" PetscInt_FMT " iterations in the last solve%s\n",(double)ctx->mtol,ctx->itsmp,ctx->Alow?"":" (skipped, no companion matrix)"));
     if (eps->problem_type==EPS_BSE) PetscCall(PetscViewerASCIIPrintf(viewer,"  BSE method: %s\n",EPSKrylovSchurBSETypes[ctx->bse]));
     if (eps->which==EPS_ALL) {
       PetscCall(PetscObjectTypeCompare((PetscObject)eps->st,STFILTER,&isfilt));
@@ -1528,14 +2155,23 @@ static PetscErrorCode EPSView_KrylovSchur(EPS eps,PetscViewer viewer)
 
 static PetscErrorCode EPSDestroy_KrylovSchur(EPS eps)
 {
-  PetscBool      isfilt;
+  EPS_KRYLOVSCHUR *ctx = (EPS_KRYLOVSCHUR*)eps->data;
+  PetscBool       isfilt;
 
   PetscFunctionBegin;
   PetscCall(PetscObjectTypeCompare((PetscObject)eps->st,STFILTER,&isfilt));
   if (eps->which==EPS_ALL && !isfilt) PetscCall(EPSDestroy_KrylovSchur_Slice(eps));
+  PetscCall(EPSDestroy(&ctx->epsmp));
+  PetscCall(MatDestroy(&ctx->Alow));
   PetscCall(PetscFree(eps->data));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurSetRestart_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurGetRestart_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurSetAdaptiveRestart_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurGetAdaptiveRestart_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurSetMixedPrecision_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurGetMixedPrecision_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurSetMixedPrecisionMat_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurGetMixedPrecisionMat_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurSetLocking_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurGetLocking_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurSetPartitions_C",NULL));
@@ -1559,11 +2195,13 @@ static PetscErrorCode EPSDestroy_KrylovSchur(EPS eps)
 
 static PetscErrorCode EPSReset_KrylovSchur(EPS eps)
 {
-  PetscBool      isfilt;
+  EPS_KRYLOVSCHUR *ctx = (EPS_KRYLOVSCHUR*)eps->data;
+  PetscBool       isfilt;
 
   PetscFunctionBegin;
   PetscCall(PetscObjectTypeCompare((PetscObject)eps->st,STFILTER,&isfilt));
   if (eps->which==EPS_ALL && !isfilt) PetscCall(EPSReset_KrylovSchur_Slice(eps));
+  if (ctx->epsmp) PetscCall(EPSReset(ctx->epsmp));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -1584,6 +2222,8 @@ SLEPC_EXTERN PetscErrorCode EPSCreate_KrylovSchur(EPS eps)
   PetscCall(PetscNew(&ctx));
   eps->data   = (void*)ctx;
   ctx->lock   = PETSC_TRUE;
+  ctx->maxncv = PETSC_DETERMINE;
+  ctx->mtol   = 1e-5;
   ctx->nev    = 1;
   ctx->ncv    = PETSC_DETERMINE;
   ctx->mpd    = PETSC_DETERMINE;
@@ -1605,6 +2245,12 @@ SLEPC_EXTERN PetscErrorCode EPSCreate_KrylovSchur(EPS eps)
 
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurSetRestart_C",EPSKrylovSchurSetRestart_KrylovSchur));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurGetRestart_C",EPSKrylovSchurGetRestart_KrylovSchur));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurSetAdaptiveRestart_C",EPSKrylovSchurSetAdaptiveRestart_KrylovSchur));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurGetAdaptiveRestart_C",EPSKrylovSchurGetAdaptiveRestart_KrylovSchur));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurSetMixedPrecision_C",EPSKrylovSchurSetMixedPrecision_KrylovSchur));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurGetMixedPrecision_C",EPSKrylovSchurGetMixedPrecision_KrylovSchur));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurSetMixedPrecisionMat_C",EPSKrylovSchurSetMixedPrecisionMat_KrylovSchur));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurGetMixedPrecisionMat_C",EPSKrylovSchurGetMixedPrecisionMat_KrylovSchur));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurSetLocking_C",EPSKrylovSchurSetLocking_KrylovSchur));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurGetLocking_C",EPSKrylovSchurGetLocking_KrylovSchur));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurSetPartitions_C",EPSKrylovSchurSetPartitions_KrylovSchur));
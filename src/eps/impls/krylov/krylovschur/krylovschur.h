@@ -14,6 +14,7 @@
 #pragma once
 
 SLEPC_INTERN PetscErrorCode EPSSolve_KrylovSchur_Default(EPS);
+SLEPC_INTERN PetscErrorCode EPSSolve_KrylovSchur_MixedPrecision(EPS);
 SLEPC_INTERN PetscErrorCode EPSSolve_KrylovSchur_TwoSided(EPS);
 SLEPC_INTERN PetscErrorCode EPSSolve_KrylovSchur_Slice(EPS);
 SLEPC_INTERN PetscErrorCode EPSSetUp_KrylovSchur_Slice(EPS);
@@ -76,6 +77,16 @@ typedef struct _n_SR *EPS_SR;
 typedef struct {
   PetscReal        keep;               /* restart parameter */
   PetscBool        lock;               /* locking/non-locking variant */
+  PetscBool        adaptive;           /* adapt the restart parameter and ncv during the iteration */
+  PetscInt         maxncv;             /* maximum value of ncv in adaptive restart (user setting) */
+  PetscInt         ncvcap;             /* maximum value of ncv in adaptive restart (actual value) */
+  PetscReal        akeep;              /* current restart parameter in adaptive restart */
+  PetscReal        rho;                /* smoothed reduction factor of the residual per restart */
+  PetscBool        mixed;              /* two-stage solve with a lower precision first stage */
+  PetscReal        mtol;               /* tolerance of the first stage in mixed precision */
+  Mat              Alow;               /* companion matrix used in the first stage */
+  EPS              epsmp;              /* eigensolver of the first stage */
+  PetscInt         itsmp;              /* iterations of the first stage in the last solve */
   /* the following are used only in spectrum slicing */
   EPS_SR           sr;                 /* spectrum slicing context */
   PetscInt         nev;                /* number of eigenvalues to compute */
@@ -10,14 +10,17 @@
 /*
    This file implements a wrapper to the LAPACK eigenvalue subroutines.
    Generalized problems are transformed to standard ones only if necessary.
+   For standard Hermitian problems where only the leftmost or rightmost
+   eigenvalues are wanted, only the requested eigenpairs are computed.
 */
 
 #include <slepc/private/epsimpl.h>
+#include <slepcblaslapack.h>
 
 static PetscErrorCode EPSSetUp_LAPACK(EPS eps)
 {
   int            ierra,ierrb;
-  PetscBool      isshift,flg,denseok=PETSC_FALSE;
+  PetscBool      isshift,flg,denseok=PETSC_FALSE,range;
   Mat            A,B,OP,shell,Ar,Br,Adense=NULL,Bdense=NULL,Ads,Bds;
   PetscScalar    shift;
   PetscInt       nmat;
@@ -32,7 +35,6 @@ static PetscErrorCode EPSSetUp_LAPACK(EPS eps)
   PetscCheck(eps->which!=EPS_ALL || eps->inta==eps->intb,PetscObjectComm((PetscObject)eps),PETSC_ERR_SUP,"This solver does not support interval computation");
   EPSCheckUnsupported(eps,EPS_FEATURE_BALANCE | EPS_FEATURE_ARBITRARY | EPS_FEATURE_REGION | EPS_FEATURE_STOPPING);
   EPSCheckIgnored(eps,EPS_FEATURE_EXTRACTION | EPS_FEATURE_CONVERGENCE);
-  PetscCall(EPSAllocateSolution(eps,0));
 
   /* attempt to get dense representations of A and B separately */
   PetscCall(PetscObjectTypeCompare((PetscObject)eps->st,STSHIFT,&isshift));
@@ -61,6 +63,14 @@ static PetscErrorCode EPSSetUp_LAPACK(EPS eps)
     denseok = PetscNot(ierra || ierrb);
   }
 
+  /* compute only the wanted eigenpairs if the problem allows it */
+  range = (denseok && eps->ishermitian && !eps->isgeneralized && (eps->which==EPS_SMALLEST_REAL || eps->which==EPS_LARGEST_REAL) && eps->nev<eps->n)? PETSC_TRUE: PETSC_FALSE;
+  if (range) {
+    eps->ncv = eps->nev;
+    PetscCall(PetscInfo(eps,"Computing only %" PetscInt_FMT " of %" PetscInt_FMT " eigenpairs\n",eps->nev,eps->n));
+  }
+  PetscCall(EPSAllocateSolution(eps,0));
+
   /* setup DS */
   if (denseok) {
     if (eps->isgeneralized) {
@@ -73,8 +83,8 @@ static PetscErrorCode EPSSetUp_LAPACK(EPS eps)
       else PetscCall(DSSetType(eps->ds,DSNHEP));
     }
   } else PetscCall(DSSetType(eps->ds,DSNHEP));
-  PetscCall(DSAllocate(eps->ds,eps->ncv));
-  PetscCall(DSSetDimensions(eps->ds,eps->ncv,0,0));
+  PetscCall(DSAllocate(eps->ds,eps->n));
+  PetscCall(DSSetDimensions(eps->ds,eps->n,0,0));
 
   if (denseok) {
     PetscCall(STGetShift(eps->st,&shift));
@@ -112,6 +122,83 @@ static PetscErrorCode EPSSetUp_LAPACK(EPS eps)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   EPSSolve_LAPACK_Range - Computes only the nev leftmost or rightmost eigenpairs
+   of a standard Hermitian problem, with the matrix stored in DS_MAT_A.
+*/
+static PetscErrorCode EPSSolve_LAPACK_Range(EPS eps)
+{
+  PetscInt       n=eps->n,k=eps->ncv,nc,i,j,low,high;
+  PetscScalar    *array,*pA,*Z,*work,sdummy;
+  PetscReal      *w,vl=0.0,vu=0.0,abstol=0.0;
+  PetscBLASInt   n_,k_,il,iu,m,lwork,liwork,*isuppz,*iwork,idummy,info;
+  PetscMPIInt    len;
+  Vec            v;
+#if defined(PETSC_USE_COMPLEX)
+  PetscReal      *rwork,rdummy;
+  PetscBLASInt   lrwork;
+#endif
+
+  PetscFunctionBegin;
+  PetscCall(PetscBLASIntCast(n,&n_));
+  PetscCall(PetscBLASIntCast(k,&k_));
+  if (eps->which==EPS_SMALLEST_REAL) { il = 1; iu = k_; }
+  else { il = n_-k_+1; iu = n_; }
+  PetscCall(PetscMalloc3(n,&w,n*k,&Z,2*n,&isuppz));
+  PetscCall(DSGetArray(eps->ds,DS_MAT_A,&pA));
+
+  /* workspace query */
+  lwork = -1; liwork = -1;
+#if defined(PETSC_USE_COMPLEX)
+  lrwork = -1;
+  PetscCallBLAS("LAPACKsyevr",LAPACKsyevr_("V","I","L",&n_,pA,&n_,&vl,&vu,&il,&iu,&abstol,&m,w,Z,&n_,isuppz,&sdummy,&lwork,&rdummy,&lrwork,&idummy,&liwork,&info));
+  PetscCall(PetscBLASIntCast((PetscInt)rdummy,&lrwork));
+#else
+  PetscCallBLAS("LAPACKsyevr",LAPACKsyevr_("V","I","L",&n_,pA,&n_,&vl,&vu,&il,&iu,&abstol,&m,w,Z,&n_,isuppz,&sdummy,&lwork,&idummy,&liwork,&info));
+#endif
+  SlepcCheckLapackInfo("syevr",info);
+  PetscCall(PetscBLASIntCast((PetscInt)PetscRealPart(sdummy),&lwork));
+  liwork = idummy;
+  PetscCall(PetscMalloc2(lwork,&work,liwork,&iwork));
+#if defined(PETSC_USE_COMPLEX)
+  PetscCall(PetscMalloc1(lrwork,&rwork));
+  PetscCallBLAS("LAPACKsyevr",LAPACKsyevr_("V","I","L",&n_,pA,&n_,&vl,&vu,&il,&iu,&abstol,&m,w,Z,&n_,isuppz,work,&lwork,rwork,&lrwork,iwork,&liwork,&info));
+  PetscCall(PetscFree(rwork));
+#else
+  PetscCallBLAS("LAPACKsyevr",LAPACKsyevr_("V","I","L",&n_,pA,&n_,&vl,&vu,&il,&iu,&abstol,&m,w,Z,&n_,isuppz,work,&lwork,iwork,&liwork,&info));
+#endif
+  SlepcCheckLapackInfo("syevr",info);
+  PetscCall(PetscFree2(work,iwork));
+  PetscCall(DSRestoreArray(eps->ds,DS_MAT_A,&pA));
+
+  /* make sure all processes have the same result */
+  nc = m;
+  PetscCallMPI(MPI_Bcast(&nc,1,MPIU_INT,0,PetscObjectComm((PetscObject)eps)));
+  PetscCall(PetscMPIIntCast(nc,&len));
+  PetscCallMPI(MPI_Bcast(w,len,MPIU_REAL,0,PetscObjectComm((PetscObject)eps)));
+  PetscCall(PetscMPIIntCast(n*nc,&len));
+  PetscCallMPI(MPI_Bcast(Z,len,MPIU_SCALAR,0,PetscObjectComm((PetscObject)eps)));
+
+  /* eigenvalues are returned in ascending order */
+  for (i=0;i<nc;i++) {
+    j = (eps->which==EPS_SMALLEST_REAL)? i: nc-i-1;
+    eps->eigr[i] = w[j];
+    eps->eigi[i] = 0.0;
+    PetscCall(BVGetColumn(eps->V,i,&v));
+    PetscCall(VecGetOwnershipRange(v,&low,&high));
+    PetscCall(VecGetArray(v,&array));
+    PetscCall(PetscArraycpy(array,Z+j*n+low,high-low));
+    PetscCall(VecRestoreArray(v,&array));
+    PetscCall(BVRestoreColumn(eps->V,i,&v));
+  }
+  PetscCall(PetscFree3(w,Z,isuppz));
+
+  eps->nconv  = nc;
+  eps->its    = 1;
+  eps->reason = EPS_CONVERGED_TOL;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode EPSSolve_LAPACK(EPS eps)
 {
   PetscInt       n=eps->n,i,low,high;
@@ -119,6 +206,10 @@ static PetscErrorCode EPSSolve_LAPACK(EPS eps)
   Vec            v,w;
 
   PetscFunctionBegin;
+  if (eps->ncv<n) {
+    PetscCall(EPSSolve_LAPACK_Range(eps));
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
   PetscCall(DSSolve(eps->ds,eps->eigr,eps->eigi));
   PetscCall(DSSort(eps->ds,eps->eigr,eps->eigi,NULL,NULL,NULL));
   PetscCall(DSSynchronize(eps->ds,eps->eigr,eps->eigi));
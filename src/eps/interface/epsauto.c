@@ -0,0 +1,432 @@
+/*
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+   SLEPc - Scalable Library for Eigenvalue Problem Computations
+   Copyright (c) 2002-, Universitat Politecnica de Valencia, Spain
+
+   This file is part of SLEPc.
+   SLEPc is distributed under a 2-clause BSD license (see LICENSE).
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+*/
+/*
+   EPS routines related to the automatic selection of the solver
+*/
+
+#include <slepc/private/epsimpl.h>       /*I "slepceps.h" I*/
+#include <slepc/private/stimpl.h>
+
+#define EPS_AUTO_MAXCAND 10
+#define EPS_AUTO_DENSE   1000    /* largest dimension for which dense solvers are tried */
+
+typedef struct {
+  EPSType   type;       /* solver type */
+  STType    sttype;     /* spectral transformation, NULL if the ST of the EPS is kept */
+  PetscBool timed;      /* whether the solver honors the time budget of the trial (only dense solvers do not) */
+} EPSAutoCandidate;
+
+typedef struct {
+  PetscLogDouble t0;    /* starting time of the trial */
+  PetscReal      tmax;  /* time budget of the trial */
+} EPSAutoTrialCtx;
+
+/*
+   Stopping test of the trials, the default one plus a time limit. The elapsed
+   time is reduced across processes so that all of them stop at the same iteration
+*/
+static PetscErrorCode EPSAutoStopping_Private(EPS eps,PetscInt its,PetscInt max_it,PetscInt nconv,PetscInt nev,EPSConvergedReason *reason,void *ctx)
+{
+  EPSAutoTrialCtx *trial = (EPSAutoTrialCtx*)ctx;
+  PetscLogDouble  t;
+
+  PetscFunctionBegin;
+  PetscCall(EPSStoppingBasic(eps,its,max_it,nconv,nev,reason,NULL));
+  if (*reason==EPS_CONVERGED_ITERATING) {
+    PetscCall(PetscTime(&t));
+    t -= trial->t0;
+    PetscCallMPI(MPIU_Allreduce(MPI_IN_PLACE,&t,1,MPIU_PETSCLOGDOUBLE,MPI_MAX,PetscObjectComm((PetscObject)eps)));
+    if (t>trial->tmax) *reason = EPS_DIVERGED_ITS;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   Builds a string that identifies the problem, used as the key of the cache
+*/
+static PetscErrorCode EPSAutoSignature_Private(EPS eps,EPSProblemType ptype,EPSWhich which,char *sig,size_t len)
+{
+  Mat         A;
+  MatType     mtype;
+  STType      sttype=NULL;
+  MatInfo     info;
+  PetscInt    nnz=-1,nmat;
+  PetscMPIInt size;
+  PetscBool   flg,isshift;
+
+  PetscFunctionBegin;
+  PetscCall(STGetNumMatrices(eps->st,&nmat));
+  PetscCall(STGetMatrix(eps->st,0,&A));
+  PetscCall(MatGetType(A,&mtype));
+  PetscCall(MatHasOperation(A,MATOP_GET_INFO,&flg));
+  if (flg) {
+    PetscCall(MatGetInfo(A,MAT_GLOBAL_SUM,&info));
+    nnz = (PetscInt)info.nz_used;
+  }
+  PetscCall(PetscObjectTypeCompare((PetscObject)eps->st,STSHIFT,&isshift));
+  if (!isshift && !eps->autost) PetscCall(STGetType(eps->st,&sttype));
+  PetscCallMPI(MPI_Comm_size(PetscObjectComm((PetscObject)eps),&size));
+  PetscCall(PetscSNPrintf(sig,len,"n=%" PetscInt_FMT ",nnz=%" PetscInt_FMT ",nmat=%" PetscInt_FMT ",mat=%s,ptype=%d,which=%d,nev=%" PetscInt_FMT ",target=%g%+gi,st=%s,np=%d",eps->n,nnz,nmat,mtype,(int)ptype,(int)which,eps->nev,(double)PetscRealPart(eps->target),(double)PetscImaginaryPart(eps->target),sttype?sttype:"default",size));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   Looks up the signature in the cache file. Each line of the file contains
+   the signature, the EPS type and the ST type ('-' if the ST is kept)
+*/
+static PetscErrorCode EPSAutoCacheLoad_Private(EPS eps,const char *sig,EPSAutoCandidate *cand,char *type,char *sttype,PetscBool *found)
+{
+  MPI_Comm       comm = PetscObjectComm((PetscObject)eps);
+  PetscMPIInt    rank;
+  PetscBool      flg;
+  FILE           *fp;
+  char           line[PETSC_MAX_PATH_LEN],*p,*q;
+  size_t         len;
+  PetscErrorCode (*r)(EPS);
+
+  PetscFunctionBegin;
+  *found = PETSC_FALSE;
+  PetscCallMPI(MPI_Comm_rank(comm,&rank));
+  flg = PETSC_FALSE;
+  if (!rank) PetscCall(PetscTestFile(eps->autocache,'r',&flg));
+  PetscCallMPI(MPI_Bcast(&flg,1,MPIU_BOOL,0,comm));
+  if (!flg) PetscFunctionReturn(PETSC_SUCCESS);
+  PetscCall(PetscStrlen(sig,&len));
+  PetscCall(PetscFOpen(comm,eps->autocache,"r",&fp));
+  while (!*found) {
+    PetscCall(PetscSynchronizedFGets(comm,fp,sizeof(line),line));
+    if (!line[0]) break;
+    PetscCall(PetscStrncmp(line,sig,len,&flg));
+    if (!flg || line[len]!=' ') continue;
+    p = line+len+1;
+    PetscCall(PetscStrchr(p,' ',&q));
+    if (!q) continue;
+    *q = 0;
+    PetscCall(PetscStrncpy(type,p,64));
+    PetscCall(PetscStrncpy(sttype,q+1,64));
+    PetscCall(PetscStrchr(sttype,'\n',&q));
+    if (q) *q = 0;
+    PetscCall(PetscFunctionListFind(EPSList,type,&r));
+    if (r) *found = PETSC_TRUE;  /* skip entries of solvers not available in this installation */
+  }
+  PetscCall(PetscFClose(comm,fp));
+  if (*found) {
+    cand->type   = type;
+    PetscCall(PetscStrcmp(sttype,"-",&flg));
+    cand->sttype = flg? NULL: sttype;
+    cand->timed  = PETSC_TRUE;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode EPSAutoCacheStore_Private(EPS eps,const char *sig,EPSAutoCandidate *cand)
+{
+  MPI_Comm comm = PetscObjectComm((PetscObject)eps);
+  FILE     *fp;
+
+  PetscFunctionBegin;
+  PetscCall(PetscFOpen(comm,eps->autocache,"a",&fp));
+  PetscCall(PetscFPrintf(comm,fp,"%s %s %s\n",sig,cand->type,cand->sttype?cand->sttype:"-"));
+  PetscCall(PetscFClose(comm,fp));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   Sets the selected type, processing its options from the database
+*/
+static PetscErrorCode EPSAutoApply_Private(EPS eps,EPSAutoCandidate *cand)
+{
+  PetscFunctionBegin;
+  PetscCall(EPSSetType(eps,cand->type));
+  if (cand->sttype) {
+    PetscCall(STSetType(eps->st,cand->sttype));
+    eps->autost = PETSC_TRUE;
+  }
+  PetscObjectOptionsBegin((PetscObject)eps);
+    PetscTryTypeMethod(eps,setfromoptions,PetscOptionsObject);
+  PetscOptionsEnd();
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode EPSAutoAdd_Private(EPSAutoCandidate *cand,PetscInt *nc,EPSType type,STType sttype,PetscBool timed)
+{
+  PetscErrorCode (*r)(EPS);
+
+  PetscFunctionBegin;
+  PetscCall(PetscFunctionListFind(EPSList,type,&r));
+  if (!r || *nc==EPS_AUTO_MAXCAND) PetscFunctionReturn(PETSC_SUCCESS);  /* not available in this installation */
+  cand[*nc].type   = type;
+  cand[*nc].sttype = sttype;
+  cand[*nc].timed  = timed;
+  (*nc)++;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   Probes the problem and builds the list of candidate solvers
+*/
+static PetscErrorCode EPSAutoCandidates_Private(EPS eps,EPSProblemType ptype,EPSWhich which,EPSAutoCandidate *cand,PetscInt *nc)
+{
+  Mat                A;
+  KSP                ksp;
+  KSPType            ksptype;
+  PetscInt           i;
+  PetscReal          left,right,nrm;
+  PetscBool          isshift,isfree,istrivial,herm,definite,interior,factor=PETSC_FALSE,flg,preonly;
+  const MatSolverType solver[] = {MATSOLVERMUMPS,MATSOLVERSUPERLU_DIST,MATSOLVERPETSC};
+
+  PetscFunctionBegin;
+  *nc = 0;
+  herm     = (ptype==EPS_HEP || ptype==EPS_GHEP)? PETSC_TRUE: PETSC_FALSE;
+  definite = (ptype!=EPS_GHIEP && ptype!=EPS_BSE)? PETSC_TRUE: PETSC_FALSE;
+  PetscCall(STGetMatrix(eps->st,0,&A));
+  PetscCall(PetscObjectTypeCompare((PetscObject)eps->st,STSHIFT,&isshift));
+  isfree = (!((PetscObject)eps->st)->type_name || isshift || eps->autost)? PETSC_TRUE: PETSC_FALSE;
+  PetscCall(RGIsTrivial(eps->rg,&istrivial));
+
+  /* features that only the default solver supports */
+  if (which==EPS_ALL || !definite || eps->isstructured || eps->twosided || eps->arbitrary || eps->extraction!=EPS_RITZ || !istrivial || eps->stop==EPS_STOP_USER || eps->nds) {
+    PetscCall(PetscInfo(eps,"The problem settings require the default solver\n"));
+    PetscCall(EPSAutoAdd_Private(cand,nc,EPSKRYLOVSCHUR,NULL,PETSC_TRUE));
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
+
+  /* the ST set by the user restricts the choice */
+  if (!isfree) {
+    PetscCall(PetscObjectTypeCompareAny((PetscObject)eps->st,&flg,STSINVERT,STCAYLEY,""));
+    if (flg) {
+      PetscCall(EPSAutoAdd_Private(cand,nc,EPSKRYLOVSCHUR,NULL,PETSC_TRUE));
+      PetscCall(EPSAutoAdd_Private(cand,nc,EPSARNOLDI,NULL,PETSC_TRUE));
+    } else {
+      PetscCall(PetscObjectTypeCompare((PetscObject)eps->st,STPRECOND,&flg));
+      if (flg && which!=EPS_WHICH_USER) {
+        PetscCall(STGetKSP(eps->st,&ksp));
+        PetscCall(KSPGetType(ksp,&ksptype));
+        PetscCall(PetscStrcmp(ksptype,KSPPREONLY,&preonly));
+        PetscCall(EPSAutoAdd_Private(cand,nc,(!ksptype || preonly)? EPSGD: EPSJD,NULL,PETSC_TRUE));
+      } else PetscCall(EPSAutoAdd_Private(cand,nc,EPSKRYLOVSCHUR,NULL,PETSC_TRUE));
+    }
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
+
+  /* for a target, check whether it lies inside a cheap estimate of the spectrum */
+  interior = (which==EPS_TARGET_MAGNITUDE || which==EPS_TARGET_REAL || which==EPS_TARGET_IMAGINARY)? PETSC_TRUE: PETSC_FALSE;
+  if (interior && !eps->isgeneralized) {
+    if (ptype==EPS_HEP) {
+      PetscCall(MatEstimateSpectralRange_EPS(A,&left,&right));
+      interior = (PetscRealPart(eps->target)>left && PetscRealPart(eps->target)<right)? PETSC_TRUE: PETSC_FALSE;
+      PetscCall(PetscInfo(eps,"Estimated spectral range [%g,%g]\n",(double)left,(double)right));
+    } else {
+      PetscCall(MatHasOperation(A,MATOP_NORM,&flg));
+      if (flg) PetscCall(MatNorm(A,NORM_INFINITY,&nrm));
+      else PetscCall(MatNormEstimate(A,NULL,NULL,&nrm));
+      interior = (PetscAbsScalar(eps->target)<nrm)? PETSC_TRUE: PETSC_FALSE;
+      PetscCall(PetscInfo(eps,"Spectral radius bound %g\n",(double)nrm));
+    }
+  }
+  if (interior) {
+    for (i=0;i<(PetscInt)PETSC_STATIC_ARRAY_LENGTH(solver) && !factor;i++) PetscCall(MatGetFactorAvailable(A,solver[i],MAT_FACTOR_LU,&factor));
+  }
+  PetscCall(PetscInfo(eps,"Problem of size %" PetscInt_FMT ", %s, %s target, factorization %savailable\n",eps->n,herm?"Hermitian":"non-Hermitian",interior?"interior":"no interior",factor?"":"not "));
+
+  if (eps->n<=EPS_AUTO_DENSE) {
+    PetscCall(EPSAutoAdd_Private(cand,nc,EPSKRYLOVSCHUR,(interior && factor)? STSINVERT: STSHIFT,PETSC_TRUE));
+    PetscCall(EPSAutoAdd_Private(cand,nc,EPSLAPACK,STSHIFT,PETSC_FALSE));
+    if (herm) {
+      PetscCall(EPSAutoAdd_Private(cand,nc,EPSSCALAPACK,STSHIFT,PETSC_FALSE));
+      PetscCall(EPSAutoAdd_Private(cand,nc,EPSELPA,STSHIFT,PETSC_FALSE));
+    }
+  } else if (interior && factor) {
+    PetscCall(EPSAutoAdd_Private(cand,nc,EPSKRYLOVSCHUR,STSINVERT,PETSC_TRUE));
+    PetscCall(EPSAutoAdd_Private(cand,nc,EPSARNOLDI,STSINVERT,PETSC_TRUE));
+  } else {
+    /* external solvers such as ARPACK, PRIMME or BLOPEX are not tried, since they
+       ignore the stopping test and could run for much longer than the time budget */
+    PetscCall(EPSAutoAdd_Private(cand,nc,EPSKRYLOVSCHUR,STSHIFT,PETSC_TRUE));
+    if (!herm) PetscCall(EPSAutoAdd_Private(cand,nc,EPSARNOLDI,STSHIFT,PETSC_TRUE));
+    if (which!=EPS_WHICH_USER) {
+      PetscCall(EPSAutoAdd_Private(cand,nc,EPSGD,STPRECOND,PETSC_TRUE));
+      if (interior) PetscCall(EPSAutoAdd_Private(cand,nc,EPSJD,STPRECOND,PETSC_TRUE));
+    }
+    /* same condition as in EPSSetUp_LOBPCG() with the default block size */
+    if (herm && (which==EPS_SMALLEST_REAL || which==EPS_LARGEST_REAL) && eps->n>=5*PetscMin(16,eps->nev)) PetscCall(EPSAutoAdd_Private(cand,nc,EPSLOBPCG,STPRECOND,PETSC_TRUE));
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   Copies the settings of the ST configured by the user to the ST of a trial, so
+   that the trial does not modify the former (e.g., its KSP)
+*/
+static PetscErrorCode EPSAutoCopyST_Private(ST st,ST newst)
+{
+  STType        type;
+  KSPType       ksptype;
+  PCType        pctype;
+  MatSolverType solver;
+  PetscScalar   sigma;
+  PetscReal     rtol,abstol,dtol;
+  PetscInt      maxits;
+  KSP           ksp;
+  PC            pc,newpc;
+  PetscBool     flg;
+
+  PetscFunctionBegin;
+  PetscCall(STGetType(st,&type));
+  if (type) PetscCall(STSetType(newst,type));
+  if (st->sigma_set) {
+    PetscCall(STGetShift(st,&sigma));
+    PetscCall(STSetShift(newst,sigma));
+  }
+  PetscCall(PetscObjectTypeCompare((PetscObject)st,STCAYLEY,&flg));
+  if (flg) {
+    PetscCall(STCayleyGetAntishift(st,&sigma));
+    PetscCall(STCayleySetAntishift(newst,sigma));
+  }
+  PetscCall(STSetTransform(newst,st->transform));
+  PetscCall(STSetMatMode(newst,st->matmode));
+  PetscCall(STSetMatStructure(newst,st->str));
+  if (st->Pmat_set) PetscCall(STSetPreconditionerMat(newst,st->Pmat));
+  if (st->ksp) {
+    PetscCall(STGetKSP(newst,&ksp));
+    PetscCall(KSPGetType(st->ksp,&ksptype));
+    if (ksptype) PetscCall(KSPSetType(ksp,ksptype));
+    PetscCall(KSPGetTolerances(st->ksp,&rtol,&abstol,&dtol,&maxits));
+    PetscCall(KSPSetTolerances(ksp,rtol,abstol,dtol,maxits));
+    PetscCall(KSPGetPC(st->ksp,&pc));
+    PetscCall(KSPGetPC(ksp,&newpc));
+    PetscCall(PCGetType(pc,&pctype));
+    if (pctype) {
+      PetscCall(PCSetType(newpc,pctype));
+      PetscCall(PetscObjectTypeCompareAny((PetscObject)pc,&flg,PCLU,PCCHOLESKY,PCILU,PCICC,""));
+      if (flg) {
+        PetscCall(PCFactorGetMatSolverType(pc,&solver));
+        if (solver) PetscCall(PCFactorSetMatSolverType(newpc,solver));
+      }
+    }
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   Runs a trial of one candidate, returning the number of converged eigenpairs
+   and the elapsed time (maximum over all processes). The trial works on its own
+   ST, with the settings of the one configured by the user if the candidate keeps it.
+   The options database is not processed for the trial, since it is configured
+   entirely from the settings of the EPS
+*/
+static PetscErrorCode EPSAutoTrial_Private(EPS eps,EPSProblemType ptype,EPSWhich which,EPSAutoCandidate *cand,PetscInt *nconv,PetscLogDouble *time)
+{
+  EPS             trial;
+  ST              st;
+  Mat             A,B=NULL;
+  PetscInt        nmat;
+  EPSAutoTrialCtx tctx;
+  PetscBool       isprecond;
+
+  PetscFunctionBegin;
+  PetscCall(EPSCreate(PetscObjectComm((PetscObject)eps),&trial));
+  PetscCall(STGetNumMatrices(eps->st,&nmat));
+  PetscCall(STGetMatrix(eps->st,0,&A));
+  if (nmat>1) PetscCall(STGetMatrix(eps->st,1,&B));
+  PetscCall(EPSSetOperators(trial,A,B));
+  PetscCall(EPSGetST(trial,&st));
+  if (cand->sttype) {
+    /* the preconditioned solvers set their own default ST */
+    PetscCall(PetscStrcmp(cand->sttype,STPRECOND,&isprecond));
+    if (!isprecond) PetscCall(STSetType(st,cand->sttype));
+  } else PetscCall(EPSAutoCopyST_Private(eps->st,st));
+  PetscCall(EPSSetType(trial,cand->type));
+  PetscCall(EPSSetProblemType(trial,ptype));
+  PetscCall(EPSSetWhichEigenpairs(trial,which));
+  if (which==EPS_WHICH_USER) PetscCall(EPSSetEigenvalueComparison(trial,eps->sc->comparison,eps->sc->comparisonctx));
+  PetscCall(EPSSetTarget(trial,eps->target));
+  PetscCall(EPSSetDimensions(trial,eps->nev,PETSC_DETERMINE,PETSC_DETERMINE));
+  PetscCall(EPSSetTolerances(trial,eps->tol,PETSC_DETERMINE));
+  if (eps->conv!=EPS_CONV_USER) PetscCall(EPSSetConvergenceTest(trial,eps->conv));
+  tctx.tmax = eps->autotime;
+  if (cand->timed) PetscCall(EPSSetStoppingTestFunction(trial,EPSAutoStopping_Private,&tctx,NULL));
+
+  PetscCall(PetscTime(&tctx.t0));
+  PetscCall(EPSSolve(trial));
+  PetscCall(PetscTime(time));
+  *time -= tctx.t0;
+  PetscCallMPI(MPIU_Allreduce(MPI_IN_PLACE,time,1,MPIU_PETSCLOGDOUBLE,MPI_MAX,PetscObjectComm((PetscObject)eps)));
+  PetscCall(EPSGetConverged(trial,nconv));
+  PetscCall(EPSDestroy(&trial));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   EPSAutoSelect_Private - Selects the solver type (and possibly the ST type) by
+   probing the problem and running short timed trials of the candidates, see
+   EPSSetAutoSelect(). Called at EPSSetUp().
+*/
+PetscErrorCode EPSAutoSelect_Private(EPS eps)
+{
+  EPSAutoCandidate cand[EPS_AUTO_MAXCAND],cached;
+  EPSProblemType   ptype = eps->problem_type;
+  EPSWhich         which = eps->which;
+  PetscInt         i,nc,nmat,nconv,best=-1,bestnconv=-1;
+  PetscLogDouble   time,besttime=0.0;
+  PetscBool        found,flg;
+  char             sig[PETSC_MAX_PATH_LEN],type[64],sttype[64];
+
+  PetscFunctionBegin;
+  if (!eps->st) PetscCall(EPSGetST(eps,&eps->st));
+  if (!eps->rg) PetscCall(EPSGetRG(eps,&eps->rg));
+  PetscCall(STGetNumMatrices(eps->st,&nmat));
+  PetscCheck(nmat,PetscObjectComm((PetscObject)eps),PETSC_ERR_ARG_WRONGSTATE,"EPSSetOperators must be called first");
+  PetscCall(STMatGetSize(eps->st,&eps->n,NULL));
+  if (!ptype) ptype = (nmat==1)? EPS_NHEP: EPS_GNHEP;
+  if (!which) {
+    PetscCall(PetscObjectTypeCompare((PetscObject)eps->st,STSINVERT,&flg));
+    which = (flg && !eps->autost)? EPS_TARGET_MAGNITUDE: EPS_LARGEST_MAGNITUDE;
+  }
+
+  /* skip the selection if the problem has not changed since the last one */
+  PetscCall(EPSAutoSignature_Private(eps,ptype,which,sig,sizeof(sig)));
+  if (eps->autosig && ((PetscObject)eps)->type_name) {
+    PetscCall(PetscStrcmp(sig,eps->autosig,&flg));
+    if (flg) PetscFunctionReturn(PETSC_SUCCESS);
+  }
+  PetscCall(PetscFree(eps->autosig));
+  PetscCall(PetscStrallocpy(sig,&eps->autosig));
+
+  if (eps->autocache) {
+    PetscCall(EPSAutoCacheLoad_Private(eps,sig,&cached,type,sttype,&found));
+    if (found) {
+      PetscCall(PetscInfo(eps,"Selected solver %s with ST %s taken from cache file %s\n",cached.type,cached.sttype?cached.sttype:"unchanged",eps->autocache));
+      PetscCall(EPSAutoApply_Private(eps,&cached));
+      PetscFunctionReturn(PETSC_SUCCESS);
+    }
+  }
+
+  PetscCall(EPSAutoCandidates_Private(eps,ptype,which,cand,&nc));
+  PetscCheck(nc,PetscObjectComm((PetscObject)eps),PETSC_ERR_PLIB,"No candidate solver available");
+  if (nc>1) {
+    for (i=0;i<nc;i++) {
+      PetscCall(EPSAutoTrial_Private(eps,ptype,which,cand+i,&nconv,&time));
+      PetscCall(PetscInfo(eps,"Trial of solver %s with ST %s: %" PetscInt_FMT " of %" PetscInt_FMT " eigenpairs converged in %g seconds\n",cand[i].type,cand[i].sttype?cand[i].sttype:"unchanged",nconv,eps->nev,(double)time));
+      /* the one that gets all wanted eigenpairs first, otherwise the one that gets more */
+      nconv = PetscMin(nconv,eps->nev);
+      if (best<0 || nconv>bestnconv || (nconv==bestnconv && time<besttime)) {
+        best      = i;
+        bestnconv = nconv;
+        besttime  = time;
+      }
+    }
+  }
+  if (best<0) best = 0;
+  PetscCall(PetscInfo(eps,"Selected solver %s with ST %s among %" PetscInt_FMT " candidates\n",cand[best].type,cand[best].sttype?cand[best].sttype:"unchanged",nc));
+  PetscCall(EPSAutoApply_Private(eps,cand+best));
+  if (eps->autocache && nc>1) PetscCall(EPSAutoCacheStore_Private(eps,sig,cand+best));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
@@ -74,8 +74,13 @@ PetscErrorCode EPSCreate(MPI_Comm comm,EPS *outeps)
   eps->balance_cutoff  = 1e-8;
   eps->trueres         = PETSC_FALSE;
   eps->trackall        = PETSC_FALSE;
+  eps->nrmest          = PETSC_FALSE;
   eps->purify          = PETSC_TRUE;
   eps->twosided        = PETSC_FALSE;
+  eps->recycle         = PETSC_FALSE;
+  eps->autosel         = PETSC_FALSE;
+  eps->autotime        = 1.0;
+  eps->autocache       = NULL;
 
   eps->converged       = EPSConvergedRelative;
   eps->convergeduser   = NULL;
@@ -98,6 +103,7 @@ PetscErrorCode EPSCreate(MPI_Comm comm,EPS *outeps)
   eps->IS              = NULL;
   eps->ISL             = NULL;
   eps->defl            = NULL;
+  eps->R               = NULL;
   eps->eigr            = NULL;
   eps->eigi            = NULL;
   eps->errest          = NULL;
@@ -112,9 +118,15 @@ PetscErrorCode EPSCreate(MPI_Comm comm,EPS *outeps)
   eps->categ           = EPS_CATEGORY_KRYLOV;
   eps->nconv           = 0;
   eps->its             = 0;
+  eps->nrest           = 0;
+  eps->nrec            = 0;
+  eps->autosig         = NULL;
+  eps->autost          = PETSC_FALSE;
   eps->nloc            = 0;
   eps->nrma            = 0.0;
   eps->nrmb            = 0.0;
+  eps->nrmritz         = PETSC_FALSE;
+  eps->nrmisest        = PETSC_FALSE;
   eps->useds           = PETSC_FALSE;
   eps->isgeneralized   = PETSC_FALSE;
   eps->ispositive      = PETSC_FALSE;
@@ -310,6 +322,7 @@ PetscErrorCode EPSReset(EPS eps)
   PetscCall(VecDestroy(&eps->D));
   PetscCall(BVDestroy(&eps->V));
   PetscCall(BVDestroy(&eps->W));
+  PetscCall(BVDestroy(&eps->R));
   PetscCall(VecDestroyVecs(eps->nwork,&eps->work));
   eps->nwork = 0;
   eps->state = EPS_STATE_INITIAL;
@@ -342,6 +355,8 @@ PetscErrorCode EPSDestroy(EPS *eps)
   PetscCall(RGDestroy(&(*eps)->rg));
   PetscCall(DSDestroy(&(*eps)->ds));
   PetscCall(PetscFree((*eps)->sc));
+  PetscCall(PetscFree((*eps)->autocache));
+  PetscCall(PetscFree((*eps)->autosig));
   /* just in case the initial vectors have not been used */
   PetscCall(SlepcBasisDestroy_Private(&(*eps)->nds,&(*eps)->defl));
   PetscCall(SlepcBasisDestroy_Private(&(*eps)->nini,&(*eps)->IS));
@@ -83,7 +83,7 @@ PetscErrorCode EPSMonitorSetFromOptions(EPS eps,const char opt[],const char name
 @*/
 PetscErrorCode EPSSetFromOptions(EPS eps)
 {
-  char           type[256];
+  char           type[256],file[PETSC_MAX_PATH_LEN];
   PetscBool      set,flg,flg1,flg2,flg3,bval;
   PetscReal      r,array[2]={0,0};
   PetscScalar    s;
@@ -95,8 +95,12 @@ PetscErrorCode EPSSetFromOptions(EPS eps)
   PetscCall(EPSRegisterAll());
   PetscObjectOptionsBegin((PetscObject)eps);
     PetscCall(PetscOptionsFList("-eps_type","Eigensolver method","EPSSetType",EPSList,(char*)(((PetscObject)eps)->type_name?((PetscObject)eps)->type_name:EPSKRYLOVSCHUR),type,sizeof(type),&flg));
-    if (flg) PetscCall(EPSSetType(eps,type));
-    else if (!((PetscObject)eps)->type_name) PetscCall(EPSSetType(eps,EPSKRYLOVSCHUR));
+    if (flg) {
+      PetscCall(PetscStrcmp(type,"auto",&bval));
+      if (bval) PetscCall(EPSSetAutoSelect(eps,PETSC_TRUE,PETSC_CURRENT));
+      else PetscCall(EPSSetType(eps,type));
+    }
+    if (!((PetscObject)eps)->type_name) PetscCall(EPSSetType(eps,EPSKRYLOVSCHUR));
 
     PetscCall(PetscOptionsBoolGroupBegin("-eps_hermitian","Hermitian eigenvalue problem","EPSSetProblemType",&flg));
     if (flg) PetscCall(EPSSetProblemType(eps,EPS_HEP));
@@ -200,10 +204,22 @@ PetscErrorCode EPSSetFromOptions(EPS eps)
     }
 
     PetscCall(PetscOptionsBool("-eps_true_residual","Compute true residuals explicitly","EPSSetTrueResidual",eps->trueres,&eps->trueres,NULL));
+    PetscCall(PetscOptionsBool("-eps_estimate_norms","Estimate the matrix norms instead of computing them","EPSSetEstimateNorms",eps->nrmest,&bval,&flg));
+    if (flg) PetscCall(EPSSetEstimateNorms(eps,bval));
     PetscCall(PetscOptionsBool("-eps_purify","Postprocess eigenvectors for purification","EPSSetPurify",eps->purify,&bval,&flg));
     if (flg) PetscCall(EPSSetPurify(eps,bval));
     PetscCall(PetscOptionsBool("-eps_two_sided","Use two-sided variant (to compute left eigenvectors)","EPSSetTwoSided",eps->twosided,&bval,&flg));
     if (flg) PetscCall(EPSSetTwoSided(eps,bval));
+    PetscCall(PetscOptionsBool("-eps_recycle","Recycle the subspace of the previous solve","EPSSetRecycle",eps->recycle,&bval,&flg));
+    if (flg) PetscCall(EPSSetRecycle(eps,bval));
+
+    bval = eps->autosel;
+    PetscCall(PetscOptionsBool("-eps_auto_select","Select the solver automatically","EPSSetAutoSelect",eps->autosel,&bval,&flg1));
+    r = eps->autotime;
+    PetscCall(PetscOptionsReal("-eps_auto_select_time","Time budget of each trial in automatic selection","EPSSetAutoSelect",eps->autotime,&r,&flg2));
+    if (flg1 || flg2) PetscCall(EPSSetAutoSelect(eps,bval,flg2?r:PETSC_CURRENT));
+    PetscCall(PetscOptionsString("-eps_auto_select_cache","Cache file for automatic selection","EPSSetAutoSelectCache",eps->autocache?eps->autocache:"",file,sizeof(file),&flg));
+    if (flg) PetscCall(EPSSetAutoSelectCache(eps,file));
 
     /* -----------------------------------------------------------------------*/
     /*
@@ -1302,6 +1318,76 @@ PetscErrorCode EPSGetTrackAll(EPS eps,PetscBool *trackall)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*@
+   EPSSetEstimateNorms - Specifies if the norms of the matrices must be estimated
+   instead of computed.
+
+   Logically Collective
+
+   Input Parameters:
++  eps    - the eigensolver context
+-  nrmest - whether the matrix norms are estimated or not
+
+   Options Database Keys:
+.  -eps_estimate_norms <boolean> - Sets/resets the boolean flag 'nrmest'
+
+   Notes:
+   The norms of the matrices are required in the convergence test EPS_CONV_NORM
+   (see EPSSetConvergenceTest()) and in the computation of backward errors (see
+   EPSComputeError()). By default, the infinity norm is computed with MatNorm(), which
+   requires a full pass over the matrix entries and is not available for many
+   matrix-free (shell) matrices. If nrmest is set, the 2-norm is estimated instead
+   with a single matrix-vector product, see MatNormEstimate(). Estimates are also
+   used for matrices that do not support MatNorm(), regardless of this flag.
+
+   In Krylov solvers for standard problems with STSHIFT, the estimate of the norm of A
+   is raised during the iteration to the largest magnitude of the Ritz values, if larger,
+   which approaches the 2-norm of A from below as the Krylov subspace grows.
+
+   Level: advanced
+
+.seealso: EPSGetEstimateNorms(), EPSSetConvergenceTest(), EPSComputeError()
+@*/
+PetscErrorCode EPSSetEstimateNorms(EPS eps,PetscBool nrmest)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscValidLogicalCollectiveBool(eps,nrmest,2);
+  if (eps->nrmest != nrmest) {
+    eps->nrmest   = nrmest;
+    eps->nrma     = 0.0;
+    eps->nrmb     = 0.0;
+    eps->nrmritz  = PETSC_FALSE;
+    eps->nrmisest = PETSC_FALSE;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSGetEstimateNorms - Returns the flag indicating whether the norms of the
+   matrices are estimated instead of computed.
+
+   Not Collective
+
+   Input Parameter:
+.  eps - the eigensolver context
+
+   Output Parameter:
+.  nrmest - the returned flag
+
+   Level: advanced
+
+.seealso: EPSSetEstimateNorms()
+@*/
+PetscErrorCode EPSGetEstimateNorms(EPS eps,PetscBool *nrmest)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscAssertPointer(nrmest,2);
+  *nrmest = eps->nrmest;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@
    EPSSetPurify - Deactivate eigenvector purification (which is activated by default).
 
@@ -1361,6 +1447,224 @@ PetscErrorCode EPSGetPurify(EPS eps,PetscBool *purify)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*@
+   EPSSetRecycle - Activates recycling of the subspace computed in the previous
+   call to EPSSolve().
+
+   Logically Collective
+
+   Input Parameters:
++  eps     - the eigensolver context
+-  recycle - whether the subspace must be recycled or not
+
+   Options Database Keys:
+.  -eps_recycle <boolean> - Sets/resets the boolean flag 'recycle'
+
+   Notes:
+   This is intended for sequences of eigenproblems with slowly varying matrices,
+   e.g., in parameter sweeps or self-consistent field iterations, where the
+   matrices are changed with EPSSetOperators() between calls to EPSSolve().
+
+   If activated, after EPSSolve() the EPS object keeps a copy of the converged
+   invariant subspace, together with the vectors of the last restart in solvers
+   that provide them (currently the default variant of Krylov-Schur). In the
+   next EPSSolve(), this subspace is used as the initial space, unless one has
+   been provided with EPSSetInitialSpace(). In Krylov-Schur, a Rayleigh-Ritz
+   projection is done on the recycled subspace, the Ritz pairs that already
+   satisfy the convergence criterion are locked, and the Krylov expansion starts
+   from a combination of the remaining wanted Ritz vectors.
+
+   The recycled subspace is discarded if the dimension of the problem changes.
+
+   Level: intermediate
+
+.seealso: EPSGetRecycle(), EPSSetInitialSpace(), EPSSetOperators()
+@*/
+PetscErrorCode EPSSetRecycle(EPS eps,PetscBool recycle)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscValidLogicalCollectiveBool(eps,recycle,2);
+  eps->recycle = recycle;
+  if (!recycle) PetscCall(BVDestroy(&eps->R));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSGetRecycle - Returns the flag indicating whether the subspace of the
+   previous solve is recycled or not.
+
+   Not Collective
+
+   Input Parameter:
+.  eps - the eigensolver context
+
+   Output Parameter:
+.  recycle - the returned flag
+
+   Level: intermediate
+
+.seealso: EPSSetRecycle()
+@*/
+PetscErrorCode EPSGetRecycle(EPS eps,PetscBool *recycle)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscAssertPointer(recycle,2);
+  *recycle = eps->recycle;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSSetAutoSelect - Activates the automatic selection of the solver.
+
+   Logically Collective
+
+   Input Parameters:
++  eps     - the eigensolver context
+.  autosel - whether the solver is selected automatically or not
+-  tmax    - time budget (in seconds) of each trial
+
+   Options Database Keys:
++  -eps_type auto - Activates the automatic selection
+.  -eps_auto_select <boolean> - Sets/resets the automatic selection
+-  -eps_auto_select_time <tmax> - Sets the time budget of each trial
+
+   Notes:
+   If activated, the solver type is chosen in EPSSetUp(), overriding the one set
+   with EPSSetType(). First, the problem is probed: its dimension, the problem type,
+   the number of wanted eigenvalues and which part of the spectrum is sought, and,
+   when a target is given, whether it lies inside a cheap estimate of the spectrum
+   and whether a direct linear solver is available for shift-and-invert. This gives
+   a list of candidate solvers, including the external packages SLEPc has been
+   configured with. Then, a short trial of each candidate is run, which stops when
+   the nev eigenpairs have converged or the time budget tmax is exhausted, and the
+   candidate that gets the most converged eigenpairs in less time is selected.
+   Solvers that do not support the stopping test of SLEPc are only tried in small
+   problems (dense solvers), where they are run to completion. The evidence and the
+   decision are logged with PetscInfo(), use -info :eps to see them.
+
+   If the ST is of type STSHIFT (the default), the selection may replace it with
+   STSINVERT or STPRECOND, as required by the selected solver. Any other ST set by
+   the user is kept, and only solvers compatible with it are considered. The trials
+   work on copies of the ST, so its settings are not modified by them. Problems
+   with settings that only Krylov-Schur supports, such as computing all eigenvalues
+   in an interval, are not probed.
+
+   The selection is repeated only when the problem changes, e.g., its dimension or
+   number of nonzeros. Use EPSSetAutoSelectCache() to keep the selections across runs.
+
+   Use PETSC_DETERMINE for the default value of tmax (one second), or PETSC_CURRENT
+   to leave it unchanged.
+
+   Level: intermediate
+
+.seealso: EPSGetAutoSelect(), EPSSetAutoSelectCache(), EPSSetType()
+@*/
+PetscErrorCode EPSSetAutoSelect(EPS eps,PetscBool autosel,PetscReal tmax)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscValidLogicalCollectiveBool(eps,autosel,2);
+  PetscValidLogicalCollectiveReal(eps,tmax,3);
+  if (tmax == (PetscReal)PETSC_DETERMINE || tmax == (PetscReal)PETSC_DECIDE) eps->autotime = 1.0;
+  else if (tmax != (PetscReal)PETSC_CURRENT) {
+    PetscCheck(tmax>0.0,PetscObjectComm((PetscObject)eps),PETSC_ERR_ARG_OUTOFRANGE,"Illegal value of tmax. Must be > 0");
+    eps->autotime = tmax;
+  }
+  if (eps->autosel != autosel) {
+    eps->autosel = autosel;
+    eps->state   = EPS_STATE_INITIAL;
+    PetscCall(PetscFree(eps->autosig));
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSGetAutoSelect - Returns the flag indicating whether the solver is
+   selected automatically, and the time budget of each trial.
+
+   Not Collective
+
+   Input Parameter:
+.  eps - the eigensolver context
+
+   Output Parameters:
++  autosel - the returned flag
+-  tmax    - time budget of each trial
+
+   Level: intermediate
+
+.seealso: EPSSetAutoSelect()
+@*/
+PetscErrorCode EPSGetAutoSelect(EPS eps,PetscBool *autosel,PetscReal *tmax)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  if (autosel) *autosel = eps->autosel;
+  if (tmax) *tmax = eps->autotime;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSSetAutoSelectCache - Sets the file where the automatic selections of the
+   solver are stored.
+
+   Logically Collective
+
+   Input Parameters:
++  eps  - the eigensolver context
+-  file - the name of the cache file (or NULL)
+
+   Options Database Keys:
+.  -eps_auto_select_cache <file> - Sets the cache file
+
+   Notes:
+   Each selection made with trials is appended to the file, keyed by a signature
+   of the problem that includes the dimension, number of nonzeros and type of the
+   matrix, the problem type, which eigenvalues, nev, the target, the ST set by the
+   user and the number of processes. If the signature of the problem is found in
+   the file, the stored selection is used and no trials are run. The file is a
+   small text file that can be edited or deleted to force a new selection.
+
+   Level: intermediate
+
+.seealso: EPSGetAutoSelectCache(), EPSSetAutoSelect()
+@*/
+PetscErrorCode EPSSetAutoSelectCache(EPS eps,const char file[])
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscCall(PetscFree(eps->autocache));
+  if (file && file[0]) PetscCall(PetscStrallocpy(file,&eps->autocache));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSGetAutoSelectCache - Gets the file where the automatic selections of the
+   solver are stored.
+
+   Not Collective
+
+   Input Parameter:
+.  eps - the eigensolver context
+
+   Output Parameter:
+.  file - the name of the cache file (NULL if not set)
+
+   Level: intermediate
+
+.seealso: EPSSetAutoSelectCache()
+@*/
+PetscErrorCode EPSGetAutoSelectCache(EPS eps,const char *file[])
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscAssertPointer(file,2);
+  *file = eps->autocache;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@
    EPSSetOptionsPrefix - Sets the prefix used for searching for all
    EPS options in the database.
@@ -21,6 +21,7 @@ SLEPC_EXTERN PetscErrorCode EPSCreate_RQCG(EPS);
 SLEPC_EXTERN PetscErrorCode EPSCreate_LOBPCG(EPS);
 SLEPC_EXTERN PetscErrorCode EPSCreate_CISS(EPS);
 SLEPC_EXTERN PetscErrorCode EPSCreate_LyapII(EPS);
+SLEPC_EXTERN PetscErrorCode EPSCreate_ChFSI(EPS);
 SLEPC_EXTERN PetscErrorCode EPSCreate_LAPACK(EPS);
 #if defined(SLEPC_HAVE_ARPACK)
 SLEPC_EXTERN PetscErrorCode EPSCreate_ARPACK(EPS);
@@ -75,6 +76,7 @@ PetscErrorCode EPSRegisterAll(void)
   PetscCall(EPSRegister(EPSLOBPCG,EPSCreate_LOBPCG));
   PetscCall(EPSRegister(EPSCISS,EPSCreate_CISS));
   PetscCall(EPSRegister(EPSLYAPII,EPSCreate_LyapII));
+  PetscCall(EPSRegister(EPSCHFSI,EPSCreate_ChFSI));
   PetscCall(EPSRegister(EPSLAPACK,EPSCreate_LAPACK));
 #if defined(SLEPC_HAVE_ARPACK)
   PetscCall(EPSRegister(EPSARPACK,EPSCreate_ARPACK));
@@ -121,6 +121,35 @@ static PetscErrorCode EPSCheckCompatibleST(EPS eps)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   EPSComputeMatrixNorms - Computes the norms of A and B used in the convergence test
+   EPS_CONV_NORM and in backward errors, if they are not available yet. The infinity
+   norm is computed with MatNorm(), unless estimates have been requested with
+   EPSSetEstimateNorms() or the matrix does not support MatNorm(), in which case the
+   2-norm is estimated with MatNormEstimate(), that only needs a matrix-vector product.
+*/
+PetscErrorCode EPSComputeMatrixNorms(EPS eps)
+{
+  PetscInt  i,nmat;
+  PetscReal *nrm[2] = {&eps->nrma,&eps->nrmb};
+  PetscBool flg;
+  Mat       A;
+
+  PetscFunctionBegin;
+  PetscCall(STGetNumMatrices(eps->st,&nmat));
+  for (i=0;i<PetscMin(nmat,2);i++) {
+    if (*nrm[i]) continue;
+    PetscCall(STGetMatrix(eps->st,i,&A));
+    PetscCall(MatHasOperation(A,MATOP_NORM,&flg));
+    if (eps->nrmest || !flg) {
+      PetscCall(MatNormEstimate(A,NULL,NULL,nrm[i]));
+      eps->nrmisest = PETSC_TRUE;
+      PetscCall(PetscInfo(eps,"Estimated norm of matrix %" PetscInt_FMT ": %g\n",i,(double)*nrm[i]));
+    } else PetscCall(MatNorm(A,NORM_INFINITY,nrm[i]));
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*
    MatEstimateSpectralRange_EPS: estimate the spectral range [left,right] of a
    symmetric/Hermitian matrix A using an auxiliary EPS object
@@ -285,7 +314,7 @@ PetscErrorCode EPSSetDSType(EPS eps)
 @*/
 PetscErrorCode EPSSetUp(EPS eps)
 {
-  Mat            A,B;
+  Mat            A;
   PetscInt       k,nmat;
   PetscBool      flg;
 
@@ -297,6 +326,9 @@ PetscErrorCode EPSSetUp(EPS eps)
   /* reset the convergence flag from the previous solves */
   eps->reason = EPS_CONVERGED_ITERATING;
 
+  /* Select the solver type automatically, see EPSSetAutoSelect() */
+  if (eps->autosel) PetscCall(EPSAutoSelect_Private(eps));
+
   /* Set default solver type (EPSSetFromOptions was not called) */
   if (!((PetscObject)eps)->type_name) PetscCall(EPSSetType(eps,EPSKRYLOVSCHUR));
   if (!eps->st) PetscCall(EPSGetST(eps,&eps->st));
@@ -347,16 +379,7 @@ PetscErrorCode EPSSetUp(EPS eps)
   PetscCheck(!eps->ishermitian || (eps->isgeneralized && !eps->ispositive) || (eps->which!=EPS_LARGEST_IMAGINARY && eps->which!=EPS_SMALLEST_IMAGINARY && eps->which!=EPS_TARGET_IMAGINARY),PetscObjectComm((PetscObject)eps),PETSC_ERR_SUP,"Sorting the eigenvalues along the imaginary axis is not allowed when all eigenvalues are real");
 
   /* initialization of matrix norms */
-  if (eps->conv==EPS_CONV_NORM) {
-    if (!eps->nrma) {
-      PetscCall(STGetMatrix(eps->st,0,&A));
-      PetscCall(MatNorm(A,NORM_INFINITY,&eps->nrma));
-    }
-    if (nmat>1 && !eps->nrmb) {
-      PetscCall(STGetMatrix(eps->st,1,&B));
-      PetscCall(MatNorm(B,NORM_INFINITY,&eps->nrmb));
-    }
-  }
+  if (eps->conv==EPS_CONV_NORM) PetscCall(EPSComputeMatrixNorms(eps));
 
   /* call specific solver setup */
   PetscUseTypeMethod(eps,setup);
@@ -376,6 +399,7 @@ PetscErrorCode EPSSetUp(EPS eps)
 
   /* set tolerance if not yet set */
   if (eps->tol==(PetscReal)PETSC_DETERMINE) eps->tol = SLEPC_DEFAULT_TOL;
+  PetscCall(STSetDefaultSolveRefinementTol(eps->st,0.1*eps->tol));
 
   /* set up sorting criterion */
   PetscTryTypeMethod(eps,setupsort);
@@ -473,8 +497,10 @@ PetscErrorCode EPSSetOperators(EPS eps,Mat A,Mat B)
     PetscCheck(mloc==mloc0,PetscObjectComm((PetscObject)eps),PETSC_ERR_ARG_INCOMP,"Local dimensions of A and B do not match (%" PetscInt_FMT ", %" PetscInt_FMT ")",mloc,mloc0);
   }
   if (eps->state && (n!=eps->n || nloc!=eps->nloc)) PetscCall(EPSReset(eps));
-  eps->nrma = 0.0;
-  eps->nrmb = 0.0;
+  eps->nrma     = 0.0;
+  eps->nrmb     = 0.0;
+  eps->nrmritz  = PETSC_FALSE;
+  eps->nrmisest = PETSC_FALSE;
   if (!eps->st) PetscCall(EPSGetST(eps,&eps->st));
   mat[0] = A;
   if (B) {
@@ -658,7 +684,7 @@ PetscErrorCode EPSSetDimensions_Default(EPS eps,PetscInt nev,PetscInt *ncv,Petsc
 
   PetscFunctionBegin;
   if (*ncv!=PETSC_DETERMINE) { /* ncv set */
-    PetscCall(PetscObjectTypeCompareAny((PetscObject)eps,&krylov,EPSKRYLOVSCHUR,EPSARNOLDI,EPSLANCZOS,""));
+    PetscCall(PetscObjectTypeCompareAny((PetscObject)eps,&krylov,EPSKRYLOVSCHUR,EPSARNOLDI,EPSLANCZOS,EPSCHFSI,""));
     if (krylov) {
       PetscCheck(*ncv>=nev+1 || (*ncv==nev && *ncv==n),PetscObjectComm((PetscObject)eps),PETSC_ERR_USER_INPUT,"The value of ncv must be at least nev+1");
     } else {
@@ -29,6 +29,11 @@ static PetscErrorCode EPSComputeValues(EPS eps)
   PetscBool      injective,iscomp,isfilter;
   PetscInt       i,n,aux,nconv0;
   Mat            A,B=NULL,G,Z;
+#if defined(PETSC_USE_COMPLEX)
+  PetscBool      iscontour;
+  PetscInt       inside;
+  RG             rg;
+#endif
 
   PetscFunctionBegin;
   switch (eps->categ) {
@@ -76,6 +81,22 @@ static PetscErrorCode EPSComputeValues(EPS eps)
           }
           if (nconv0>eps->nconv) PetscCall(PetscInfo(eps,"Discarded %" PetscInt_FMT " computed eigenvalues lying outside the interval\n",nconv0-eps->nconv));
         }
+#if defined(PETSC_USE_COMPLEX)
+        /* in case of STCONTOUR discard computed eigenvalues that lie outside the region of the filter */
+        PetscCall(PetscObjectTypeCompare((PetscObject)eps->st,STCONTOUR,&iscontour));
+        if (iscontour) {
+          PetscCall(STContourGetRG(eps->st,&rg));
+          nconv0 = eps->nconv;
+          for (i=0;i<eps->nconv;i++) {
+            PetscCall(RGCheckInside(rg,1,eps->eigr+eps->perm[i],eps->eigi+eps->perm[i],&inside));
+            if (inside<0) {
+              eps->nconv--;
+              if (i<eps->nconv) { SlepcSwap(eps->perm[i],eps->perm[eps->nconv],aux); i--; }
+            }
+          }
+          if (nconv0>eps->nconv) PetscCall(PetscInfo(eps,"Discarded %" PetscInt_FMT " computed eigenvalues lying outside the region\n",nconv0-eps->nconv));
+        }
+#endif
       }
       break;
     case EPS_CATEGORY_PRECOND:
@@ -86,6 +107,57 @@ static PetscErrorCode EPSComputeValues(EPS eps)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   EPSRecycleStore_Private - Copies the leading nconv+nrest columns of V, that is,
+   the converged invariant subspace and the restart vectors left by the solver,
+   to the BV that will be used as initial space in the next solve
+*/
+static PetscErrorCode EPSRecycleStore_Private(EPS eps)
+{
+  PetscInt k,m=0;
+
+  PetscFunctionBegin;
+  k = PetscMin(eps->nconv+eps->nrest,eps->ncv);
+  if (eps->categ==EPS_CATEGORY_CONTOUR || eps->isstructured || eps->which==EPS_ALL || !k) PetscFunctionReturn(PETSC_SUCCESS);
+  if (eps->R) PetscCall(BVGetSizes(eps->R,NULL,NULL,&m));
+  if (m<k) {
+    PetscCall(BVDestroy(&eps->R));
+    PetscCall(BVDuplicateResize(eps->V,k,&eps->R));
+    PetscCall(BVSetMatrix(eps->R,NULL,PETSC_FALSE));
+  }
+  PetscCall(BVSetActiveColumns(eps->V,0,k));
+  PetscCall(BVSetActiveColumns(eps->R,0,k));
+  PetscCall(BVCopy(eps->V,eps->R));
+  PetscCall(PetscInfo(eps,"Keeping %" PetscInt_FMT " vectors for recycling (%" PetscInt_FMT " converged)\n",k,eps->nconv));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   EPSRecycleLoad_Private - Uses the subspace kept from the previous solve as the
+   initial space, orthonormalizing it with the current inner product and deflation space
+*/
+static PetscErrorCode EPSRecycleLoad_Private(EPS eps)
+{
+  PetscInt  i,j,k;
+  PetscBool lindep;
+
+  PetscFunctionBegin;
+  PetscCall(BVGetActiveColumns(eps->R,NULL,&k));
+  k = PetscMin(k,eps->ncv);
+  PetscCall(BVSetActiveColumns(eps->R,0,k));
+  PetscCall(BVSetActiveColumns(eps->V,0,k));
+  PetscCall(BVCopy(eps->R,eps->V));
+  for (i=j=0;i<k;i++) {
+    if (j<i) PetscCall(BVCopyColumn(eps->V,i,j));
+    PetscCall(BVOrthonormalizeColumn(eps->V,j,PETSC_FALSE,NULL,&lindep));
+    if (!lindep) j++;
+  }
+  eps->nini = j;
+  eps->nrec = j;
+  PetscCall(PetscInfo(eps,"Using %" PetscInt_FMT " recycled vectors as initial space\n",j));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@
    EPSSolve - Solves the eigensystem.
 
@@ -130,8 +202,11 @@ PetscErrorCode EPSSolve(EPS eps)
 
   /* Call setup */
   PetscCall(EPSSetUp(eps));
+  eps->nrec = 0;
+  if (eps->recycle && eps->R && !eps->nini && eps->categ!=EPS_CATEGORY_CONTOUR && !eps->isstructured && eps->which!=EPS_ALL) PetscCall(EPSRecycleLoad_Private(eps));
   eps->nconv = 0;
   eps->its   = 0;
+  eps->nrest = 0;
   for (i=0;i<eps->ncv;i++) {
     eps->eigr[i]   = 0.0;
     eps->eigi[i]   = 0.0;
@@ -146,6 +221,9 @@ PetscErrorCode EPSSolve(EPS eps)
   PetscCheck(eps->reason,PetscObjectComm((PetscObject)eps),PETSC_ERR_PLIB,"Internal error, solver returned without setting converged reason");
   eps->state = EPS_STATE_SOLVED;
 
+  /* Keep the converged subspace and the restart vectors for the next solve */
+  if (eps->recycle) PetscCall(EPSRecycleStore_Private(eps));
+
   /* Only the first nconv columns contain useful information (except in CISS) */
   PetscCall(BVSetActiveColumns(eps->V,0,eps->nconv));
   if (eps->twosided) PetscCall(BVSetActiveColumns(eps->W,0,eps->nconv));
@@ -204,6 +282,7 @@ PetscErrorCode EPSSolve(EPS eps)
     eps->nds = 0;
   }
   eps->nini = 0;
+  eps->nrec = 0;
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -717,6 +796,121 @@ PetscErrorCode EPSComputeResidualNorm_Private(EPS eps,PetscBool trans,PetscScala
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   EPSComputeError_Scale - Turns the residual norm of an eigenpair into the
+   error of the given type; vecnorm is the 2-norm of the eigenvector.
+*/
+static PetscErrorCode EPSComputeError_Scale(EPS eps,EPSErrorType type,PetscScalar kr,PetscScalar ki,PetscReal vecnorm,PetscReal *error)
+{
+  PetscReal t;
+
+  PetscFunctionBegin;
+  switch (type) {
+    case EPS_ERROR_ABSOLUTE:
+      break;
+    case EPS_ERROR_RELATIVE:
+      *error /= SlepcAbsEigenvalue(kr,ki)*vecnorm;
+      break;
+    case EPS_ERROR_BACKWARD:
+      /* initialization of matrix norms */
+      PetscCall(EPSComputeMatrixNorms(eps));
+      if (!eps->isgeneralized) eps->nrmb = 1.0;
+      t = SlepcAbsEigenvalue(kr,ki);
+      *error /= (eps->nrma+t*eps->nrmb)*vecnorm;
+      break;
+    default:
+      SETERRQ(PetscObjectComm((PetscObject)eps),PETSC_ERR_ARG_OUTOFRANGE,"Invalid error type");
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   EPSComputeResidualNorms_Private - Computes the residual norms of the first n
+   columns of V, which are eigenvectors stored as in BV_GetEigenvector(), with
+   one block product per matrix and a single reduction for all the norms.
+
+   Input Parameters:
+     trans - whether A' must be used instead of A
+     V     - the eigenvectors, eps->V or eps->W
+     n     - the number of columns
+
+   Output Parameter:
+     norm  - array of n residual norms, in the order of the columns
+*/
+static PetscErrorCode EPSComputeResidualNorms_Private(EPS eps,PetscBool trans,BV V,PetscInt n,PetscReal *norm)
+{
+  PetscInt    j,l,k,nmat,rstart,rend;
+  Mat         A,B,MR,MW;
+  BV          R,W;
+  Vec         d;
+  PetscScalar *pd;
+#if !defined(PETSC_USE_COMPLEX)
+  Vec         r,w;
+  PetscScalar ki;
+#endif
+
+  PetscFunctionBegin;
+  PetscCall(STGetNumMatrices(eps->st,&nmat));
+  PetscCall(STGetMatrix(eps->st,0,&A));
+  PetscCall(BVGetActiveColumns(V,&l,&k));
+  PetscCall(BVSetActiveColumns(V,0,n));
+  PetscCall(BVDuplicateResize(V,n,&R));
+  PetscCall(BVDuplicateResize(V,n,&W));
+  if (trans) PetscCall(BVMatMultHermitianTranspose(V,A,R));   /* R=A*X */
+  else PetscCall(BVMatMult(V,A,R));
+  if (nmat>1) {                                               /* W=B*X */
+    PetscCall(STGetMatrix(eps->st,1,&B));
+    if (trans) PetscCall(BVMatMultHermitianTranspose(V,B,W));
+    else PetscCall(BVMatMult(V,B,W));
+  } else PetscCall(BVCopy(V,W));
+
+#if !defined(PETSC_USE_COMPLEX)
+  /* coupling between the real and imaginary parts of complex conjugate pairs */
+  for (j=0;j<n;j++) {
+    if (eps->eigi[j]==0.0) continue;
+    ki = trans? -eps->eigi[j]: eps->eigi[j];
+    PetscCall(BVGetColumn(R,j,&r));
+    PetscCall(BVGetColumn(W,j+1,&w));
+    PetscCall(VecAXPY(r,ki,w));                               /* R_j=A*xr+ki*B*xi */
+    PetscCall(BVRestoreColumn(W,j+1,&w));
+    PetscCall(BVRestoreColumn(R,j,&r));
+    PetscCall(BVGetColumn(R,j+1,&r));
+    PetscCall(BVGetColumn(W,j,&w));
+    PetscCall(VecAXPY(r,-ki,w));                              /* R_j+1=A*xi-ki*B*xr */
+    PetscCall(BVRestoreColumn(W,j,&w));
+    PetscCall(BVRestoreColumn(R,j+1,&r));
+    j++;
+  }
+#endif
+
+  /* R=R-W*diag(k), then the norms of all columns with one reduction */
+  PetscCall(BVGetMat(R,&MR));
+  PetscCall(BVGetMat(W,&MW));
+  PetscCall(MatCreateVecs(MW,&d,NULL));
+  PetscCall(VecGetOwnershipRange(d,&rstart,&rend));
+  PetscCall(VecGetArray(d,&pd));
+  for (j=rstart;j<rend;j++) pd[j-rstart] = trans? -PetscConj(eps->eigr[j]): -eps->eigr[j];
+  PetscCall(VecRestoreArray(d,&pd));
+  PetscCall(MatDiagonalScale(MW,NULL,d));
+  PetscCall(MatAXPY(MR,1.0,MW,SAME_NONZERO_PATTERN));
+  PetscCall(MatGetColumnNorms(MR,NORM_2,norm));
+  PetscCall(BVRestoreMat(W,&MW));
+  PetscCall(BVRestoreMat(R,&MR));
+  PetscCall(VecDestroy(&d));
+  PetscCall(BVDestroy(&R));
+  PetscCall(BVDestroy(&W));
+  PetscCall(BVSetActiveColumns(V,l,k));
+
+#if !defined(PETSC_USE_COMPLEX)
+  for (j=0;j<n;j++) {
+    if (eps->eigi[j]==0.0) continue;
+    norm[j] = norm[j+1] = SlepcAbsEigenvalue(norm[j],norm[j+1]);
+    j++;
+  }
+#endif
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@
    EPSComputeError - Computes the error (based on the residual norm) associated
    with the i-th computed eigenpair.
@@ -741,11 +935,9 @@ PetscErrorCode EPSComputeResidualNorm_Private(EPS eps,PetscBool trans,PetscScala
 @*/
 PetscErrorCode EPSComputeError(EPS eps,PetscInt i,EPSErrorType type,PetscReal *error)
 {
-  Mat            A,B;
   Vec            xr,xi,w[3];
-  PetscReal      t,vecnorm=1.0,errorl;
+  PetscReal      vecnorm=1.0,errorl;
   PetscScalar    kr,ki;
-  PetscBool      flg;
 
   PetscFunctionBegin;
   PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
@@ -783,34 +975,85 @@ PetscErrorCode EPSComputeError(EPS eps,PetscInt i,EPSErrorType type,PetscReal *e
   }
 
   /* compute error */
-  switch (type) {
-    case EPS_ERROR_ABSOLUTE:
-      break;
-    case EPS_ERROR_RELATIVE:
-      *error /= SlepcAbsEigenvalue(kr,ki)*vecnorm;
-      break;
-    case EPS_ERROR_BACKWARD:
-      /* initialization of matrix norms */
-      if (!eps->nrma) {
-        PetscCall(STGetMatrix(eps->st,0,&A));
-        PetscCall(MatHasOperation(A,MATOP_NORM,&flg));
-        PetscCheck(flg,PetscObjectComm((PetscObject)eps),PETSC_ERR_ARG_WRONG,"The computation of backward errors requires a matrix norm operation");
-        PetscCall(MatNorm(A,NORM_INFINITY,&eps->nrma));
-      }
-      if (eps->isgeneralized) {
-        if (!eps->nrmb) {
-          PetscCall(STGetMatrix(eps->st,1,&B));
-          PetscCall(MatHasOperation(B,MATOP_NORM,&flg));
-          PetscCheck(flg,PetscObjectComm((PetscObject)eps),PETSC_ERR_ARG_WRONG,"The computation of backward errors requires a matrix norm operation");
-          PetscCall(MatNorm(B,NORM_INFINITY,&eps->nrmb));
-        }
-      } else eps->nrmb = 1.0;
-      t = SlepcAbsEigenvalue(kr,ki);
-      *error /= (eps->nrma+t*eps->nrmb)*vecnorm;
-      break;
-    default:
-      SETERRQ(PetscObjectComm((PetscObject)eps),PETSC_ERR_ARG_OUTOFRANGE,"Invalid error type");
+  PetscCall(EPSComputeError_Scale(eps,type,kr,ki,vecnorm,error));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSComputeErrors - Computes the errors (based on the residual norm) associated
+   with all the computed eigenpairs.
+
+   Collective
+
+   Input Parameters:
++  eps  - the eigensolver context
+-  type - the type of error to compute
+
+   Output Parameter:
+.  errors - array of length nconv (see EPSGetConverged()) with the errors
+
+   Notes:
+   The result is the same as calling EPSComputeError() for i=0,...,nconv-1, but
+   all residuals are computed at once with a block product with each matrix, and
+   their norms with a single reduction, so this is much faster when many
+   eigenpairs have converged. If the spectral transformation has discarded some
+   of the computed eigenvalues (e.g., STFILTER), the errors are computed one at
+   a time.
+
+   Level: intermediate
+
+.seealso: EPSComputeError(), EPSErrorType, EPSGetConverged()
+@*/
+PetscErrorCode EPSComputeErrors(EPS eps,EPSErrorType type,PetscReal errors[])
+{
+  PetscInt    i,k,l,m,nconv;
+  PetscReal   *rnorm,*lnorm,*vnorm;
+  Mat         X;
+
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscValidLogicalCollectiveEnum(eps,type,2);
+  PetscAssertPointer(errors,3);
+  EPSCheckSolved(eps,1);
+  PetscCall(EPS_GetActualConverged(eps,&nconv));
+  if (!nconv) PetscFunctionReturn(PETSC_SUCCESS);
+  /* structure-preserving solvers build the vectors one at a time, and filters that
+     discard computed eigenvalues (STFILTER, STCONTOUR) may leave wanted pairs beyond
+     the leading nconv columns */
+  k = 0;
+  if (!eps->isstructured) for (i=0;i<nconv;i++) k = PetscMax(k,eps->perm[i]);
+  if (eps->isstructured || k>=nconv) {
+    for (i=0;i<nconv;i++) PetscCall(EPSComputeError(eps,i,type,errors+i));
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
+
+  PetscCall(EPSComputeVectors(eps));
+  PetscCall(PetscMalloc3(nconv,&rnorm,nconv,&lnorm,nconv,&vnorm));
+  PetscCall(EPSComputeResidualNorms_Private(eps,PETSC_FALSE,eps->V,nconv,rnorm));
+
+  /* compute 2-norm of eigenvectors */
+  if (eps->problem_type==EPS_GHEP) {
+    PetscCall(BVGetActiveColumns(eps->V,&l,&m));
+    PetscCall(BVSetActiveColumns(eps->V,0,nconv));
+    PetscCall(BVGetMat(eps->V,&X));
+    PetscCall(MatGetColumnNorms(X,NORM_2,vnorm));
+    PetscCall(BVRestoreMat(eps->V,&X));
+    PetscCall(BVSetActiveColumns(eps->V,l,m));
+  } else for (i=0;i<nconv;i++) vnorm[i] = 1.0;
+
+  /* if two-sided, compute left residual norms and take the maximum */
+  if (eps->twosided) {
+    PetscCall(EPSComputeResidualNorms_Private(eps,PETSC_TRUE,eps->W,nconv,lnorm));
+    for (i=0;i<nconv;i++) rnorm[i] = PetscMax(rnorm[i],lnorm[i]);
+  }
+
+  /* compute errors */
+  for (i=0;i<nconv;i++) {
+    k = eps->perm[i];
+    errors[i] = rnorm[k];
+    PetscCall(EPSComputeError_Scale(eps,type,eps->eigr[k],eps->eigi[k],vnorm[k],errors+i));
   }
+  PetscCall(PetscFree3(rnorm,lnorm,vnorm));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -149,6 +149,8 @@ PetscErrorCode EPSView(EPS eps,PetscViewer viewer)
     if (eps->twosided && eps->problem_type!=EPS_HEP && eps->problem_type!=EPS_GHEP) PetscCall(PetscViewerASCIIPrintf(viewer,"  using two-sided variant (for left eigenvectors)\n"));
     if (eps->purify) PetscCall(PetscViewerASCIIPrintf(viewer,"  postprocessing eigenvectors with purification\n"));
     if (eps->trueres) PetscCall(PetscViewerASCIIPrintf(viewer,"  computing true residuals explicitly\n"));
+    if (eps->recycle) PetscCall(PetscViewerASCIIPrintf(viewer,"  recycling the subspace of the previous solve\n"));
+    if (eps->autosel) PetscCall(PetscViewerASCIIPrintf(viewer,"  solver selected automatically, with trials of %g seconds\n",(double)eps->autotime));
     if (eps->trackall) PetscCall(PetscViewerASCIIPrintf(viewer,"  computing all residuals (for tracking convergence)\n"));
     PetscCall(PetscViewerASCIIPrintf(viewer,"  number of eigenvalues (nev): %" PetscInt_FMT "\n",eps->nev));
     PetscCall(PetscViewerASCIIPrintf(viewer,"  number of column vectors (ncv): %" PetscInt_FMT "\n",eps->ncv));
@@ -164,7 +166,7 @@ PetscErrorCode EPSView(EPS eps,PetscViewer viewer)
       PetscCall(PetscViewerASCIIPrintf(viewer,"relative to the eigenvalue\n"));break;
     case EPS_CONV_NORM:
       PetscCall(PetscViewerASCIIPrintf(viewer,"relative to the eigenvalue and matrix norms\n"));
-      PetscCall(PetscViewerASCIIPrintf(viewer,"  computed matrix norms: norm(A)=%g",(double)eps->nrma));
+      PetscCall(PetscViewerASCIIPrintf(viewer,"  %s matrix norms: norm(A)=%g",(eps->nrmisest || eps->nrmritz)?"estimated":"computed",(double)eps->nrma));
       if (eps->isgeneralized) PetscCall(PetscViewerASCIIPrintf(viewer,", norm(B)=%g",(double)eps->nrmb));
       PetscCall(PetscViewerASCIIPrintf(viewer,"\n"));
       break;
@@ -296,7 +298,7 @@ PetscErrorCode EPSConvergedReasonViewFromOptions(EPS eps)
 
 static PetscErrorCode EPSErrorView_ASCII(EPS eps,EPSErrorType etype,PetscViewer viewer)
 {
-  PetscReal      error;
+  PetscReal      *error;
   PetscScalar    kr,ki;
   PetscInt       i,j,nvals,nconv;
 
@@ -311,13 +313,16 @@ static PetscErrorCode EPSErrorView_ASCII(EPS eps,EPSErrorType etype,PetscViewer
     PetscCall(PetscViewerASCIIPrintf(viewer," No eigenvalues have been found\n\n"));
     PetscFunctionReturn(PETSC_SUCCESS);
   }
+  PetscCall(PetscMalloc1(nconv,&error));
+  PetscCall(EPSComputeErrors(eps,etype,error));
   for (i=0;i<nvals;i++) {
-    PetscCall(EPSComputeError(eps,i,etype,&error));
-    if (error>=5.0*eps->tol) {
+    if (error[i]>=5.0*eps->tol) {
+      PetscCall(PetscFree(error));
       PetscCall(PetscViewerASCIIPrintf(viewer," Problem: some of the first %" PetscInt_FMT " relative errors are higher than the tolerance\n\n",nvals));
       PetscFunctionReturn(PETSC_SUCCESS);
     }
   }
+  PetscCall(PetscFree(error));
   if (eps->which==EPS_ALL) PetscCall(PetscViewerASCIIPrintf(viewer," Found %" PetscInt_FMT " eigenvalues, all of them computed up to the required tolerance:",nvals));
   else PetscCall(PetscViewerASCIIPrintf(viewer," All requested eigenvalues computed up to the required tolerance:"));
   for (i=0;i<=(nvals-1)/8;i++) {
@@ -334,7 +339,7 @@ static PetscErrorCode EPSErrorView_ASCII(EPS eps,EPSErrorType etype,PetscViewer
 
 static PetscErrorCode EPSErrorView_DETAIL(EPS eps,EPSErrorType etype,PetscViewer viewer)
 {
-  PetscReal      error,re,im;
+  PetscReal      *error,re,im;
   PetscScalar    kr,ki;
   PetscInt       i,nconv;
   char           ex[30],sep[]=" ---------------------- --------------------\n";
@@ -354,9 +359,10 @@ static PetscErrorCode EPSErrorView_DETAIL(EPS eps,EPSErrorType etype,PetscViewer
   }
   PetscCall(PetscViewerASCIIPrintf(viewer,"%s            k             %s\n%s",sep,ex,sep));
   PetscCall(EPS_GetActualConverged(eps,&nconv));
+  PetscCall(PetscMalloc1(nconv,&error));
+  PetscCall(EPSComputeErrors(eps,etype,error));
   for (i=0;i<nconv;i++) {
     PetscCall(EPSGetEigenvalue(eps,i,&kr,&ki));
-    PetscCall(EPSComputeError(eps,i,etype,&error));
 #if defined(PETSC_USE_COMPLEX)
     re = PetscRealPart(kr);
     im = PetscImaginaryPart(kr);
@@ -364,16 +370,17 @@ static PetscErrorCode EPSErrorView_DETAIL(EPS eps,EPSErrorType etype,PetscViewer
     re = kr;
     im = ki;
 #endif
-    if (im!=0.0) PetscCall(PetscViewerASCIIPrintf(viewer,"  % 9f%+9fi      %12g\n",(double)re,(double)im,(double)error));
-    else PetscCall(PetscViewerASCIIPrintf(viewer,"    % 12f           %12g\n",(double)re,(double)error));
+    if (im!=0.0) PetscCall(PetscViewerASCIIPrintf(viewer,"  % 9f%+9fi      %12g\n",(double)re,(double)im,(double)error[i]));
+    else PetscCall(PetscViewerASCIIPrintf(viewer,"    % 12f           %12g\n",(double)re,(double)error[i]));
   }
+  PetscCall(PetscFree(error));
   PetscCall(PetscViewerASCIIPrintf(viewer,"%s",sep));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
 static PetscErrorCode EPSErrorView_MATLAB(EPS eps,EPSErrorType etype,PetscViewer viewer)
 {
-  PetscReal      error;
+  PetscReal      *error;
   PetscInt       i,nconv;
   const char     *name;
 
@@ -381,10 +388,10 @@ static PetscErrorCode EPSErrorView_MATLAB(EPS eps,EPSErrorType etype,PetscViewer
   PetscCall(PetscObjectGetName((PetscObject)eps,&name));
   PetscCall(PetscViewerASCIIPrintf(viewer,"Error_%s = [\n",name));
   PetscCall(EPS_GetActualConverged(eps,&nconv));
-  for (i=0;i<nconv;i++) {
-    PetscCall(EPSComputeError(eps,i,etype,&error));
-    PetscCall(PetscViewerASCIIPrintf(viewer,"%18.16e\n",(double)error));
-  }
+  PetscCall(PetscMalloc1(nconv,&error));
+  PetscCall(EPSComputeErrors(eps,etype,error));
+  for (i=0;i<nconv;i++) PetscCall(PetscViewerASCIIPrintf(viewer,"%18.16e\n",(double)error[i]));
+  PetscCall(PetscFree(error));
   PetscCall(PetscViewerASCIIPrintf(viewer,"];\n"));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
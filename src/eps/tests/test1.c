@@ -131,12 +131,18 @@ int main(int argc,char **argv)
       test:
          suffix: 1_ks_trueres
          args: -eps_true_residual
+      test:
+         suffix: 1_ks_estimate_norms
+         args: -eps_conv_norm -eps_estimate_norms
       test:
          suffix: 1_ks_sinvert
          args: -st_type sinvert -eps_target 22
       test:
          suffix: 1_ks_cayley
          args: -st_type cayley -eps_target 22
+      test:
+         suffix: 1_ks_sinvert_refine
+         args: -st_type sinvert -eps_target 22 -st_pc_type ilu -st_pc_factor_levels 4 -st_refine_its 20
       test:
          suffix: 1_lanczos
          args: -eps_type lanczos -eps_lanczos_reorthog full
@@ -240,6 +246,15 @@ int main(int argc,char **argv)
          suffix: 5_hpddm
          args: -eps_type lobpcg -eps_lobpcg_blocksize 3 -st_pc_type lu -st_ksp_type hpddm
          requires: hpddm
+      test:
+         suffix: 5_lobpcg_implicit
+         args: -eps_type lobpcg -eps_lobpcg_blocksize 3 -eps_lobpcg_implicit_gram
+      test:
+         suffix: 5_lobpcg_implicit_recompute
+         args: -eps_type lobpcg -eps_lobpcg_blocksize 3 -eps_lobpcg_implicit_gram -eps_lobpcg_implicit_recompute 3
+      test:
+         suffix: 5_lobpcg_recycle
+         args: -eps_type lobpcg -eps_lobpcg_blocksize 3 -st_ksp_type cg -st_ksp_max_it 5 -st_matsolve_recycle
       test:
          suffix: 5_blopex
          args: -eps_type blopex -eps_conv_abs -st_shift 0.1
@@ -311,6 +326,11 @@ int main(int argc,char **argv)
          args: -eps_gen_hermitian -eps_type lobpcg -eps_max_it 200 -eps_lobpcg_blocksize 6
          requires: !single
          timeoutfactor: 2
+      test:
+         suffix: 9_lobpcg_ghep_implicit
+         args: -eps_gen_hermitian -eps_type lobpcg -eps_max_it 200 -eps_lobpcg_blocksize 6 -eps_lobpcg_implicit_gram
+         requires: !single
+         timeoutfactor: 2
       test:
          suffix: 9_jd_gnhep
          args: -eps_gen_non_hermitian -eps_type jd -eps_target 0 -eps_ncv 64
@@ -108,6 +108,9 @@ int main(int argc,char **argv)
          suffix: 1_ks_gnhep
          args: -eps_gen_non_hermitian
          requires: !__float128
+      test:
+         suffix: 1_ks_adaptive
+         args: -eps_krylovschur_adaptive_restart -eps_krylovschur_adaptive_maxncv 24
       test:
          suffix: 2_cuda_ks
          args: -mat_type aijcusparse
@@ -117,6 +117,12 @@ int main(int argc,char **argv)
       test:
          suffix: 1_krylovschur
          args: -eps_type krylovschur -eps_krylovschur_locking {{0 1}}
+      test:
+         suffix: 1_krylovschur_mixed
+         args: -eps_type krylovschur -eps_krylovschur_mixed_precision
+      test:
+         suffix: 1_auto
+         args: -eps_type auto
       test:
          suffix: 1_scalapack
          requires: scalapack
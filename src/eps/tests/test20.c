@@ -75,6 +75,11 @@ int main(int argc,char **argv)
       args: -n 18 -eps_type {{krylovschur arnoldi gd jd rqcg lobpcg lapack}} -eps_max_it 1500
       output_file: output/test20_1.out
 
+   test:
+      suffix: 1_chfsi
+      args: -n 18 -eps_type chfsi -eps_max_it 1500
+      output_file: output/test20_1.out
+
    test:
       suffix: 1_lanczos
       args: -n 18 -eps_type lanczos -eps_lanczos_reorthog full -eps_max_it 1500
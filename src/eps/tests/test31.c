@@ -136,4 +136,9 @@ int main(int argc,char **argv)
       filter: sed -e "s/0.161982,7.83797/0.162007,7.83897/"
       requires: !single
 
+   test:
+      suffix: 4
+      args: -st_filter_type chebyshev -st_filter_range -0.5,8 -terse
+      requires: !single
+
 TEST*/
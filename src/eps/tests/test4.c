@@ -11,7 +11,8 @@
 static char help[] = "Test the solution of a HEP without calling EPSSetFromOptions (based on ex1.c).\n\n"
   "The command line options are:\n"
   "  -n <n>, where <n> = number of grid subdivisions = matrix dimension.\n"
-  "  -type <eps_type> = eps type to test.\n\n";
+  "  -type <eps_type> = eps type to test.\n"
+  "  -smallest/-largest, to compute the smallest/largest real eigenvalues.\n\n";
 
 #include <slepceps.h>
 
@@ -21,7 +22,7 @@ int main(int argc,char **argv)
   EPS            eps;         /* eigenproblem solver context */
   PetscReal      tol=1000*PETSC_MACHINE_EPSILON;
   PetscInt       n=30,i,Istart,Iend,nev;
-  PetscBool      flg,gd2;
+  PetscBool      flg,gd2,smallest=PETSC_FALSE,largest=PETSC_FALSE;
   char           epstype[30] = "krylovschur";
 
   PetscFunctionBeginUser;
@@ -29,6 +30,8 @@ int main(int argc,char **argv)
 
   PetscCall(PetscOptionsGetInt(NULL,NULL,"-n",&n,NULL));
   PetscCall(PetscOptionsGetString(NULL,NULL,"-type",epstype,sizeof(epstype),NULL));
+  PetscCall(PetscOptionsGetBool(NULL,NULL,"-smallest",&smallest,NULL));
+  PetscCall(PetscOptionsGetBool(NULL,NULL,"-largest",&largest,NULL));
   PetscCall(PetscPrintf(PETSC_COMM_WORLD,"\n1-D Laplacian Eigenproblem, n=%" PetscInt_FMT "\n\n",n));
 
   /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -81,7 +84,8 @@ int main(int argc,char **argv)
   PetscCall(PetscStrcmp(epstype,"lanczos",&flg));
   if (flg) PetscCall(EPSLanczosSetReorthog(eps,EPS_LANCZOS_REORTHOG_LOCAL));
   PetscCall(PetscObjectTypeCompareAny((PetscObject)eps,&flg,EPSRQCG,EPSLOBPCG,""));
-  if (flg) PetscCall(EPSSetWhichEigenpairs(eps,EPS_SMALLEST_REAL));
+  if (flg || smallest) PetscCall(EPSSetWhichEigenpairs(eps,EPS_SMALLEST_REAL));
+  else if (largest) PetscCall(EPSSetWhichEigenpairs(eps,EPS_LARGEST_REAL));
 
   /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
                       Solve the eigensystem
@@ -110,6 +114,9 @@ int main(int argc,char **argv)
       test:
          suffix: 1
          args: -type {{krylovschur subspace arnoldi lanczos gd jd gd2 lapack}}
+      test:
+         suffix: 1_lapack_range
+         args: -type lapack -largest
       test:
          suffix: 1_arpack
          args: -type arpack
@@ -123,8 +130,13 @@ int main(int argc,char **argv)
          args: -type trlan
          requires: trlan
 
-   test:
-      suffix: 2
-      args: -type {{rqcg lobpcg}}
+   testset:
+      output_file: output/test4_2.out
+      test:
+         suffix: 2
+         args: -type {{rqcg lobpcg}}
+      test:
+         suffix: 2_lapack_range
+         args: -type lapack -smallest
 
 TEST*/
@@ -0,0 +1,116 @@
+/*
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+   SLEPc - Scalable Library for Eigenvalue Problem Computations
+   Copyright (c) 2002-, Universitat Politecnica de Valencia, Spain
+
+   This file is part of SLEPc.
+   SLEPc is distributed under a 2-clause BSD license (see LICENSE).
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+*/
+
+static char help[] = "Test STCONTOUR interface functions.\n\n"
+  "The command line options are:\n"
+  "  -n <n>, where <n> = number of grid subdivisions in x dimension.\n"
+  "  -m <m>, where <m> = number of grid subdivisions in y dimension.\n\n";
+
+#include <slepceps.h>
+
+int main(int argc,char **argv)
+{
+  Mat            A;
+  EPS            eps;
+  ST             st;
+  RG             rg;
+  KSP            *ksp;
+  KSPType        ksptype;
+  PetscInt       N,n=10,m,Istart,Iend,II,i,j,ip,npart,nsolve;
+  PetscBool      flag,terse;
+
+  PetscFunctionBeginUser;
+  PetscCall(SlepcInitialize(&argc,&argv,NULL,help));
+  PetscCall(PetscOptionsGetInt(NULL,NULL,"-n",&n,NULL));
+  PetscCall(PetscOptionsGetInt(NULL,NULL,"-m",&m,&flag));
+  if (!flag) m=n;
+  N = n*m;
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD,"\n2-D Laplacian Eigenproblem, N=%" PetscInt_FMT " (%" PetscInt_FMT "x%" PetscInt_FMT " grid)\n\n",N,n,m));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                    Create the 2-D Laplacian
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+  PetscCall(MatCreate(PETSC_COMM_WORLD,&A));
+  PetscCall(MatSetSizes(A,PETSC_DECIDE,PETSC_DECIDE,N,N));
+  PetscCall(MatSetFromOptions(A));
+  PetscCall(MatGetOwnershipRange(A,&Istart,&Iend));
+  for (II=Istart;II<Iend;II++) {
+    i = II/n; j = II-i*n;
+    if (i>0) PetscCall(MatSetValue(A,II,II-n,-1.0,INSERT_VALUES));
+    if (i<m-1) PetscCall(MatSetValue(A,II,II+n,-1.0,INSERT_VALUES));
+    if (j>0) PetscCall(MatSetValue(A,II,II-1,-1.0,INSERT_VALUES));
+    if (j<n-1) PetscCall(MatSetValue(A,II,II+1,-1.0,INSERT_VALUES));
+    PetscCall(MatSetValue(A,II,II,4.0,INSERT_VALUES));
+  }
+  PetscCall(MatAssemblyBegin(A,MAT_FINAL_ASSEMBLY));
+  PetscCall(MatAssemblyEnd(A,MAT_FINAL_ASSEMBLY));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+       Create the eigensolver, with a rational filter for the region
+                     enclosing the interval [0.5,1.3]
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+  PetscCall(EPSCreate(PETSC_COMM_WORLD,&eps));
+  PetscCall(EPSSetOperators(eps,A,NULL));
+  PetscCall(EPSSetProblemType(eps,EPS_HEP));
+  PetscCall(EPSSetType(eps,EPSKRYLOVSCHUR));
+  PetscCall(EPSSetWhichEigenpairs(eps,EPS_LARGEST_REAL));
+  PetscCall(EPSSetDimensions(eps,7,PETSC_DETERMINE,PETSC_DETERMINE));
+  PetscCall(EPSGetST(eps,&st));
+  PetscCall(STSetType(st,STCONTOUR));
+  PetscCall(STContourGetRG(st,&rg));
+  PetscCall(RGSetType(rg,RGELLIPSE));
+  PetscCall(RGEllipseSetParameters(rg,0.9,0.4,1.0));
+  PetscCall(STContourSetSizes(st,16,PETSC_CURRENT));
+  PetscCall(EPSSetFromOptions(eps));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                Solve the problem and display the solution
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+  PetscCall(EPSSolve(eps));
+
+  PetscCall(STContourGetSizes(st,&ip,&npart));
+  PetscCall(STContourGetKSPs(st,&nsolve,&ksp));
+  PetscCheck(nsolve==(ip+npart-1)/npart || nsolve==ip/npart,PETSC_COMM_WORLD,PETSC_ERR_PLIB,"Wrong number of KSP objects");
+  PetscCall(KSPGetType(ksp[0],&ksptype));
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD," Contour filter with %" PetscInt_FMT " integration points, solver %s\n\n",ip,ksptype));
+
+  PetscCall(PetscOptionsHasName(NULL,NULL,"-terse",&terse));
+  if (terse) PetscCall(EPSErrorView(eps,EPS_ERROR_RELATIVE,NULL));
+  else {
+    PetscCall(PetscViewerPushFormat(PETSC_VIEWER_STDOUT_WORLD,PETSC_VIEWER_ASCII_INFO_DETAIL));
+    PetscCall(EPSConvergedReasonView(eps,PETSC_VIEWER_STDOUT_WORLD));
+    PetscCall(EPSErrorView(eps,EPS_ERROR_RELATIVE,PETSC_VIEWER_STDOUT_WORLD));
+    PetscCall(PetscViewerPopFormat(PETSC_VIEWER_STDOUT_WORLD));
+  }
+
+  PetscCall(EPSDestroy(&eps));
+  PetscCall(MatDestroy(&A));
+  PetscCall(SlepcFinalize());
+  return 0;
+}
+
+/*TEST
+
+   testset:
+      args: -terse
+      requires: complex !single
+      output_file: output/test45_1.out
+      test:
+         suffix: 1
+      test:
+         suffix: 1_par
+         nsize: 2
+         args: -st_contour_partitions 2 -st_contour_pc_factor_mat_solver_type mumps
+         requires: complex !single mumps
+
+TEST*/
@@ -0,0 +1,96 @@
+/*
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+   SLEPc - Scalable Library for Eigenvalue Problem Computations
+   Copyright (c) 2002-, Universitat Politecnica de Valencia, Spain
+
+   This file is part of SLEPc.
+   SLEPc is distributed under a 2-clause BSD license (see LICENSE).
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+*/
+
+static char help[] = "Tests subspace recycling in a sequence of perturbed eigenproblems.\n\n"
+  "The command line options are:\n"
+  "  -n <n>, where <n> = number of grid points.\n"
+  "  -steps <s>, where <s> = number of problems in the sequence.\n\n";
+
+#include <slepceps.h>
+
+/*
+   Builds the 1-D Laplacian plus the diagonal perturbation sigma*diag(i/n)
+*/
+static PetscErrorCode BuildMatrix(Mat A,PetscInt n,PetscReal sigma)
+{
+  PetscInt Istart,Iend,i;
+
+  PetscFunctionBeginUser;
+  PetscCall(MatGetOwnershipRange(A,&Istart,&Iend));
+  for (i=Istart;i<Iend;i++) {
+    if (i>0) PetscCall(MatSetValue(A,i,i-1,-1.0,INSERT_VALUES));
+    if (i<n-1) PetscCall(MatSetValue(A,i,i+1,-1.0,INSERT_VALUES));
+    PetscCall(MatSetValue(A,i,i,2.0+sigma*i/n,INSERT_VALUES));
+  }
+  PetscCall(MatAssemblyBegin(A,MAT_FINAL_ASSEMBLY));
+  PetscCall(MatAssemblyEnd(A,MAT_FINAL_ASSEMBLY));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+int main(int argc,char **argv)
+{
+  Mat            A;
+  EPS            eps;
+  PetscInt       n=100,steps=4,s,its,itsnorec=0,itsrec=0;
+  PetscBool      recycle;
+
+  PetscFunctionBeginUser;
+  PetscCall(SlepcInitialize(&argc,&argv,NULL,help));
+  PetscCall(PetscOptionsGetInt(NULL,NULL,"-n",&n,NULL));
+  PetscCall(PetscOptionsGetInt(NULL,NULL,"-steps",&steps,NULL));
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD,"\nSequence of %" PetscInt_FMT " perturbed 1-D Laplacian eigenproblems, n=%" PetscInt_FMT "\n\n",steps,n));
+
+  PetscCall(MatCreate(PETSC_COMM_WORLD,&A));
+  PetscCall(MatSetSizes(A,PETSC_DECIDE,PETSC_DECIDE,n,n));
+  PetscCall(MatSetFromOptions(A));
+
+  PetscCall(EPSCreate(PETSC_COMM_WORLD,&eps));
+  PetscCall(EPSSetProblemType(eps,EPS_HEP));
+  PetscCall(EPSSetWhichEigenpairs(eps,EPS_SMALLEST_REAL));
+  PetscCall(EPSSetDimensions(eps,4,PETSC_DETERMINE,PETSC_DETERMINE));
+  PetscCall(EPSSetTolerances(eps,1e-9,PETSC_CURRENT));
+  PetscCall(EPSSetFromOptions(eps));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        Solve the sequence without and with recycling of the subspace
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+  for (recycle=PETSC_FALSE;;recycle=PETSC_TRUE) {
+    PetscCall(EPSSetRecycle(eps,recycle));
+    for (s=0;s<steps;s++) {
+      PetscCall(BuildMatrix(A,n,0.1*s));
+      PetscCall(EPSSetOperators(eps,A,NULL));
+      PetscCall(EPSSolve(eps));
+      PetscCall(EPSGetIterationNumber(eps,&its));
+      if (recycle) {
+        itsrec += its;
+        PetscCall(PetscPrintf(PETSC_COMM_WORLD," Step %" PetscInt_FMT "\n",s));
+        PetscCall(EPSErrorView(eps,EPS_ERROR_RELATIVE,NULL));
+      } else itsnorec += its;
+    }
+    if (recycle) break;
+  }
+  if (itsrec<itsnorec) PetscCall(PetscPrintf(PETSC_COMM_WORLD," Recycling reduced the total number of iterations\n"));
+  else PetscCall(PetscPrintf(PETSC_COMM_WORLD," Recycling did not reduce the number of iterations (%" PetscInt_FMT " vs %" PetscInt_FMT ")\n",itsrec,itsnorec));
+
+  PetscCall(EPSDestroy(&eps));
+  PetscCall(MatDestroy(&A));
+  PetscCall(SlepcFinalize());
+  return 0;
+}
+
+/*TEST
+
+   test:
+      suffix: 1
+      args: -eps_ncv 12
+      requires: !single
+
+TEST*/
@@ -0,0 +1,106 @@
+/*
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+   SLEPc - Scalable Library for Eigenvalue Problem Computations
+   Copyright (c) 2002-, Universitat Politecnica de Valencia, Spain
+
+   This file is part of SLEPc.
+   SLEPc is distributed under a 2-clause BSD license (see LICENSE).
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+*/
+
+static char help[] = "Test the block correction equation of Jacobi-Davidson against the per-pair one.\n\n"
+  "The command line options are:\n"
+  "  -n <n>, where <n> = number of grid subdivisions in both x and y dimensions.\n\n";
+
+#include <slepceps.h>
+
+int main(int argc,char **argv)
+{
+  Mat            A;
+  EPS            eps;
+  PetscScalar    *eig,lambda;
+  PetscReal      tol=1e-6;
+  PetscInt       N,n=10,Istart,Iend,II,i,j,nev,nconv,its0,its1;
+  PetscBool      block;
+
+  PetscFunctionBeginUser;
+  PetscCall(SlepcInitialize(&argc,&argv,NULL,help));
+  PetscCall(PetscOptionsGetInt(NULL,NULL,"-n",&n,NULL));
+  N = n*n;
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD,"\n2-D Laplacian Eigenproblem, N=%" PetscInt_FMT " (%" PetscInt_FMT "x%" PetscInt_FMT " grid)\n\n",N,n,n));
+
+  PetscCall(MatCreate(PETSC_COMM_WORLD,&A));
+  PetscCall(MatSetSizes(A,PETSC_DECIDE,PETSC_DECIDE,N,N));
+  PetscCall(MatSetFromOptions(A));
+  PetscCall(MatGetOwnershipRange(A,&Istart,&Iend));
+  for (II=Istart;II<Iend;II++) {
+    i = II/n; j = II-i*n;
+    if (i>0) PetscCall(MatSetValue(A,II,II-n,-1.0,INSERT_VALUES));
+    if (i<n-1) PetscCall(MatSetValue(A,II,II+n,-1.0,INSERT_VALUES));
+    if (j>0) PetscCall(MatSetValue(A,II,II-1,-1.0,INSERT_VALUES));
+    if (j<n-1) PetscCall(MatSetValue(A,II,II+1,-1.0,INSERT_VALUES));
+    PetscCall(MatSetValue(A,II,II,4.0,INSERT_VALUES));
+  }
+  PetscCall(MatAssemblyBegin(A,MAT_FINAL_ASSEMBLY));
+  PetscCall(MatAssemblyEnd(A,MAT_FINAL_ASSEMBLY));
+
+  PetscCall(EPSCreate(PETSC_COMM_WORLD,&eps));
+  PetscCall(EPSSetOperators(eps,A,NULL));
+  PetscCall(EPSSetProblemType(eps,EPS_HEP));
+  PetscCall(EPSSetType(eps,EPSJD));
+  PetscCall(EPSSetDimensions(eps,4,PETSC_DETERMINE,PETSC_DETERMINE));
+  PetscCall(EPSJDSetBlockSize(eps,3));
+  PetscCall(EPSSetFromOptions(eps));
+  PetscCall(EPSGetDimensions(eps,&nev,NULL,NULL));
+  PetscCall(PetscMalloc1(nev,&eig));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+              Solve one pair at a time and save the eigenvalues
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+  PetscCall(EPSJDSetBlockCorrection(eps,PETSC_FALSE));
+  PetscCall(EPSSolve(eps));
+  PetscCall(EPSGetConverged(eps,&nconv));
+  PetscCheck(nconv>=nev,PETSC_COMM_WORLD,PETSC_ERR_CONV_FAILED,"The per-pair solve did not converge");
+  PetscCall(EPSGetIterationNumber(eps,&its0));
+  for (i=0;i<nev;i++) PetscCall(EPSGetEigenvalue(eps,i,&eig[i],NULL));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               Solve again with the block correction equation
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+  PetscCall(EPSJDSetBlockCorrection(eps,PETSC_TRUE));
+  PetscCall(EPSJDGetBlockCorrection(eps,&block));
+  PetscCheck(block,PETSC_COMM_WORLD,PETSC_ERR_PLIB,"Block correction equation not set");
+  PetscCall(EPSSolve(eps));
+  PetscCall(EPSGetConverged(eps,&nconv));
+  PetscCheck(nconv>=nev,PETSC_COMM_WORLD,PETSC_ERR_CONV_FAILED,"The block solve did not converge");
+  PetscCall(EPSGetIterationNumber(eps,&its1));
+  PetscCall(PetscInfo(eps,"Outer iterations: %" PetscInt_FMT " per pair, %" PetscInt_FMT " in block mode\n",its0,its1));
+
+  for (i=0;i<nev;i++) {
+    PetscCall(EPSGetEigenvalue(eps,i,&lambda,NULL));
+    PetscCheck(PetscAbsScalar(lambda-eig[i])<=tol*PetscAbsScalar(eig[i]),PETSC_COMM_WORLD,PETSC_ERR_PLIB,"Eigenvalue %" PetscInt_FMT " differs: %g (per pair) %g (block)",i,(double)PetscRealPart(eig[i]),(double)PetscRealPart(lambda));
+  }
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD," The %" PetscInt_FMT " eigenvalues computed with the block correction equation agree with the per-pair ones\n",nev));
+
+  PetscCall(PetscFree(eig));
+  PetscCall(EPSDestroy(&eps));
+  PetscCall(MatDestroy(&A));
+  PetscCall(SlepcFinalize());
+  return 0;
+}
+
+/*TEST
+
+   testset:
+      requires: !single
+      output_file: output/test47_1.out
+      test:
+         suffix: 1
+      test:
+         suffix: 1_hpddm
+         args: -st_ksp_type hpddm
+         requires: hpddm !single
+
+TEST*/
@@ -0,0 +1,85 @@
+/*
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+   SLEPc - Scalable Library for Eigenvalue Problem Computations
+   Copyright (c) 2002-, Universitat Politecnica de Valencia, Spain
+
+   This file is part of SLEPc.
+   SLEPc is distributed under a 2-clause BSD license (see LICENSE).
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+*/
+
+static char help[] = "Tests the adaptive restart of Krylov-Schur on a slowly converging problem.\n\n"
+  "The command line options are:\n"
+  "  -n <n>, where <n> = number of grid points.\n\n";
+
+#include <slepceps.h>
+
+int main(int argc,char **argv)
+{
+  Mat            A;
+  EPS            eps;
+  PetscInt       n=400,Istart,Iend,i,ncv0,ncv,maxncv;
+  PetscBool      adaptive;
+
+  PetscFunctionBeginUser;
+  PetscCall(SlepcInitialize(&argc,&argv,NULL,help));
+  PetscCall(PetscOptionsGetInt(NULL,NULL,"-n",&n,NULL));
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD,"\n1-D Laplacian Eigenproblem, n=%" PetscInt_FMT "\n\n",n));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+         Create the 1-D Laplacian, whose largest eigenvalues are
+                clustered relative to the spectral range
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+  PetscCall(MatCreate(PETSC_COMM_WORLD,&A));
+  PetscCall(MatSetSizes(A,PETSC_DECIDE,PETSC_DECIDE,n,n));
+  PetscCall(MatSetFromOptions(A));
+  PetscCall(MatGetOwnershipRange(A,&Istart,&Iend));
+  for (i=Istart;i<Iend;i++) {
+    if (i>0) PetscCall(MatSetValue(A,i,i-1,-1.0,INSERT_VALUES));
+    if (i<n-1) PetscCall(MatSetValue(A,i,i+1,-1.0,INSERT_VALUES));
+    PetscCall(MatSetValue(A,i,i,2.0,INSERT_VALUES));
+  }
+  PetscCall(MatAssemblyBegin(A,MAT_FINAL_ASSEMBLY));
+  PetscCall(MatAssemblyEnd(A,MAT_FINAL_ASSEMBLY));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        Compute the largest eigenvalues without spectral transformation,
+              so that the restarted Krylov method converges slowly
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+  PetscCall(EPSCreate(PETSC_COMM_WORLD,&eps));
+  PetscCall(EPSSetOperators(eps,A,NULL));
+  PetscCall(EPSSetProblemType(eps,EPS_HEP));
+  PetscCall(EPSSetType(eps,EPSKRYLOVSCHUR));
+  PetscCall(EPSSetWhichEigenpairs(eps,EPS_LARGEST_REAL));
+  PetscCall(EPSSetDimensions(eps,2,12,PETSC_DETERMINE));
+  PetscCall(EPSSetTolerances(eps,PETSC_CURRENT,10000));
+  PetscCall(EPSKrylovSchurSetAdaptiveRestart(eps,PETSC_TRUE,48));
+  PetscCall(EPSSetFromOptions(eps));
+  PetscCall(EPSGetDimensions(eps,NULL,&ncv0,NULL));
+
+  PetscCall(EPSSolve(eps));
+
+  /* the grown value of ncv is kept after the solve */
+  PetscCall(EPSKrylovSchurGetAdaptiveRestart(eps,&adaptive,&maxncv));
+  PetscCall(EPSGetDimensions(eps,NULL,&ncv,NULL));
+  PetscCheck(adaptive,PETSC_COMM_WORLD,PETSC_ERR_PLIB,"The adaptive restart is not active");
+  PetscCheck(ncv>ncv0 && ncv<=maxncv,PETSC_COMM_WORLD,PETSC_ERR_PLIB,"The value of ncv has not grown: ncv=%" PetscInt_FMT ", initial %" PetscInt_FMT ", maximum %" PetscInt_FMT,ncv,ncv0,maxncv);
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD," The number of basis vectors has grown during the solve\n"));
+  PetscCall(EPSErrorView(eps,EPS_ERROR_RELATIVE,NULL));
+
+  PetscCall(EPSDestroy(&eps));
+  PetscCall(MatDestroy(&A));
+  PetscCall(SlepcFinalize());
+  return 0;
+}
+
+/*TEST
+
+   test:
+      suffix: 1
+      args: -st_type shift
+      requires: double
+
+TEST*/
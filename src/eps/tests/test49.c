@@ -0,0 +1,100 @@
+/*
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+   SLEPc - Scalable Library for Eigenvalue Problem Computations
+   Copyright (c) 2002-, Universitat Politecnica de Valencia, Spain
+
+   This file is part of SLEPc.
+   SLEPc is distributed under a 2-clause BSD license (see LICENSE).
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+*/
+
+static char help[] = "Tests the mixed precision solve of Krylov-Schur with a companion matrix.\n\n"
+  "The command line options are:\n"
+  "  -n <n>, where <n> = matrix dimension.\n"
+  "  -companion <0/1>, whether the companion matrix is set or not.\n\n";
+
+#include <slepceps.h>
+
+int main(int argc,char **argv)
+{
+  Mat            A,Alow,C;
+  EPS            eps;
+  PetscInt       n=100,Istart,Iend,i;
+  PetscReal      d;
+  PetscBool      companion=PETSC_TRUE,mixed;
+
+  PetscFunctionBeginUser;
+  PetscCall(SlepcInitialize(&argc,&argv,NULL,help));
+  PetscCall(PetscOptionsGetInt(NULL,NULL,"-n",&n,NULL));
+  PetscCall(PetscOptionsGetBool(NULL,NULL,"-companion",&companion,NULL));
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD,"\nTridiagonal Eigenproblem, n=%" PetscInt_FMT "\n\n",n));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        Create the matrix and a companion with its values rounded
+                         to single precision
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+  PetscCall(MatCreate(PETSC_COMM_WORLD,&A));
+  PetscCall(MatSetSizes(A,PETSC_DECIDE,PETSC_DECIDE,n,n));
+  PetscCall(MatSetFromOptions(A));
+  PetscCall(MatGetOwnershipRange(A,&Istart,&Iend));
+  for (i=Istart;i<Iend;i++) {
+    if (i>0) PetscCall(MatSetValue(A,i,i-1,-1.0,INSERT_VALUES));
+    if (i<n-1) PetscCall(MatSetValue(A,i,i+1,-1.0,INSERT_VALUES));
+    PetscCall(MatSetValue(A,i,i,4.0*i/n+1.0/(i+3),INSERT_VALUES));
+  }
+  PetscCall(MatAssemblyBegin(A,MAT_FINAL_ASSEMBLY));
+  PetscCall(MatAssemblyEnd(A,MAT_FINAL_ASSEMBLY));
+
+  PetscCall(MatDuplicate(A,MAT_DO_NOT_COPY_VALUES,&Alow));
+  for (i=Istart;i<Iend;i++) {
+    if (i>0) PetscCall(MatSetValue(Alow,i,i-1,-1.0,INSERT_VALUES));
+    if (i<n-1) PetscCall(MatSetValue(Alow,i,i+1,-1.0,INSERT_VALUES));
+    d = (PetscReal)(float)(4.0*i/n+1.0/(i+3));
+    PetscCall(MatSetValue(Alow,i,i,d,INSERT_VALUES));
+  }
+  PetscCall(MatAssemblyBegin(Alow,MAT_FINAL_ASSEMBLY));
+  PetscCall(MatAssemblyEnd(Alow,MAT_FINAL_ASSEMBLY));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+           Solve with a first stage on the rounded companion matrix
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+  PetscCall(EPSCreate(PETSC_COMM_WORLD,&eps));
+  PetscCall(EPSSetOperators(eps,A,NULL));
+  PetscCall(EPSSetProblemType(eps,EPS_HEP));
+  PetscCall(EPSSetType(eps,EPSKRYLOVSCHUR));
+  PetscCall(EPSSetWhichEigenpairs(eps,EPS_LARGEST_REAL));
+  PetscCall(EPSSetDimensions(eps,4,PETSC_DETERMINE,PETSC_DETERMINE));
+  PetscCall(EPSKrylovSchurSetMixedPrecision(eps,PETSC_TRUE,PETSC_DETERMINE));
+  if (companion) PetscCall(EPSKrylovSchurSetMixedPrecisionMat(eps,Alow));
+  PetscCall(EPSSetFromOptions(eps));
+
+  PetscCall(EPSSolve(eps));
+
+  PetscCall(EPSKrylovSchurGetMixedPrecision(eps,&mixed,NULL));
+  PetscCall(EPSKrylovSchurGetMixedPrecisionMat(eps,&C));
+  PetscCheck(mixed,PETSC_COMM_WORLD,PETSC_ERR_PLIB,"The mixed precision solve is not active");
+  PetscCheck(C==(companion?Alow:NULL),PETSC_COMM_WORLD,PETSC_ERR_PLIB,"Wrong companion matrix");
+  PetscCall(EPSErrorView(eps,EPS_ERROR_RELATIVE,NULL));
+
+  PetscCall(EPSDestroy(&eps));
+  PetscCall(MatDestroy(&A));
+  PetscCall(MatDestroy(&Alow));
+  PetscCall(SlepcFinalize());
+  return 0;
+}
+
+/*TEST
+
+   testset:
+      args: -st_type shift
+      requires: double
+      output_file: output/test49_1.out
+      test:
+         suffix: 1
+      test:
+         suffix: 1_no_companion
+         args: -companion 0
+
+TEST*/
@@ -106,6 +106,12 @@ int main(int argc,char **argv)
       test:
          suffix: 1_gd2
          args: -eps_type gd -eps_gd_double_expansion
+      test:
+         suffix: 1_jd_refresh
+         args: -eps_type jd -eps_jd_minv 3 -eps_jd_plusk 1 -eps_jd_refresh_lag 5 -eps_jd_refresh_its 20
+      test:
+         suffix: 1_gd_refresh
+         args: -eps_type gd -eps_gd_refresh_shift_tol 0.1
 
    testset:
       args: -eps_nev 3
@@ -0,0 +1,120 @@
+/*
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+   SLEPc - Scalable Library for Eigenvalue Problem Computations
+   Copyright (c) 2002-, Universitat Politecnica de Valencia, Spain
+
+   This file is part of SLEPc.
+   SLEPc is distributed under a 2-clause BSD license (see LICENSE).
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+*/
+
+static char help[] = "Tests EPSComputeErrors() with filters that discard computed eigenvalues.\n\n"
+  "The command line options are:\n"
+  "  -n <n>, where <n> = number of grid subdivisions in x dimension.\n"
+  "  -m <m>, where <m> = number of grid subdivisions in y dimension.\n"
+  "  -contour, to use STCONTOUR instead of STFILTER (complex scalars only).\n\n";
+
+#include <slepceps.h>
+
+int main(int argc,char **argv)
+{
+  Mat            A;
+  EPS            eps;
+  ST             st;
+#if defined(PETSC_USE_COMPLEX)
+  RG             rg;
+#endif
+  PetscInt       N,n=10,m,Istart,Iend,II,i,j,nconv;
+  PetscReal      *errors,error;
+  PetscBool      flag,contour=PETSC_FALSE;
+
+  PetscFunctionBeginUser;
+  PetscCall(SlepcInitialize(&argc,&argv,NULL,help));
+  PetscCall(PetscOptionsGetInt(NULL,NULL,"-n",&n,NULL));
+  PetscCall(PetscOptionsGetInt(NULL,NULL,"-m",&m,&flag));
+  if (!flag) m=n;
+  N = n*m;
+  PetscCall(PetscOptionsGetBool(NULL,NULL,"-contour",&contour,NULL));
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD,"\n2-D Laplacian Eigenproblem, N=%" PetscInt_FMT " (%" PetscInt_FMT "x%" PetscInt_FMT " grid)\n\n",N,n,m));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                    Create the 2-D Laplacian
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+  PetscCall(MatCreate(PETSC_COMM_WORLD,&A));
+  PetscCall(MatSetSizes(A,PETSC_DECIDE,PETSC_DECIDE,N,N));
+  PetscCall(MatSetFromOptions(A));
+  PetscCall(MatGetOwnershipRange(A,&Istart,&Iend));
+  for (II=Istart;II<Iend;II++) {
+    i = II/n; j = II-i*n;
+    if (i>0) PetscCall(MatSetValue(A,II,II-n,-1.0,INSERT_VALUES));
+    if (i<m-1) PetscCall(MatSetValue(A,II,II+n,-1.0,INSERT_VALUES));
+    if (j>0) PetscCall(MatSetValue(A,II,II-1,-1.0,INSERT_VALUES));
+    if (j<n-1) PetscCall(MatSetValue(A,II,II+1,-1.0,INSERT_VALUES));
+    PetscCall(MatSetValue(A,II,II,4.0,INSERT_VALUES));
+  }
+  PetscCall(MatAssemblyBegin(A,MAT_FINAL_ASSEMBLY));
+  PetscCall(MatAssemblyEnd(A,MAT_FINAL_ASSEMBLY));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        Create the eigensolver, with a filter for the interval [0.5,1.3]
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+  PetscCall(EPSCreate(PETSC_COMM_WORLD,&eps));
+  PetscCall(EPSSetOperators(eps,A,NULL));
+  PetscCall(EPSSetProblemType(eps,EPS_HEP));
+  PetscCall(EPSSetType(eps,EPSKRYLOVSCHUR));
+  PetscCall(EPSGetST(eps,&st));
+#if defined(PETSC_USE_COMPLEX)
+  if (contour) {
+    PetscCall(EPSSetWhichEigenpairs(eps,EPS_LARGEST_REAL));
+    PetscCall(EPSSetDimensions(eps,7,PETSC_DETERMINE,PETSC_DETERMINE));
+    PetscCall(STSetType(st,STCONTOUR));
+    PetscCall(STContourGetRG(st,&rg));
+    PetscCall(RGSetType(rg,RGELLIPSE));
+    PetscCall(RGEllipseSetParameters(rg,0.9,0.4,1.0));
+  } else
+#endif
+  {
+    PetscCall(EPSSetWhichEigenpairs(eps,EPS_ALL));
+    PetscCall(EPSSetInterval(eps,0.5,1.3));
+    PetscCall(STSetType(st,STFILTER));
+  }
+  PetscCall(EPSSetFromOptions(eps));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+       Solve the problem and compare the errors computed at once with
+                       the ones of each eigenpair
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+  PetscCall(EPSSolve(eps));
+  PetscCall(EPSGetConverged(eps,&nconv));
+  PetscCall(PetscMalloc1(nconv,&errors));
+  PetscCall(EPSComputeErrors(eps,EPS_ERROR_RELATIVE,errors));
+  for (i=0;i<nconv;i++) {
+    PetscCall(EPSComputeError(eps,i,EPS_ERROR_RELATIVE,&error));
+    PetscCheck(PetscAbsReal(errors[i]-error)<=100*PETSC_MACHINE_EPSILON*PetscMax(1.0,error),PETSC_COMM_WORLD,PETSC_ERR_PLIB,"Wrong error of eigenpair %" PetscInt_FMT ": %g instead of %g",i,(double)errors[i],(double)error);
+  }
+  PetscCall(PetscFree(errors));
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD," The errors computed at once agree with the ones of each eigenpair\n"));
+  PetscCall(EPSErrorView(eps,EPS_ERROR_RELATIVE,NULL));
+
+  PetscCall(EPSDestroy(&eps));
+  PetscCall(MatDestroy(&A));
+  PetscCall(SlepcFinalize());
+  return 0;
+}
+
+/*TEST
+
+   test:
+      suffix: 1
+      args: -st_filter_type chebyshev -st_filter_range -0.5,8
+      requires: !single
+
+   test:
+      suffix: 2
+      args: -contour
+      requires: complex !single
+
+TEST*/
@@ -0,0 +1,135 @@
+/*
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+   SLEPc - Scalable Library for Eigenvalue Problem Computations
+   Copyright (c) 2002-, Universitat Politecnica de Valencia, Spain
+
+   This file is part of SLEPc.
+   SLEPc is distributed under a 2-clause BSD license (see LICENSE).
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+*/
+
+static char help[] = "Tests the automatic selection of the solver and its cache file.\n\n"
+  "The command line options are:\n"
+  "  -n <n>, where <n> = matrix dimension.\n"
+  "  -cache <file>, where <file> = name of the cache file.\n\n";
+
+#include <slepceps.h>
+
+/*
+   Returns the number of lines of the cache file
+*/
+static PetscErrorCode CacheLines(const char *file,PetscInt *nlines)
+{
+  FILE           *fp;
+  char           line[PETSC_MAX_PATH_LEN];
+
+  PetscFunctionBeginUser;
+  *nlines = 0;
+  PetscCall(PetscFOpen(PETSC_COMM_WORLD,file,"r",&fp));
+  while (PETSC_TRUE) {
+    PetscCall(PetscSynchronizedFGets(PETSC_COMM_WORLD,fp,sizeof(line),line));
+    if (!line[0]) break;
+    (*nlines)++;
+  }
+  PetscCall(PetscFClose(PETSC_COMM_WORLD,fp));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   Solves the problem with automatic selection of the solver
+*/
+static PetscErrorCode SolveAuto(Mat A,const char *file,EPS *eps)
+{
+  PetscFunctionBeginUser;
+  PetscCall(EPSCreate(PETSC_COMM_WORLD,eps));
+  PetscCall(EPSSetOperators(*eps,A,NULL));
+  PetscCall(EPSSetProblemType(*eps,EPS_HEP));
+  PetscCall(EPSSetWhichEigenpairs(*eps,EPS_LARGEST_REAL));
+  PetscCall(EPSSetDimensions(*eps,4,PETSC_DETERMINE,PETSC_DETERMINE));
+  PetscCall(EPSSetAutoSelect(*eps,PETSC_TRUE,PETSC_DETERMINE));
+  PetscCall(EPSSetAutoSelectCache(*eps,file));
+  PetscCall(EPSSetFromOptions(*eps));
+  PetscCall(EPSSolve(*eps));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+int main(int argc,char **argv)
+{
+  Mat            A;
+  EPS            eps1,eps2;
+  EPSType        type1,type2;
+  FILE           *fp;
+  char           file[PETSC_MAX_PATH_LEN] = "autoselect.cache";
+  PetscInt       n=100,Istart,Iend,i,nlines;
+  PetscBool      flg;
+
+  PetscFunctionBeginUser;
+  PetscCall(SlepcInitialize(&argc,&argv,NULL,help));
+  PetscCall(PetscOptionsGetInt(NULL,NULL,"-n",&n,NULL));
+  PetscCall(PetscOptionsGetString(NULL,NULL,"-cache",file,sizeof(file),NULL));
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD,"\nTridiagonal Eigenproblem, n=%" PetscInt_FMT "\n\n",n));
+
+  PetscCall(MatCreate(PETSC_COMM_WORLD,&A));
+  PetscCall(MatSetSizes(A,PETSC_DECIDE,PETSC_DECIDE,n,n));
+  PetscCall(MatSetFromOptions(A));
+  PetscCall(MatGetOwnershipRange(A,&Istart,&Iend));
+  for (i=Istart;i<Iend;i++) {
+    if (i>0) PetscCall(MatSetValue(A,i,i-1,0.5,INSERT_VALUES));
+    if (i<n-1) PetscCall(MatSetValue(A,i,i+1,0.5,INSERT_VALUES));
+    PetscCall(MatSetValue(A,i,i,i+1.0,INSERT_VALUES));
+  }
+  PetscCall(MatAssemblyBegin(A,MAT_FINAL_ASSEMBLY));
+  PetscCall(MatAssemblyEnd(A,MAT_FINAL_ASSEMBLY));
+
+  /* start from an empty cache file */
+  PetscCall(PetscFOpen(PETSC_COMM_WORLD,file,"w",&fp));
+  PetscCall(PetscFClose(PETSC_COMM_WORLD,fp));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        First solve: the solver is selected with trials, which depend
+          on the timings, so only check that it is a valid candidate
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+  PetscCall(SolveAuto(A,file,&eps1));
+  PetscCall(EPSGetType(eps1,&type1));
+  if (n<=1000) PetscCall(PetscObjectTypeCompareAny((PetscObject)eps1,&flg,EPSKRYLOVSCHUR,EPSLAPACK,EPSSCALAPACK,EPSELPA,""));
+  else PetscCall(PetscObjectTypeCompareAny((PetscObject)eps1,&flg,EPSKRYLOVSCHUR,EPSGD,EPSLOBPCG,""));
+  PetscCheck(flg,PETSC_COMM_WORLD,PETSC_ERR_PLIB,"The selected solver %s is not one of the candidates",type1);
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD," The selected solver is one of the candidates\n"));
+  PetscCall(CacheLines(file,&nlines));
+  PetscCheck(nlines==1,PETSC_COMM_WORLD,PETSC_ERR_PLIB,"The cache file has %" PetscInt_FMT " entries instead of 1",nlines);
+  PetscCall(EPSErrorView(eps1,EPS_ERROR_RELATIVE,NULL));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+         Second solve: the selection must be taken from the cache file,
+                      without running trials that would add an entry
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+  PetscCall(SolveAuto(A,file,&eps2));
+  PetscCall(EPSGetType(eps2,&type2));
+  PetscCall(PetscStrcmp(type1,type2,&flg));
+  PetscCheck(flg,PETSC_COMM_WORLD,PETSC_ERR_PLIB,"The second solve selected %s instead of %s",type2,type1);
+  PetscCall(CacheLines(file,&nlines));
+  PetscCheck(nlines==1,PETSC_COMM_WORLD,PETSC_ERR_PLIB,"The cache file has %" PetscInt_FMT " entries instead of 1",nlines);
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD," The second selection has been taken from the cache file\n"));
+  PetscCall(EPSErrorView(eps2,EPS_ERROR_RELATIVE,NULL));
+
+  PetscCall(EPSDestroy(&eps1));
+  PetscCall(EPSDestroy(&eps2));
+  PetscCall(MatDestroy(&A));
+  PetscCall(SlepcFinalize());
+  return 0;
+}
+
+/*TEST
+
+   test:
+      suffix: 1
+      requires: !single
+
+   test:
+      suffix: 2
+      args: -n 1200
+      requires: !single
+
+TEST*/
@@ -39,27 +39,33 @@ static PetscErrorCode MFNSetUp_Krylov(MFN mfn)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
-static PetscErrorCode MFNSolve_Krylov(MFN mfn,Vec b,Vec x)
+/*
+   Restarted Arnoldi for the evaluation of f_i(A)*b for several functions f_i at once,
+   all of them sharing the same Krylov basis. The iteration stops when all of them
+   have converged, and the solution for f_i is no longer updated once it converges.
+*/
+static PetscErrorCode MFNSolve_Krylov_Private(MFN mfn,PetscInt nf,FN *fn,Vec b,Vec *x)
 {
-  PetscInt          n=0,m,ld,ldh,j;
+  PetscInt          n=0,m,ld,ldh,i,j,nconv=0;
   PetscBLASInt      m_,inc=1;
   Mat               M,G=NULL,H=NULL;
   Vec               F=NULL;
   PetscScalar       *marray,*farray,*harray;
   const PetscScalar *garray;
-  PetscReal         beta,betaold=0.0,nrm=1.0;
-  PetscBool         breakdown;
+  PetscReal         beta,betaold=0.0,nrm=1.0,maxnrm;
+  PetscBool         breakdown,*conv;
 
   PetscFunctionBegin;
   m  = mfn->ncv;
   ld = m+1;
   PetscCall(MatCreateSeqDense(PETSC_COMM_SELF,ld,m,NULL,&M));
   PetscCall(MatDenseGetArray(M,&marray));
+  PetscCall(PetscCalloc1(nf,&conv));
 
   /* set initial vector to b/||b|| */
   PetscCall(BVInsertVec(mfn->V,0,b));
   PetscCall(BVScaleColumn(mfn->V,0,1.0/mfn->bnorm));
-  PetscCall(VecSet(x,0.0));
+  for (i=0;i<nf;i++) PetscCall(VecSet(x[i],0.0));
 
   /* Restart loop */
   while (mfn->reason == MFN_CONVERGED_ITERATING) {
@@ -91,24 +97,33 @@ static PetscErrorCode MFNSolve_Krylov(MFN mfn,Vec b,Vec x)
       PetscCall(MatPropagateSymmetryOptions(mfn->A,H));
     }
 
-    /* evaluate f(H) */
-    PetscCall(FNEvaluateFunctionMatVec(mfn->fn,H,F));
-
-    /* x += ||b||*V*f(H)*e_1 */
-    PetscCall(VecGetArray(F,&farray));
+    maxnrm = 0.0;
     PetscCall(PetscBLASIntCast(m,&m_));
-    nrm = BLASnrm2_(&m_,farray+n,&inc);   /* relative norm of the update ||u||/||b|| */
-    PetscCall(MFNMonitor(mfn,mfn->its,nrm));
-    for (j=0;j<m;j++) farray[j+n] *= mfn->bnorm;
     PetscCall(BVSetActiveColumns(mfn->V,0,m));
-    PetscCall(BVMultVec(mfn->V,1.0,1.0,x,farray+n));
-    PetscCall(VecRestoreArray(F,&farray));
+    for (i=0;i<nf;i++) {
+      if (conv[i]) continue;
+
+      /* evaluate f(H) */
+      PetscCall(FNEvaluateFunctionMatVec(fn[i],H,F));
+
+      /* x += ||b||*V*f(H)*e_1 */
+      PetscCall(VecGetArray(F,&farray));
+      nrm = BLASnrm2_(&m_,farray+n,&inc);   /* relative norm of the update ||u||/||b|| */
+      maxnrm = PetscMax(maxnrm,nrm);
+      for (j=0;j<m;j++) farray[j+n] *= mfn->bnorm;
+      PetscCall(BVMultVec(mfn->V,1.0,1.0,x[i],farray+n));
+      PetscCall(VecRestoreArray(F,&farray));
+
+      /* check convergence of this function */
+      if (mfn->its>1) {
+        if (m<mfn->ncv || breakdown || beta==0.0 || nrm<mfn->tol) { conv[i] = PETSC_TRUE; nconv++; }
+      }
+    }
+    PetscCall(MFNMonitor(mfn,mfn->its,maxnrm));
 
     /* check convergence */
     if (mfn->its >= mfn->max_it) mfn->reason = MFN_DIVERGED_ITS;
-    if (mfn->its>1) {
-      if (m<mfn->ncv || breakdown || beta==0.0 || nrm<mfn->tol) mfn->reason = MFN_CONVERGED_TOL;
-    }
+    if (nconv==nf) mfn->reason = MFN_CONVERGED_TOL;
 
     /* restart with vector v_{m+1} */
     if (mfn->reason == MFN_CONVERGED_ITERATING) {
@@ -118,6 +133,7 @@ static PetscErrorCode MFNSolve_Krylov(MFN mfn,Vec b,Vec x)
     }
   }
 
+  PetscCall(PetscFree(conv));
   PetscCall(MatDestroy(&H));
   PetscCall(MatDestroy(&G));
   PetscCall(VecDestroy(&F));
@@ -126,10 +142,350 @@ static PetscErrorCode MFNSolve_Krylov(MFN mfn,Vec b,Vec x)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode MFNSolve_Krylov(MFN mfn,Vec b,Vec x)
+{
+  PetscFunctionBegin;
+  PetscCall(MFNSolve_Krylov_Private(mfn,1,&mfn->fn,b,&x));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode MFNSolveTimes_Krylov(MFN mfn,PetscInt nt,const PetscScalar *t,Vec b,Vec *x)
+{
+  PetscInt       i;
+  PetscScalar    alpha,beta;
+  FN             *fn;
+
+  PetscFunctionBegin;
+  PetscCall(FNGetScale(mfn->fn,&alpha,&beta));
+  PetscCall(PetscMalloc1(nt,&fn));
+  for (i=0;i<nt;i++) {
+    PetscCall(FNDuplicate(mfn->fn,PetscObjectComm((PetscObject)mfn->fn),&fn[i]));
+    PetscCall(FNSetScale(fn[i],t[i]*alpha,beta));
+  }
+  PetscCall(MFNSolve_Krylov_Private(mfn,nt,fn,b,x));
+  for (i=0;i<nt;i++) PetscCall(FNDestroy(&fn[i]));
+  PetscCall(PetscFree(fn));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   Block version of MFNSolve_Krylov: the columns of B are processed in blocks of bs
+   columns, each of them with a restarted block Arnoldi method. The block Hessenberg
+   matrix is obtained from the coefficients of BVOrthogonalize(), and the blocks of
+   consecutive restarts are glued together as in the single-vector case.
+*/
+static PetscErrorCode MFNSolveMat_Krylov(MFN mfn,Mat B,Mat X)
+{
+  PetscInt           s,bs,k,m,mb,ld,nh,ldh,ini,i,j,its,maxits=0;
+  PetscBLASInt       k_,mk_,ldh_,bs_;
+  BV                 V,W,Y;
+  Mat                R,R0,G=NULL,H=NULL,F=NULL,C=NULL;
+  Vec                v;
+  PetscScalar        *harray,*carray,*hsub,*hsubold,sone=1.0,szero=0.0;
+  const PetscScalar  *rarray,*garray,*farray,*r0array;
+  PetscReal          nrm,nrmh,nrmsub;
+  PetscBool          breakdown;
+  MFNConvergedReason reason=MFN_CONVERGED_TOL;
+
+  PetscFunctionBegin;
+  PetscCall(MatGetSize(B,NULL,&s));
+  bs = PetscMin(s,PetscMax(1,mfn->ncv/2));
+  m  = PetscMax(2,mfn->ncv/bs);   /* number of block steps */
+  ld = (m+1)*bs;
+  PetscCall(BVDuplicateResize(mfn->V,ld,&V));
+  PetscCall(BVDuplicateResize(mfn->V,bs,&W));
+  PetscCall(BVDuplicateResize(mfn->V,bs,&Y));
+  PetscCall(MatCreateSeqDense(PETSC_COMM_SELF,ld,ld,NULL,&R));
+  PetscCall(MatCreateSeqDense(PETSC_COMM_SELF,bs,bs,NULL,&R0));
+  PetscCall(PetscMalloc2(bs*bs,&hsub,bs*bs,&hsubold));
+
+  for (ini=0;ini<s;ini+=bs) {
+    k = PetscMin(bs,s-ini);
+
+    /* orthonormalize the block of right-hand sides, B = V_0*R0 */
+    for (j=0;j<k;j++) {
+      PetscCall(MatDenseGetColumnVecRead(B,ini+j,&v));
+      PetscCall(BVInsertVec(V,j,v));
+      PetscCall(MatDenseRestoreColumnVecRead(B,ini+j,&v));
+    }
+    PetscCall(BVSetActiveColumns(V,0,k));
+    PetscCall(MatZeroEntries(R0));
+    PetscCall(BVOrthogonalize(V,R0));
+    PetscCall(MatNorm(R0,NORM_FROBENIUS,&mfn->bnorm));
+    if (mfn->bnorm==0.0) {
+      for (j=0;j<k;j++) {
+        PetscCall(MatDenseGetColumnVecWrite(X,ini+j,&v));
+        PetscCall(VecSet(v,0.0));
+        PetscCall(MatDenseRestoreColumnVecWrite(X,ini+j,&v));
+      }
+      continue;
+    }
+    PetscCall(BVSetActiveColumns(W,0,k));
+    PetscCall(BVSetActiveColumns(Y,0,k));
+    nh  = 0;
+    its = 0;
+    mfn->reason = MFN_CONVERGED_ITERATING;
+
+    /* Restart loop */
+    while (mfn->reason == MFN_CONVERGED_ITERATING) {
+      its++;
+
+      /* compute block Arnoldi factorization, A*V_j = sum_i V_i*H_ij */
+      PetscCall(MatZeroEntries(R));
+      breakdown = PETSC_FALSE;
+      for (mb=0;mb<m && !breakdown;mb++) {
+        PetscCall(BVSetActiveColumns(V,mb*k,(mb+1)*k));
+        PetscCall(BVMatMult(V,mfn->A,W));
+        PetscCall(BVSetActiveColumns(V,(mb+1)*k,(mb+2)*k));
+        PetscCall(BVCopy(W,V));
+        PetscCall(BVOrthogonalize(V,R));
+        PetscCall(MatDenseGetArrayRead(R,&rarray));
+        nrmh = 0.0; nrmsub = 0.0;
+        for (j=0;j<k;j++) {
+          for (i=0;i<(mb+1)*k;i++) nrmh += PetscRealPart(rarray[i+((mb+1)*k+j)*ld]*PetscConj(rarray[i+((mb+1)*k+j)*ld]));
+          for (i=(mb+1)*k;i<(mb+2)*k;i++) nrmsub += PetscRealPart(rarray[i+((mb+1)*k+j)*ld]*PetscConj(rarray[i+((mb+1)*k+j)*ld]));
+        }
+        PetscCall(MatDenseRestoreArrayRead(R,&rarray));
+        if (PetscSqrtReal(nrmsub)<=100*PETSC_MACHINE_EPSILON*PetscSqrtReal(nrmh+nrmsub)) breakdown = PETSC_TRUE;
+      }
+
+      /* save previous Hessenberg matrix in G; allocate new storage for H and f(H) */
+      if (its>1) { G = H; H = NULL; }
+      ldh = nh+mb*k;
+      PetscCall(MFN_CreateDenseMat(ldh,&H));
+      PetscCall(MFN_CreateDenseMat(ldh,&F));
+
+      /* glue together the previous H and the new block Hessenberg H(i,j) = R(i,j+k) */
+      PetscCall(MatDenseGetArray(H,&harray));
+      PetscCall(PetscArrayzero(harray,ldh*ldh));
+      PetscCall(MatDenseGetArrayRead(R,&rarray));
+      for (j=0;j<mb*k;j++) PetscCall(PetscArraycpy(harray+nh+(j+nh)*ldh,rarray+(j+k)*ld,mb*k));
+      for (j=0;j<k;j++) PetscCall(PetscArraycpy(hsub+j*k,rarray+mb*k+(j+mb*k)*ld,k));
+      PetscCall(MatDenseRestoreArrayRead(R,&rarray));
+      if (its>1) {
+        PetscCall(MatDenseGetArrayRead(G,&garray));
+        for (j=0;j<nh;j++) PetscCall(PetscArraycpy(harray+j*ldh,garray+j*nh,nh));
+        PetscCall(MatDenseRestoreArrayRead(G,&garray));
+        PetscCall(MatDestroy(&G));
+        for (j=0;j<k;j++) PetscCall(PetscArraycpy(harray+nh+(nh-k+j)*ldh,hsubold+j*k,k));
+      }
+      PetscCall(MatDenseRestoreArray(H,&harray));
+
+      if (its==1) {
+        /* set symmetry flag of H from A */
+        PetscCall(MatPropagateSymmetryOptions(mfn->A,H));
+      }
+
+      /* evaluate f(H) */
+      PetscCall(FNEvaluateFunctionMat(mfn->fn,H,F));
+
+      /* Y += V*C, with C = f(H)(nh:ldh,0:k)*R0 */
+      PetscCall(MatDestroy(&C));
+      PetscCall(MatCreateSeqDense(PETSC_COMM_SELF,mb*k,k,NULL,&C));
+      PetscCall(MatDenseGetArrayRead(F,&farray));
+      PetscCall(MatDenseGetArrayRead(R0,&r0array));
+      PetscCall(MatDenseGetArray(C,&carray));
+      PetscCall(PetscBLASIntCast(k,&k_));
+      PetscCall(PetscBLASIntCast(mb*k,&mk_));
+      PetscCall(PetscBLASIntCast(ldh,&ldh_));
+      PetscCall(PetscBLASIntCast(bs,&bs_));
+      PetscCallBLAS("BLASgemm",BLASgemm_("N","N",&mk_,&k_,&k_,&sone,farray+nh,&ldh_,r0array,&bs_,&szero,carray,&mk_));
+      nrm = 0.0;   /* relative norm of the update */
+      for (j=0;j<k;j++) for (i=0;i<mb*k;i++) nrm += PetscRealPart(farray[nh+i+j*ldh]*PetscConj(farray[nh+i+j*ldh]));
+      nrm = PetscSqrtReal(nrm/k);
+      PetscCall(MatDenseRestoreArray(C,&carray));
+      PetscCall(MatDenseRestoreArrayRead(R0,&r0array));
+      PetscCall(MatDenseRestoreArrayRead(F,&farray));
+      PetscCall(MFNMonitor(mfn,its,nrm));
+      PetscCall(BVSetActiveColumns(V,0,mb*k));
+      PetscCall(BVMult(Y,1.0,(its==1)?0.0:1.0,V,C));
+
+      /* check convergence */
+      if (its >= mfn->max_it) mfn->reason = MFN_DIVERGED_ITS;
+      if (breakdown || (its>1 && nrm<mfn->tol)) mfn->reason = MFN_CONVERGED_TOL;
+
+      /* restart with block V_{m+1} */
+      if (mfn->reason == MFN_CONVERGED_ITERATING) {
+        for (j=0;j<k;j++) PetscCall(BVCopyColumn(V,mb*k+j,j));
+        PetscCall(PetscArraycpy(hsubold,hsub,k*k));
+        nh += mb*k;
+      }
+    }
+    maxits = PetscMax(maxits,its);
+
+    for (j=0;j<k;j++) {
+      PetscCall(MatDenseGetColumnVecWrite(X,ini+j,&v));
+      PetscCall(BVCopyVec(Y,j,v));
+      PetscCall(MatDenseRestoreColumnVecWrite(X,ini+j,&v));
+    }
+    PetscCall(MatDestroy(&H));
+    if (mfn->reason<0) {
+      /* keep going with the remaining columns, the first failure is reported */
+      PetscCall(PetscInfo(mfn,"Columns %" PetscInt_FMT " to %" PetscInt_FMT " did not converge (reason %s)\n",ini,ini+k-1,MFNConvergedReasons[mfn->reason]));
+      if (reason>0) reason = mfn->reason;
+    }
+  }
+  mfn->its    = maxits;
+  mfn->reason = reason;
+
+  PetscCall(MatDestroy(&C));
+  PetscCall(MatDestroy(&F));
+  PetscCall(MatDestroy(&R));
+  PetscCall(MatDestroy(&R0));
+  PetscCall(PetscFree2(hsub,hsubold));
+  PetscCall(BVDestroy(&V));
+  PetscCall(BVDestroy(&W));
+  PetscCall(BVDestroy(&Y));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   Time stepping for x(t) = sum_{k=0}^p t^k*phi_k(t*A)*b_k, as in phipm [Niesen and
+   Wright, ACM Trans. Math. Softw. 38(3), 2012]. At time s, the derivatives w_j of x
+   are computed with the recurrence w_j = A*w_{j-1} + sum_l s^l/l!*b_{j+l}, and then
+
+      x(s+h) = sum_{j=0}^{p-1} h^j/j!*w_j + h^p*phi_p(h*A)*w_p,
+
+   where the last term is approximated in a Krylov subspace generated with w_p. The
+   small phi-functions are obtained from the exponential of the augmented matrix
+
+      [ h*H  e_1  0 ]
+      [  0    0   I ]
+      [  0    0   0 ]
+
+   of order m+p+1, whose last column contains phi_{p+1}(h*H)*e_1 for the error estimate.
+*/
+static PetscErrorCode MFNSolvePhi_Krylov(MFN mfn,PetscInt p,Vec *b,Vec x)
+{
+  PetscInt          m,mb,ld,mx,i,j,l,ireject,mxrej=10;
+  Vec               *w=NULL,wp;
+  Mat               M,K=NULL,E=NULL;
+  FN                fn;
+  PetscScalar       *marray,*karray,*coef,*y,t,sfactor,sgn,h,s;
+  const PetscScalar *earray;
+  PetscReal         tol,t_out,t_now=0.0,t_step,t_new,beta,bw,nrmx,nrmref,err,tolloc=0.0,fac,gamma=0.9;
+  PetscBool         breakdown,failed=PETSC_FALSE;
+
+  PetscFunctionBegin;
+  m   = mfn->ncv;
+  ld  = m+1;
+  tol = mfn->tol;
+  PetscCall(FNGetScale(mfn->fn,&t,&sfactor));
+  PetscCall(FNDuplicate(mfn->fn,PetscObjectComm((PetscObject)mfn->fn),&fn));
+  PetscCall(FNSetScale(fn,1.0,1.0));
+  t_out = PetscAbsScalar(t);
+  sgn   = (t_out==0.0)? 1.0: t/t_out;
+  t_new = t_out;
+
+  if (b[0]!=x) PetscCall(VecCopy(b[0],x));
+  if (p) PetscCall(VecDuplicateVecs(x,p,&w));
+  PetscCall(PetscMalloc2(PetscMax(p,1),&coef,m+p+1,&y));
+  PetscCall(MatCreateSeqDense(PETSC_COMM_SELF,ld,m,NULL,&M));
+  if (t_out==0.0) mfn->reason = MFN_CONVERGED_TOL;
+
+  while (mfn->reason == MFN_CONVERGED_ITERATING) {
+    mfn->its++;
+    s = sgn*t_now;
+
+    /* derivatives of the solution at the current time */
+    for (j=1;j<=p;j++) {
+      PetscCall(MatMult(mfn->A,j==1?x:w[j-2],w[j-1]));
+      coef[0] = 1.0;
+      for (l=1;l<=p-j;l++) coef[l] = coef[l-1]*s/(PetscReal)l;
+      PetscCall(VecMAXPY(w[j-1],p-j+1,coef,b+j));
+    }
+    wp = p? w[p-1]: x;
+    PetscCall(VecNorm(wp,NORM_2,&bw));
+    PetscCall(VecNorm(x,NORM_2,&nrmx));
+
+    t_step = PetscMin(t_out-t_now,t_new);
+    if (bw==0.0) {
+      /* the solution is a polynomial from here on */
+      mb  = 0;
+      err = 0.0;
+      t_step = t_out-t_now;
+    } else {
+      /* Krylov basis for w_p */
+      PetscCall(BVInsertVec(mfn->V,0,wp));
+      PetscCall(BVScaleColumn(mfn->V,0,1.0/bw));
+      mb = m;
+      PetscCall(MatDenseGetArray(M,&marray));
+      PetscCall(BVMatArnoldi(mfn->V,mfn->A,M,0,&mb,&beta,&breakdown));
+      if (breakdown || beta==0.0) t_step = t_out-t_now;
+
+      /* find an acceptable step size, reusing the Krylov basis */
+      mx = mb+p+1;
+      PetscCall(MFN_CreateDenseMat(mx,&K));
+      PetscCall(MFN_CreateDenseMat(mx,&E));
+      for (ireject=0;;ireject++) {
+        h = sgn*t_step;
+        PetscCall(MatDenseGetArray(K,&karray));
+        PetscCall(PetscArrayzero(karray,mx*mx));
+        for (j=0;j<mb;j++) for (i=0;i<PetscMin(j+2,mb);i++) karray[i+j*mx] = h*marray[i+j*ld];
+        karray[mb*mx] = 1.0;
+        for (j=1;j<=p;j++) karray[mb+j-1+(mb+j)*mx] = 1.0;
+        PetscCall(MatDenseRestoreArray(K,&karray));
+        PetscCall(FNEvaluateFunctionMat(fn,K,E));
+
+        /* y = phi_p(h*H)*e_1 and error estimate from phi_{p+1}(h*H)*e_1 */
+        PetscCall(MatDenseGetArrayRead(E,&earray));
+        j = p? mb+p-1: 0;
+        for (i=0;i<mb;i++) y[i] = earray[i+j*mx];
+        err = (breakdown || beta==0.0)? 0.0: bw*beta*PetscPowRealInt(t_step,p+1)*PetscAbsScalar(earray[mb-1+(mb+p)*mx]);
+        PetscCall(MatDenseRestoreArrayRead(E,&earray));
+        nrmref = PetscMax(nrmx,bw*PetscPowRealInt(t_step,p)*PetscAbsScalar(y[0]));
+        tolloc = tol*nrmref*t_step/t_out;
+        if (err<=tolloc) break;
+        if (ireject==mxrej) {
+          PetscCall(PetscInfo(mfn,"Error estimate %g above the local tolerance %g after %" PetscInt_FMT " step size reductions\n",(double)err,(double)tolloc,mxrej));
+          failed = PETSC_TRUE;
+          break;
+        }
+        fac = gamma*PetscPowReal(tolloc/err,1.0/(mb+1));
+        t_step *= PetscMax(0.2,fac);
+      }
+      PetscCall(MatDenseRestoreArray(M,&marray));
+    }
+
+    /* x = sum_{j=0}^{p-1} h^j/j!*w_j + h^p*phi_p(h*A)*w_p */
+    h = sgn*t_step;
+    if (p>1) {
+      coef[0] = h;
+      for (j=1;j<p-1;j++) coef[j] = coef[j-1]*h/(PetscReal)(j+1);
+      PetscCall(VecMAXPY(x,p-1,coef,w));
+    }
+    if (mb) {
+      PetscCall(BVSetActiveColumns(mfn->V,0,mb));
+      PetscCall(BVMultVec(mfn->V,bw*PetscPowScalarInt(h,p),p?1.0:0.0,x,y));
+    }
+
+    /* check convergence and propose the next step size */
+    t_now += t_step;
+    mfn->errest = (nrmx>0.0)? err/nrmx: err;
+    PetscCall(MFNMonitor(mfn,mfn->its,mfn->errest));
+    if (failed) mfn->reason = MFN_DIVERGED_BREAKDOWN;
+    else if (t_now>=t_out) mfn->reason = MFN_CONVERGED_TOL;
+    else if (mfn->its>=mfn->max_it) mfn->reason = MFN_DIVERGED_ITS;
+    else t_new = (err==0.0)? 5.0*t_step: t_step*PetscMin(5.0,gamma*PetscPowReal(tolloc/err,1.0/(mb+1)));
+  }
+  PetscCall(VecScale(x,sfactor));
+
+  PetscCall(MatDestroy(&K));
+  PetscCall(MatDestroy(&E));
+  PetscCall(MatDestroy(&M));
+  PetscCall(PetscFree2(coef,y));
+  if (p) PetscCall(VecDestroyVecs(p,&w));
+  PetscCall(FNDestroy(&fn));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 SLEPC_EXTERN PetscErrorCode MFNCreate_Krylov(MFN mfn)
 {
   PetscFunctionBegin;
   mfn->ops->solve          = MFNSolve_Krylov;
+  mfn->ops->solvephi       = MFNSolvePhi_Krylov;
+  mfn->ops->solvemat       = MFNSolveMat_Krylov;
+  mfn->ops->solvetimes     = MFNSolveTimes_Krylov;
   mfn->ops->setup          = MFNSetUp_Krylov;
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -126,6 +126,314 @@ PetscErrorCode MFNSolveTranspose(MFN mfn,Vec b,Vec x)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*@
+   MFNSolvePhi - Computes a linear combination of phi-functions as needed
+   in exponential integrators. Given vectors b_0,...,b_p, the vector
+   x = phi_0(t*A)*b_0 + t*phi_1(t*A)*b_1 + ... + t^p*phi_p(t*A)*b_p is
+   returned, where t is the scaling factor of the argument of the FN.
+
+   Collective
+
+   Input Parameters:
++  mfn - matrix function context obtained from MFNCreate()
+.  p   - the highest index of the phi-functions
+-  b   - array of p+1 vectors b_0,...,b_p
+
+   Output Parameter:
+.  x   - the solution (this may be the same vector as b_0, but not any of
+         the other vectors of b)
+
+   Notes:
+   The function of mfn must be of type FNEXP. The scaling factors of the
+   FN are interpreted as follows: the argument scaling gives the time t,
+   and the result is multiplied by the result scaling, see FNSetScale().
+
+   The whole linear combination is computed at once, without doing p+1
+   separate solves. At each time step, the derivatives of the solution are
+   obtained with p matrix-vector products, and a single Krylov basis is built
+   for the remaining phi_p term. The small matrix functions are computed from
+   the exponential of an augmented Hessenberg matrix, which also provides an
+   error estimate that is used to select the step size. The maximum number of
+   time steps is the maximum number of iterations set in MFNSetTolerances(),
+   and the dimension of the Krylov basis is taken from MFNSetDimensions().
+
+   This is currently available only in the MFNKRYLOV solver.
+
+   Level: intermediate
+
+.seealso: MFNSolve(), MFNSetFN(), FNSetScale(), FNPHI
+@*/
+PetscErrorCode MFNSolvePhi(MFN mfn,PetscInt p,Vec b[],Vec x)
+{
+  PetscInt       k;
+  PetscReal      nrm;
+  PetscBool      isexp;
+
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(mfn,MFN_CLASSID,1);
+  PetscValidLogicalCollectiveInt(mfn,p,2);
+  PetscCheck(p>=0,PetscObjectComm((PetscObject)mfn),PETSC_ERR_ARG_OUTOFRANGE,"Index p cannot be negative");
+  PetscAssertPointer(b,3);
+  for (k=0;k<=p;k++) {
+    PetscValidHeaderSpecific(b[k],VEC_CLASSID,3);
+    PetscCheckSameComm(mfn,1,b[k],3);
+    PetscCheck(k==0 || b[k]!=x,PetscObjectComm((PetscObject)mfn),PETSC_ERR_ARG_IDN,"The solution vector cannot be the same as b[%" PetscInt_FMT "]",k);
+  }
+  PetscValidHeaderSpecific(x,VEC_CLASSID,4);
+  PetscCheckSameComm(mfn,1,x,4);
+  PetscCall(VecSetErrorIfLocked(x,4));
+  mfn->transpose_solve = PETSC_FALSE;
+
+  /* call setup */
+  PetscCall(MFNSetUp(mfn));
+  PetscCall(PetscObjectTypeCompare((PetscObject)mfn->fn,FNEXP,&isexp));
+  PetscCheck(isexp,PetscObjectComm((PetscObject)mfn),PETSC_ERR_SUP,"MFNSolvePhi() requires the function to be the exponential");
+  mfn->its = 0;
+
+  PetscCall(MFNViewFromOptions(mfn,NULL,"-mfn_view_pre"));
+
+  /* check nonzero right-hand side */
+  mfn->bnorm = 0.0;
+  for (k=0;k<=p;k++) {
+    PetscCall(VecNorm(b[k],NORM_2,&nrm));
+    mfn->bnorm = PetscMax(mfn->bnorm,nrm);
+  }
+  PetscCheck(mfn->bnorm,PetscObjectComm((PetscObject)mfn),PETSC_ERR_ARG_WRONG,"Cannot pass all zero b vectors to MFNSolvePhi()");
+
+  /* call solver */
+  PetscCall(PetscLogEventBegin(MFN_Solve,mfn,b[0],x,0));
+  for (k=0;k<=p;k++) if (b[k]!=x) PetscCall(VecLockReadPush(b[k]));
+  PetscUseTypeMethod(mfn,solvephi,p,b,x);
+  for (k=0;k<=p;k++) if (b[k]!=x) PetscCall(VecLockReadPop(b[k]));
+  PetscCall(PetscLogEventEnd(MFN_Solve,mfn,b[0],x,0));
+
+  PetscCheck(mfn->reason,PetscObjectComm((PetscObject)mfn),PETSC_ERR_PLIB,"Internal error, solver returned without setting converged reason");
+
+  PetscCheck(!mfn->errorifnotconverged || mfn->reason>=0,PetscObjectComm((PetscObject)mfn),PETSC_ERR_NOT_CONVERGED,"MFNSolvePhi has not converged");
+
+  /* various viewers */
+  PetscCall(MFNViewFromOptions(mfn,NULL,"-mfn_view"));
+  PetscCall(MFNConvergedReasonViewFromOptions(mfn));
+  PetscCall(MatViewFromOptions(mfn->A,(PetscObject)mfn,"-mfn_view_mat"));
+  PetscCall(VecViewFromOptions(x,(PetscObject)mfn,"-mfn_view_solution"));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   MFNSolveMat_Default - Solves the problem for each column of B separately
+*/
+static PetscErrorCode MFNSolveMat_Default(MFN mfn,Mat B,Mat X)
+{
+  PetscInt           j,n,its=0;
+  MFNConvergedReason reason=MFN_CONVERGED_TOL;
+  Vec                b,x;
+
+  PetscFunctionBegin;
+  PetscCall(MatGetSize(B,NULL,&n));
+  for (j=0;j<n;j++) {
+    PetscCall(MatDenseGetColumnVecRead(B,j,&b));
+    PetscCall(MatDenseGetColumnVecWrite(X,j,&x));
+    PetscCall(VecNorm(b,NORM_2,&mfn->bnorm));
+    if (mfn->bnorm==0.0) PetscCall(VecSet(x,0.0));
+    else {
+      mfn->its    = 0;
+      mfn->reason = MFN_CONVERGED_ITERATING;
+      PetscUseTypeMethod(mfn,solve,b,x);
+      its = PetscMax(its,mfn->its);
+      if (reason>0) reason = mfn->reason;   /* keep the first failure */
+    }
+    PetscCall(MatDenseRestoreColumnVecWrite(X,j,&x));
+    PetscCall(MatDenseRestoreColumnVecRead(B,j,&b));
+  }
+  mfn->its    = its;
+  mfn->reason = reason;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   MFNSolveMat - Solves the matrix function problem for several vectors at
+   once. Given a dense matrix B, the matrix X = f(A)*B is returned.
+
+   Collective
+
+   Input Parameters:
++  mfn - matrix function context obtained from MFNCreate()
+-  B   - dense matrix whose columns are the right hand side vectors
+
+   Output Parameter:
+.  X   - dense matrix with the solution, with the same layout as B
+
+   Notes:
+   B and X must be different matrices.
+
+   In the MFNKRYLOV solver, a block Krylov method is used, so that the matrix
+   A is applied to all vectors of a block at once and the projected function
+   is evaluated once per block. The columns of B are processed in blocks of
+   at most ncv/2 columns, where ncv is set with MFNSetDimensions(). Other
+   solvers compute the columns one by one.
+
+   The number of iterations returned by MFNGetIterationNumber() is the largest
+   one among all blocks. All columns of X are computed even if some of them
+   fail to converge, in which case MFNGetConvergedReason() returns the reason
+   of the first failure, and the failing columns are reported with PetscInfo().
+
+   Level: intermediate
+
+.seealso: MFNSolve(), MFNSetDimensions()
+@*/
+PetscErrorCode MFNSolveMat(MFN mfn,Mat B,Mat X)
+{
+  PetscInt       m1,n1,m2,n2;
+
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(mfn,MFN_CLASSID,1);
+  PetscValidHeaderSpecific(B,MAT_CLASSID,2);
+  PetscValidHeaderSpecific(X,MAT_CLASSID,3);
+  PetscCheckSameComm(mfn,1,B,2);
+  PetscCheckSameComm(mfn,1,X,3);
+  PetscCheck(B!=X,PetscObjectComm((PetscObject)mfn),PETSC_ERR_ARG_IDN,"B and X must be different matrices");
+  PetscCall(MatGetSize(B,&m1,&n1));
+  PetscCall(MatGetSize(X,&m2,&n2));
+  PetscCheck(m1==m2 && n1==n2,PetscObjectComm((PetscObject)mfn),PETSC_ERR_ARG_SIZ,"Incompatible matrix sizes B (%" PetscInt_FMT "x%" PetscInt_FMT ") and X (%" PetscInt_FMT "x%" PetscInt_FMT ")",m1,n1,m2,n2);
+  mfn->transpose_solve = PETSC_FALSE;
+
+  /* call setup */
+  PetscCall(MFNSetUp(mfn));
+  mfn->its = 0;
+
+  PetscCall(MFNViewFromOptions(mfn,NULL,"-mfn_view_pre"));
+
+  /* call solver */
+  PetscCall(PetscLogEventBegin(MFN_Solve,mfn,B,X,0));
+  if (mfn->ops->solvemat) PetscUseTypeMethod(mfn,solvemat,B,X);
+  else PetscCall(MFNSolveMat_Default(mfn,B,X));
+  PetscCall(PetscLogEventEnd(MFN_Solve,mfn,B,X,0));
+
+  PetscCheck(mfn->reason,PetscObjectComm((PetscObject)mfn),PETSC_ERR_PLIB,"Internal error, solver returned without setting converged reason");
+
+  PetscCheck(!mfn->errorifnotconverged || mfn->reason>=0,PetscObjectComm((PetscObject)mfn),PETSC_ERR_NOT_CONVERGED,"MFNSolveMat has not converged");
+
+  /* various viewers */
+  PetscCall(MFNViewFromOptions(mfn,NULL,"-mfn_view"));
+  PetscCall(MFNConvergedReasonViewFromOptions(mfn));
+  PetscCall(MatViewFromOptions(mfn->A,(PetscObject)mfn,"-mfn_view_mat"));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   MFNSolveTimes_Default - Solves the problem for each value of t separately
+*/
+static PetscErrorCode MFNSolveTimes_Default(MFN mfn,PetscInt nt,const PetscScalar *t,Vec b,Vec *x)
+{
+  PetscInt           i,its=0;
+  MFNConvergedReason reason=MFN_CONVERGED_TOL;
+  PetscScalar        alpha,beta;
+
+  PetscFunctionBegin;
+  PetscCall(FNGetScale(mfn->fn,&alpha,&beta));
+  for (i=0;i<nt;i++) {
+    PetscCall(FNSetScale(mfn->fn,t[i]*alpha,beta));
+    mfn->its    = 0;
+    mfn->reason = MFN_CONVERGED_ITERATING;
+    PetscUseTypeMethod(mfn,solve,b,x[i]);
+    its = PetscMax(its,mfn->its);
+    if (reason>0) reason = mfn->reason;   /* keep the first failure */
+  }
+  PetscCall(FNSetScale(mfn->fn,alpha,beta));
+  mfn->its    = its;
+  mfn->reason = reason;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   MFNSolveTimes - Solves the matrix function problem for several scalings
+   of the argument. Given a vector b and values t_1,...,t_k, the vectors
+   x_i = f(t_i*A)*b are returned.
+
+   Collective
+
+   Input Parameters:
++  mfn - matrix function context obtained from MFNCreate()
+.  nt  - number of values of t
+.  t   - the values t_i (e.g., a sequence of time values)
+-  b   - the right hand side vector
+
+   Output Parameter:
+.  x   - array of nt vectors with the solutions
+
+   Notes:
+   The values t_i multiply the argument of the function in addition to the
+   scaling factor alpha set with FNSetScale(), i.e., the function evaluated
+   for t_i is beta*f(t_i*alpha*A), where f is the function of the FN object.
+
+   In the MFNKRYLOV solver, the Krylov basis is built only once for all the
+   values t_i, and the small projected function is evaluated for each of
+   them. Convergence is checked for each t_i separately, and the method
+   restarts only while some of them have not converged yet (typically the
+   largest t_i). Other solvers compute the solutions one by one.
+
+   The values t_i must be distinct, since repeated values would only duplicate
+   the work. The vector b must not be any of the x_i, and the x_i must be different.
+
+   Level: intermediate
+
+.seealso: MFNSolve(), FNSetScale()
+@*/
+PetscErrorCode MFNSolveTimes(MFN mfn,PetscInt nt,const PetscScalar t[],Vec b,Vec x[])
+{
+  PetscInt       i,j;
+
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(mfn,MFN_CLASSID,1);
+  PetscValidLogicalCollectiveInt(mfn,nt,2);
+  PetscCheck(nt>0,PetscObjectComm((PetscObject)mfn),PETSC_ERR_ARG_OUTOFRANGE,"The number of values of t must be positive");
+  PetscAssertPointer(t,3);
+  PetscValidHeaderSpecific(b,VEC_CLASSID,4);
+  PetscCheckSameComm(mfn,1,b,4);
+  PetscAssertPointer(x,5);
+  for (i=0;i<nt;i++) {
+    PetscValidLogicalCollectiveScalar(mfn,t[i],3);
+    PetscValidHeaderSpecific(x[i],VEC_CLASSID,5);
+    PetscCheckSameComm(mfn,1,x[i],5);
+    PetscCheck(x[i]!=b,PetscObjectComm((PetscObject)mfn),PETSC_ERR_ARG_IDN,"The right hand side vector cannot be one of the solution vectors");
+    PetscCall(VecSetErrorIfLocked(x[i],5));
+    for (j=0;j<i;j++) {
+      PetscCheck(t[j]!=t[i],PetscObjectComm((PetscObject)mfn),PETSC_ERR_ARG_WRONG,"The values of t must be distinct, t[%" PetscInt_FMT "] is equal to t[%" PetscInt_FMT "]",i,j);
+      PetscCheck(x[j]!=x[i],PetscObjectComm((PetscObject)mfn),PETSC_ERR_ARG_IDN,"The solution vectors must be different, x[%" PetscInt_FMT "] is equal to x[%" PetscInt_FMT "]",i,j);
+    }
+  }
+  mfn->transpose_solve = PETSC_FALSE;
+
+  /* call setup */
+  PetscCall(MFNSetUp(mfn));
+  mfn->its = 0;
+
+  PetscCall(MFNViewFromOptions(mfn,NULL,"-mfn_view_pre"));
+
+  /* check nonzero right-hand side */
+  PetscCall(VecNorm(b,NORM_2,&mfn->bnorm));
+  PetscCheck(mfn->bnorm,PetscObjectComm((PetscObject)mfn),PETSC_ERR_ARG_WRONG,"Cannot pass a zero b vector to MFNSolveTimes()");
+
+  /* call solver */
+  PetscCall(PetscLogEventBegin(MFN_Solve,mfn,b,0,0));
+  PetscCall(VecLockReadPush(b));
+  if (mfn->ops->solvetimes) PetscUseTypeMethod(mfn,solvetimes,nt,t,b,x);
+  else PetscCall(MFNSolveTimes_Default(mfn,nt,t,b,x));
+  PetscCall(VecLockReadPop(b));
+  PetscCall(PetscLogEventEnd(MFN_Solve,mfn,b,0,0));
+
+  PetscCheck(mfn->reason,PetscObjectComm((PetscObject)mfn),PETSC_ERR_PLIB,"Internal error, solver returned without setting converged reason");
+
+  PetscCheck(!mfn->errorifnotconverged || mfn->reason>=0,PetscObjectComm((PetscObject)mfn),PETSC_ERR_NOT_CONVERGED,"MFNSolveTimes has not converged");
+
+  /* various viewers */
+  PetscCall(MFNViewFromOptions(mfn,NULL,"-mfn_view"));
+  PetscCall(MFNConvergedReasonViewFromOptions(mfn));
+  PetscCall(MatViewFromOptions(mfn->A,(PetscObject)mfn,"-mfn_view_mat"));
+  PetscCall(VecViewFromOptions(b,(PetscObject)mfn,"-mfn_view_rhs"));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@
    MFNGetIterationNumber - Gets the current iteration number. If the
    call to MFNSolve() is complete, then it returns the number of iterations
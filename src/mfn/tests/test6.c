@@ -0,0 +1,132 @@
+/*
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+   SLEPc - Scalable Library for Eigenvalue Problem Computations
+   Copyright (c) 2002-, Universitat Politecnica de Valencia, Spain
+
+   This file is part of SLEPc.
+   SLEPc is distributed under a 2-clause BSD license (see LICENSE).
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+*/
+
+static char help[] = "Tests MFNSolvePhi() against separate solves with phi-functions.\n\n"
+  "The command line options are:\n"
+  "  -t <sval>, where <sval> = scalar value that multiplies the argument.\n"
+  "  -n <n>, where <n> = matrix dimension.\n"
+  "  -p <p>, where <p> = highest index of the phi-functions.\n\n";
+
+#include <slepcmfn.h>
+
+int main(int argc,char **argv)
+{
+  Mat            A;           /* problem matrix */
+  MFN            mfn;
+  FN             f,g;
+  PetscReal      norm,nrmx;
+  PetscScalar    t=0.5,tk=1.0;
+  PetscInt       n=100,p=2,k,Istart,Iend,i;
+  Vec            *b,x,y,z;
+
+  PetscFunctionBeginUser;
+  PetscCall(SlepcInitialize(&argc,&argv,NULL,help));
+
+  PetscCall(PetscOptionsGetInt(NULL,NULL,"-n",&n,NULL));
+  PetscCall(PetscOptionsGetInt(NULL,NULL,"-p",&p,NULL));
+  PetscCall(PetscOptionsGetScalar(NULL,NULL,"-t",&t,NULL));
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD,"\nLinear combination of phi-functions up to p=%" PetscInt_FMT ", of a convection-diffusion matrix, n=%" PetscInt_FMT "\n\n",p,n));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                   Build a non-symmetric tridiagonal matrix
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+  PetscCall(MatCreate(PETSC_COMM_WORLD,&A));
+  PetscCall(MatSetSizes(A,PETSC_DECIDE,PETSC_DECIDE,n,n));
+  PetscCall(MatSetFromOptions(A));
+
+  PetscCall(MatGetOwnershipRange(A,&Istart,&Iend));
+  for (i=Istart;i<Iend;i++) {
+    if (i>0) PetscCall(MatSetValue(A,i,i-1,1.2,INSERT_VALUES));
+    if (i<n-1) PetscCall(MatSetValue(A,i,i+1,0.8,INSERT_VALUES));
+    PetscCall(MatSetValue(A,i,i,-2.0,INSERT_VALUES));
+  }
+  PetscCall(MatAssemblyBegin(A,MAT_FINAL_ASSEMBLY));
+  PetscCall(MatAssemblyEnd(A,MAT_FINAL_ASSEMBLY));
+
+  /* right-hand sides b_k */
+  PetscCall(MatCreateVecs(A,&x,&y));
+  PetscCall(VecDuplicate(x,&z));
+  PetscCall(VecDuplicateVecs(x,p+1,&b));
+  for (k=0;k<=p;k++) {
+    for (i=Istart;i<Iend;i++) PetscCall(VecSetValue(b[k],i,1.0/(i+k+1),INSERT_VALUES));
+    PetscCall(VecAssemblyBegin(b[k]));
+    PetscCall(VecAssemblyEnd(b[k]));
+  }
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                Create the solver and set various options
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+  PetscCall(FNCreate(PETSC_COMM_WORLD,&f));
+  PetscCall(FNSetType(f,FNEXP));
+  PetscCall(FNSetScale(f,t,1.0));
+  PetscCall(FNCreate(PETSC_COMM_WORLD,&g));
+  PetscCall(FNSetType(g,FNPHI));
+  PetscCall(FNSetScale(g,t,1.0));
+
+  PetscCall(MFNCreate(PETSC_COMM_WORLD,&mfn));
+  PetscCall(MFNSetOperator(mfn,A));
+  PetscCall(MFNSetFN(mfn,f));
+  PetscCall(MFNSetTolerances(mfn,1e-10,PETSC_CURRENT));
+  PetscCall(MFNSetErrorIfNotConverged(mfn,PETSC_TRUE));
+  PetscCall(MFNSetFromOptions(mfn));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+            Solve x = sum_k t^k*phi_k(t*A)*b_k with a single call
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+  PetscCall(MFNSolvePhi(mfn,p,b,x));
+  PetscCall(VecNorm(x,NORM_2,&nrmx));
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD," Computed vector at time t=%.4g has norm %.4g\n\n",(double)PetscRealPart(t),(double)nrmx));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+              Repeat the computation with p+1 separate solves
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+  PetscCall(MFNSolve(mfn,b[0],y));
+  PetscCall(MFNSetFN(mfn,g));
+  for (k=1;k<=p;k++) {
+    tk *= t;
+    PetscCall(FNPhiSetIndex(g,k));
+    PetscCall(MFNSolve(mfn,b[k],z));
+    PetscCall(VecAXPY(y,tk,z));
+  }
+  PetscCall(VecAXPY(y,-1.0,x));
+  PetscCall(VecNorm(y,NORM_2,&norm));
+  if (norm<1e-7*nrmx) PetscCall(PetscPrintf(PETSC_COMM_WORLD," The relative norm of the difference is below 1e-7\n\n"));
+  else PetscCall(PetscPrintf(PETSC_COMM_WORLD," The relative norm of the difference is %g\n\n",(double)(norm/nrmx)));
+
+  /*
+     Free work space
+  */
+  PetscCall(MFNDestroy(&mfn));
+  PetscCall(FNDestroy(&f));
+  PetscCall(FNDestroy(&g));
+  PetscCall(MatDestroy(&A));
+  PetscCall(VecDestroyVecs(p+1,&b));
+  PetscCall(VecDestroy(&x));
+  PetscCall(VecDestroy(&y));
+  PetscCall(VecDestroy(&z));
+  PetscCall(SlepcFinalize());
+  return 0;
+}
+
+/*TEST
+
+   testset:
+      requires: !single
+      test:
+         suffix: 1
+      test:
+         suffix: 2
+         args: -mfn_ncv 8 -t 2
+
+TEST*/
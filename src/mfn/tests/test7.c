@@ -0,0 +1,134 @@
+/*
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+   SLEPc - Scalable Library for Eigenvalue Problem Computations
+   Copyright (c) 2002-, Universitat Politecnica de Valencia, Spain
+
+   This file is part of SLEPc.
+   SLEPc is distributed under a 2-clause BSD license (see LICENSE).
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+*/
+
+static char help[] = "Tests MFNSolveMat() against MFNSolve() for each column.\n\n"
+  "The command line options are:\n"
+  "  -t <sval>, where <sval> = scalar value that multiplies the argument.\n"
+  "  -n <n>, where <n> = number of grid subdivisions in x dimension.\n"
+  "  -m <m>, where <m> = number of grid subdivisions in y dimension.\n"
+  "  -k <k>, where <k> = number of right-hand side vectors.\n\n";
+
+#include <slepcmfn.h>
+
+int main(int argc,char **argv)
+{
+  Mat            A,B,X;
+  MFN            mfn;
+  FN             f;
+  PetscReal      norm,nrmx,maxerr=0.0;
+  PetscScalar    t=0.3;
+  PetscInt       N,n=25,m,k=6,Istart,Iend,II,i,j;
+  PetscBool      flag;
+  Vec            b,x,y;
+
+  PetscFunctionBeginUser;
+  PetscCall(SlepcInitialize(&argc,&argv,NULL,help));
+
+  PetscCall(PetscOptionsGetInt(NULL,NULL,"-n",&n,NULL));
+  PetscCall(PetscOptionsGetInt(NULL,NULL,"-m",&m,&flag));
+  if (!flag) m=n;
+  N = n*m;
+  PetscCall(PetscOptionsGetInt(NULL,NULL,"-k",&k,NULL));
+  PetscCall(PetscOptionsGetScalar(NULL,NULL,"-t",&t,NULL));
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD,"\nMatrix exponential Y=exp(t*A)*B with %" PetscInt_FMT " columns, of the 2-D Laplacian, N=%" PetscInt_FMT " (%" PetscInt_FMT "x%" PetscInt_FMT " grid)\n\n",k,N,n,m));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                         Build the 2-D Laplacian
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+  PetscCall(MatCreate(PETSC_COMM_WORLD,&A));
+  PetscCall(MatSetSizes(A,PETSC_DECIDE,PETSC_DECIDE,N,N));
+  PetscCall(MatSetFromOptions(A));
+
+  PetscCall(MatGetOwnershipRange(A,&Istart,&Iend));
+  for (II=Istart;II<Iend;II++) {
+    i = II/n; j = II-i*n;
+    if (i>0) PetscCall(MatSetValue(A,II,II-n,-1.0,INSERT_VALUES));
+    if (i<m-1) PetscCall(MatSetValue(A,II,II+n,-1.0,INSERT_VALUES));
+    if (j>0) PetscCall(MatSetValue(A,II,II-1,-1.0,INSERT_VALUES));
+    if (j<n-1) PetscCall(MatSetValue(A,II,II+1,-1.0,INSERT_VALUES));
+    PetscCall(MatSetValue(A,II,II,4.0,INSERT_VALUES));
+  }
+  PetscCall(MatAssemblyBegin(A,MAT_FINAL_ASSEMBLY));
+  PetscCall(MatAssemblyEnd(A,MAT_FINAL_ASSEMBLY));
+
+  /* right-hand sides, column j has entries 1/(i+j+1) */
+  PetscCall(MatCreateDense(PETSC_COMM_WORLD,Iend-Istart,PETSC_DECIDE,N,k,NULL,&B));
+  for (j=0;j<k;j++) {
+    for (II=Istart;II<Iend;II++) PetscCall(MatSetValue(B,II,j,1.0/(II+j+1),INSERT_VALUES));
+  }
+  PetscCall(MatAssemblyBegin(B,MAT_FINAL_ASSEMBLY));
+  PetscCall(MatAssemblyEnd(B,MAT_FINAL_ASSEMBLY));
+  PetscCall(MatDuplicate(B,MAT_DO_NOT_COPY_VALUES,&X));
+  PetscCall(MatCreateVecs(A,NULL,&y));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                Create the solver and set various options
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+  PetscCall(FNCreate(PETSC_COMM_WORLD,&f));
+  PetscCall(FNSetType(f,FNEXP));
+  PetscCall(FNSetScale(f,t,1.0));
+
+  PetscCall(MFNCreate(PETSC_COMM_WORLD,&mfn));
+  PetscCall(MFNSetOperator(mfn,A));
+  PetscCall(MFNSetFN(mfn,f));
+  PetscCall(MFNSetTolerances(mfn,1e-10,PETSC_CURRENT));
+  PetscCall(MFNSetErrorIfNotConverged(mfn,PETSC_TRUE));
+  PetscCall(MFNSetFromOptions(mfn));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+           Solve all columns at once and compare with MFNSolve()
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+  PetscCall(MFNSolveMat(mfn,B,X));
+  for (j=0;j<k;j++) {
+    PetscCall(MatDenseGetColumnVecRead(B,j,&b));
+    PetscCall(MatDenseGetColumnVecRead(X,j,&x));
+    PetscCall(MFNSolve(mfn,b,y));
+    PetscCall(VecNorm(x,NORM_2,&nrmx));
+    PetscCall(VecAXPY(y,-1.0,x));
+    PetscCall(VecNorm(y,NORM_2,&norm));
+    maxerr = PetscMax(maxerr,norm/nrmx);
+    PetscCall(MatDenseRestoreColumnVecRead(X,j,&x));
+    PetscCall(MatDenseRestoreColumnVecRead(B,j,&b));
+  }
+  if (maxerr<1e-7) PetscCall(PetscPrintf(PETSC_COMM_WORLD," The relative norm of the difference is below 1e-7\n\n"));
+  else PetscCall(PetscPrintf(PETSC_COMM_WORLD," The relative norm of the difference is %g\n\n",(double)maxerr));
+
+  /*
+     Free work space
+  */
+  PetscCall(MFNDestroy(&mfn));
+  PetscCall(FNDestroy(&f));
+  PetscCall(MatDestroy(&A));
+  PetscCall(MatDestroy(&B));
+  PetscCall(MatDestroy(&X));
+  PetscCall(VecDestroy(&y));
+  PetscCall(SlepcFinalize());
+  return 0;
+}
+
+/*TEST
+
+   testset:
+      requires: !single
+      output_file: output/test7_1.out
+      test:
+         suffix: 1
+         args: -mfn_type {{krylov expokit}}
+      test:
+         suffix: 2
+         args: -mfn_ncv 6
+      test:
+         suffix: 2_svqb
+         args: -mfn_ncv 6 -bv_orthog_block svqb
+
+TEST*/
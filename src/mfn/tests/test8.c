@@ -0,0 +1,126 @@
+/*
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+   SLEPc - Scalable Library for Eigenvalue Problem Computations
+   Copyright (c) 2002-, Universitat Politecnica de Valencia, Spain
+
+   This file is part of SLEPc.
+   SLEPc is distributed under a 2-clause BSD license (see LICENSE).
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+*/
+
+static char help[] = "Tests MFNSolveTimes() against MFNSolve() for each time value.\n\n"
+  "The command line options are:\n"
+  "  -n <n>, where <n> = number of grid subdivisions in x dimension.\n"
+  "  -m <m>, where <m> = number of grid subdivisions in y dimension.\n"
+  "  -nt <nt>, where <nt> = number of time values in (0,1].\n\n";
+
+#include <slepcmfn.h>
+
+int main(int argc,char **argv)
+{
+  Mat            A;           /* problem matrix */
+  MFN            mfn;
+  FN             f;
+  PetscReal      norm,nrmx,maxerr=0.0;
+  PetscScalar    *t;
+  PetscInt       N,n=25,m,nt=10,Istart,Iend,II,i,j;
+  PetscBool      flag;
+  Vec            v,y,*x;
+
+  PetscFunctionBeginUser;
+  PetscCall(SlepcInitialize(&argc,&argv,NULL,help));
+
+  PetscCall(PetscOptionsGetInt(NULL,NULL,"-n",&n,NULL));
+  PetscCall(PetscOptionsGetInt(NULL,NULL,"-m",&m,&flag));
+  if (!flag) m=n;
+  N = n*m;
+  PetscCall(PetscOptionsGetInt(NULL,NULL,"-nt",&nt,NULL));
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD,"\nMatrix exponential y=exp(t*A)*e for %" PetscInt_FMT " values of t, of the 2-D Laplacian, N=%" PetscInt_FMT " (%" PetscInt_FMT "x%" PetscInt_FMT " grid)\n\n",nt,N,n,m));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                         Build the 2-D Laplacian
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+  PetscCall(MatCreate(PETSC_COMM_WORLD,&A));
+  PetscCall(MatSetSizes(A,PETSC_DECIDE,PETSC_DECIDE,N,N));
+  PetscCall(MatSetFromOptions(A));
+
+  PetscCall(MatGetOwnershipRange(A,&Istart,&Iend));
+  for (II=Istart;II<Iend;II++) {
+    i = II/n; j = II-i*n;
+    if (i>0) PetscCall(MatSetValue(A,II,II-n,-1.0,INSERT_VALUES));
+    if (i<m-1) PetscCall(MatSetValue(A,II,II+n,-1.0,INSERT_VALUES));
+    if (j>0) PetscCall(MatSetValue(A,II,II-1,-1.0,INSERT_VALUES));
+    if (j<n-1) PetscCall(MatSetValue(A,II,II+1,-1.0,INSERT_VALUES));
+    PetscCall(MatSetValue(A,II,II,4.0,INSERT_VALUES));
+  }
+  PetscCall(MatAssemblyBegin(A,MAT_FINAL_ASSEMBLY));
+  PetscCall(MatAssemblyEnd(A,MAT_FINAL_ASSEMBLY));
+
+  /* set v = ones(n,1) */
+  PetscCall(MatCreateVecs(A,&v,&y));
+  PetscCall(VecSet(v,1.0));
+  PetscCall(VecDuplicateVecs(v,nt,&x));
+  PetscCall(PetscMalloc1(nt,&t));
+  for (i=0;i<nt;i++) t[i] = (i+1.0)/nt;
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                Create the solver and set various options
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+  PetscCall(FNCreate(PETSC_COMM_WORLD,&f));
+  PetscCall(FNSetType(f,FNEXP));
+  PetscCall(FNSetScale(f,-1.0,1.0));
+
+  PetscCall(MFNCreate(PETSC_COMM_WORLD,&mfn));
+  PetscCall(MFNSetOperator(mfn,A));
+  PetscCall(MFNSetFN(mfn,f));
+  PetscCall(MFNSetTolerances(mfn,1e-10,PETSC_CURRENT));
+  PetscCall(MFNSetErrorIfNotConverged(mfn,PETSC_TRUE));
+  PetscCall(MFNSetFromOptions(mfn));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        Solve for all time values at once and compare with MFNSolve()
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+  PetscCall(MFNSolveTimes(mfn,nt,t,v,x));
+  for (i=0;i<nt;i++) {
+    PetscCall(FNSetScale(f,-t[i],1.0));
+    PetscCall(MFNSolve(mfn,v,y));
+    PetscCall(VecNorm(x[i],NORM_2,&nrmx));
+    PetscCall(VecAXPY(y,-1.0,x[i]));
+    PetscCall(VecNorm(y,NORM_2,&norm));
+    maxerr = PetscMax(maxerr,norm/nrmx);
+  }
+  PetscCall(VecNorm(x[nt-1],NORM_2,&nrmx));
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD," Computed vector at time t=%.4g has norm %g\n\n",(double)PetscRealPart(t[nt-1]),(double)nrmx));
+  if (maxerr<1e-7) PetscCall(PetscPrintf(PETSC_COMM_WORLD," The relative norm of the difference is below 1e-7\n\n"));
+  else PetscCall(PetscPrintf(PETSC_COMM_WORLD," The relative norm of the difference is %g\n\n",(double)maxerr));
+
+  /*
+     Free work space
+  */
+  PetscCall(MFNDestroy(&mfn));
+  PetscCall(FNDestroy(&f));
+  PetscCall(MatDestroy(&A));
+  PetscCall(VecDestroy(&v));
+  PetscCall(VecDestroy(&y));
+  PetscCall(VecDestroyVecs(nt,&x));
+  PetscCall(PetscFree(t));
+  PetscCall(SlepcFinalize());
+  return 0;
+}
+
+/*TEST
+
+   testset:
+      requires: !single
+      output_file: output/test8_1.out
+      test:
+         suffix: 1
+         args: -mfn_type {{krylov expokit}}
+      test:
+         suffix: 2
+         args: -mfn_ncv 8
+
+TEST*/
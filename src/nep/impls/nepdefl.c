@@ -242,7 +242,7 @@ PetscErrorCode NEPDeflationLocking(NEP_EXT_OP extop,Vec u,PetscScalar lambda)
 static PetscErrorCode NEPDeflationEvaluateHatFunction(NEP_EXT_OP extop, PetscInt idx,PetscScalar lambda,PetscScalar *y,PetscScalar *hfj,PetscScalar *hfjp,PetscInt ld)
 {
   PetscInt          i,j,k,off,ini,fin,sz,ldh,n=extop->n;
-  Mat               A,B;
+  Mat               A,*B;
   PetscScalar       *array;
   const PetscScalar *barray;
 
@@ -253,7 +253,8 @@ static PetscErrorCode NEPDeflationEvaluateHatFunction(NEP_EXT_OP extop, PetscInt
   else sz = hfjp?3*n:2*n;
   ldh = extop->szd+1;
   PetscCall(MatCreateSeqDense(PETSC_COMM_SELF,sz,sz,NULL,&A));
-  PetscCall(MatCreateSeqDense(PETSC_COMM_SELF,sz,sz,NULL,&B));
+  PetscCall(PetscMalloc1(fin-ini,&B));
+  for (j=ini;j<fin;j++) PetscCall(MatCreateSeqDense(PETSC_COMM_SELF,sz,sz,NULL,&B[j-ini]));
   PetscCall(MatDenseGetArray(A,&array));
   for (j=0;j<n;j++)
     for (i=0;i<n;i++) array[j*sz+i] = extop->H[j*ldh+i];
@@ -264,12 +265,12 @@ static PetscErrorCode NEPDeflationEvaluateHatFunction(NEP_EXT_OP extop, PetscInt
     if (hfjp) { array[(n+1)*sz+n] = 1.0; array[(n+1)*sz+n+1] = lambda;}
     for (i=0;i<n;i++) array[n*sz+i] = y[i];
     PetscCall(MatDenseRestoreArrayWrite(A,&array));
+    PetscCall(FNEvaluateFunctionsMat(fin-ini,extop->nep->f+ini,A,B));
     for (j=ini;j<fin;j++) {
-      PetscCall(FNEvaluateFunctionMat(extop->nep->f[j],A,B));
-      PetscCall(MatDenseGetArrayRead(B,&barray));
+      PetscCall(MatDenseGetArrayRead(B[j-ini],&barray));
       for (i=0;i<n;i++) hfj[j*ld+i] = barray[n*sz+i];
       if (hfjp) for (i=0;i<n;i++) hfjp[j*ld+i] = barray[(n+1)*sz+i];
-      PetscCall(MatDenseRestoreArrayRead(B,&barray));
+      PetscCall(MatDenseRestoreArrayRead(B[j-ini],&barray));
     }
   } else {
     off = idx<0?ld*n:0;
@@ -283,16 +284,17 @@ static PetscErrorCode NEPDeflationEvaluateHatFunction(NEP_EXT_OP extop, PetscInt
       array[(2*n+k)*sz+2*n+k] = lambda;
     }
     PetscCall(MatDenseRestoreArray(A,&array));
+    PetscCall(FNEvaluateFunctionsMat(fin-ini,extop->nep->f+ini,A,B));
     for (j=ini;j<fin;j++) {
-      PetscCall(FNEvaluateFunctionMat(extop->nep->f[j],A,B));
-      PetscCall(MatDenseGetArrayRead(B,&barray));
+      PetscCall(MatDenseGetArrayRead(B[j-ini],&barray));
       for (i=0;i<n;i++) for (k=0;k<n;k++) hfj[j*off+i*ld+k] = barray[n*sz+i*sz+k];
       if (hfjp) for (k=0;k<n;k++) for (i=0;i<n;i++) hfjp[j*off+i*ld+k] = barray[2*n*sz+i*sz+k];
-      PetscCall(MatDenseRestoreArrayRead(B,&barray));
+      PetscCall(MatDenseRestoreArrayRead(B[j-ini],&barray));
     }
   }
   PetscCall(MatDestroy(&A));
-  PetscCall(MatDestroy(&B));
+  for (j=ini;j<fin;j++) PetscCall(MatDestroy(&B[j-ini]));
+  PetscCall(PetscFree(B));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -623,6 +623,108 @@ PetscErrorCode NEPComputeResidualNorm_Private(NEP nep,PetscBool adj,PetscScalar
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   NEPComputeError_Scale - Turns the residual norm of an eigenpair into the
+   error of the given type; er is the 2-norm of the eigenvector.
+*/
+static PetscErrorCode NEPComputeError_Scale(NEP nep,NEPErrorType type,PetscScalar kr,PetscReal er,PetscReal *error)
+{
+  PetscInt    j;
+  PetscScalar s;
+  PetscReal   z=0.0,nrm;
+  PetscBool   flg;
+
+  PetscFunctionBegin;
+  switch (type) {
+    case NEP_ERROR_ABSOLUTE:
+      break;
+    case NEP_ERROR_RELATIVE:
+      *error /= PetscAbsScalar(kr)*er;
+      break;
+    case NEP_ERROR_BACKWARD:
+      if (nep->fui!=NEP_USER_INTERFACE_SPLIT) {
+        PetscCall(NEPComputeFunction(nep,kr,nep->function,nep->function));
+        PetscCall(MatHasOperation(nep->function,MATOP_NORM,&flg));
+        PetscCheck(flg,PetscObjectComm((PetscObject)nep),PETSC_ERR_ARG_WRONG,"The computation of backward errors requires a matrix norm operation");
+        PetscCall(MatNorm(nep->function,NORM_INFINITY,&nrm));
+        *error /= nrm*er;
+        break;
+      }
+      /* initialization of matrix norms */
+      if (!nep->nrma[0]) {
+        for (j=0;j<nep->nt;j++) {
+          PetscCall(MatHasOperation(nep->A[j],MATOP_NORM,&flg));
+          PetscCheck(flg,PetscObjectComm((PetscObject)nep),PETSC_ERR_ARG_WRONG,"The computation of backward errors requires a matrix norm operation");
+          PetscCall(MatNorm(nep->A[j],NORM_INFINITY,&nep->nrma[j]));
+        }
+      }
+      for (j=0;j<nep->nt;j++) {
+        PetscCall(FNEvaluateFunction(nep->f[j],kr,&s));
+        z = z + nep->nrma[j]*PetscAbsScalar(s);
+      }
+      *error /= z*er;
+      break;
+    default:
+      SETERRQ(PetscObjectComm((PetscObject)nep),PETSC_ERR_ARG_OUTOFRANGE,"Invalid error type");
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   NEPComputeResidualNorms_Private - Computes the residual norms of the first n
+   columns of V (eigenvectors with real or complex scalar eigenvalues), in split
+   form, with one block product per term and a single reduction for all the norms.
+
+   Input Parameters:
+     adj - whether the adjoint T^* must be used instead of T
+     V   - the eigenvectors, nep->V or nep->W
+     n   - the number of columns
+
+   Output Parameter:
+     norm - array of n residual norms, in the order of the columns
+*/
+static PetscErrorCode NEPComputeResidualNorms_Private(NEP nep,PetscBool adj,BV V,PetscInt n,PetscReal *norm)
+{
+  PetscInt    i,j,l,k,rstart,rend;
+  PetscScalar *pd;
+  Mat         MR,MW;
+  BV          R,W;
+  Vec         d;
+
+  PetscFunctionBegin;
+  PetscCall(BVGetActiveColumns(V,&l,&k));
+  PetscCall(BVSetActiveColumns(V,0,n));
+  PetscCall(BVDuplicateResize(V,n,&R));
+  PetscCall(BVDuplicateResize(V,n,&W));
+  PetscCall(BVGetMat(R,&MR));
+  PetscCall(MatZeroEntries(MR));
+  PetscCall(BVRestoreMat(R,&MR));
+  for (i=0;i<nep->nt;i++) {
+    if (adj) PetscCall(BVMatMultHermitianTranspose(V,nep->A[i],W));  /* W=A_i*X */
+    else PetscCall(BVMatMult(V,nep->A[i],W));
+    PetscCall(BVGetMat(R,&MR));                                       /* R=R+W*diag(f_i(lambda)) */
+    PetscCall(BVGetMat(W,&MW));
+    PetscCall(MatCreateVecs(MW,&d,NULL));
+    PetscCall(VecGetOwnershipRange(d,&rstart,&rend));
+    PetscCall(VecGetArray(d,&pd));
+    for (j=rstart;j<rend;j++) {
+      PetscCall(FNEvaluateFunction(nep->f[i],nep->eigr[j],pd+j-rstart));
+      if (adj) pd[j-rstart] = PetscConj(pd[j-rstart]);
+    }
+    PetscCall(VecRestoreArray(d,&pd));
+    PetscCall(MatDiagonalScale(MW,NULL,d));
+    PetscCall(MatAXPY(MR,1.0,MW,SAME_NONZERO_PATTERN));
+    if (i==nep->nt-1) PetscCall(MatGetColumnNorms(MR,NORM_2,norm));
+    PetscCall(VecDestroy(&d));
+    PetscCall(BVRestoreMat(W,&MW));
+    PetscCall(BVRestoreMat(R,&MR));
+  }
+  PetscCall(BVDestroy(&R));
+  PetscCall(BVDestroy(&W));
+  PetscCall(BVSetActiveColumns(V,l,k));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@
    NEPComputeError - Computes the error (based on the residual norm) associated
    with the i-th computed eigenpair.
@@ -649,10 +751,9 @@ PetscErrorCode NEPComputeResidualNorm_Private(NEP nep,PetscBool adj,PetscScalar
 PetscErrorCode NEPComputeError(NEP nep,PetscInt i,NEPErrorType type,PetscReal *error)
 {
   Vec            xr,xi=NULL;
-  PetscInt       j,nwork,issplit=0;
-  PetscScalar    kr,ki,s;
-  PetscReal      er,z=0.0,errorl,nrm;
-  PetscBool      flg;
+  PetscInt       nwork,issplit=0;
+  PetscScalar    kr,ki;
+  PetscReal      er,errorl;
 
   PetscFunctionBegin;
   PetscValidHeaderSpecific(nep,NEP_CLASSID,1);
@@ -693,38 +794,79 @@ PetscErrorCode NEPComputeError(NEP nep,PetscInt i,NEPErrorType type,PetscReal *e
   }
 
   /* compute error */
-  switch (type) {
-    case NEP_ERROR_ABSOLUTE:
-      break;
-    case NEP_ERROR_RELATIVE:
-      *error /= PetscAbsScalar(kr)*er;
-      break;
-    case NEP_ERROR_BACKWARD:
-      if (nep->fui!=NEP_USER_INTERFACE_SPLIT) {
-        PetscCall(NEPComputeFunction(nep,kr,nep->function,nep->function));
-        PetscCall(MatHasOperation(nep->function,MATOP_NORM,&flg));
-        PetscCheck(flg,PetscObjectComm((PetscObject)nep),PETSC_ERR_ARG_WRONG,"The computation of backward errors requires a matrix norm operation");
-        PetscCall(MatNorm(nep->function,NORM_INFINITY,&nrm));
-        *error /= nrm*er;
-        break;
-      }
-      /* initialization of matrix norms */
-      if (!nep->nrma[0]) {
-        for (j=0;j<nep->nt;j++) {
-          PetscCall(MatHasOperation(nep->A[j],MATOP_NORM,&flg));
-          PetscCheck(flg,PetscObjectComm((PetscObject)nep),PETSC_ERR_ARG_WRONG,"The computation of backward errors requires a matrix norm operation");
-          PetscCall(MatNorm(nep->A[j],NORM_INFINITY,&nep->nrma[j]));
-        }
-      }
-      for (j=0;j<nep->nt;j++) {
-        PetscCall(FNEvaluateFunction(nep->f[j],kr,&s));
-        z = z + nep->nrma[j]*PetscAbsScalar(s);
-      }
-      *error /= z*er;
-      break;
-    default:
-      SETERRQ(PetscObjectComm((PetscObject)nep),PETSC_ERR_ARG_OUTOFRANGE,"Invalid error type");
+  PetscCall(NEPComputeError_Scale(nep,type,kr,er,error));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   NEPComputeErrors - Computes the errors (based on the residual norm) associated
+   with all the computed eigenpairs.
+
+   Collective
+
+   Input Parameters:
++  nep  - the nonlinear eigensolver context
+-  type - the type of error to compute
+
+   Output Parameter:
+.  errors - array of length nconv (see NEPGetConverged()) with the errors
+
+   Notes:
+   The result is the same as calling NEPComputeError() for i=0,...,nconv-1.
+   If the problem has been defined in split form, all residuals are computed
+   at once with a block product with each matrix of the split form, and their
+   norms with a single reduction. Otherwise, the function matrix must be
+   evaluated at each eigenvalue, so the errors are computed one at a time.
+
+   Level: intermediate
+
+.seealso: NEPComputeError(), NEPErrorType, NEPGetConverged(), NEPSetSplitOperator()
+@*/
+PetscErrorCode NEPComputeErrors(NEP nep,NEPErrorType type,PetscReal errors[])
+{
+  PetscInt  i,k,l,m;
+  PetscReal *rnorm,*lnorm,*vnorm;
+  PetscBool block;
+  Mat       X;
+
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(nep,NEP_CLASSID,1);
+  PetscValidLogicalCollectiveEnum(nep,type,2);
+  PetscAssertPointer(errors,3);
+  NEPCheckSolved(nep,1);
+  if (!nep->nconv) PetscFunctionReturn(PETSC_SUCCESS);
+
+  block = (nep->fui==NEP_USER_INTERFACE_SPLIT)? PETSC_TRUE: PETSC_FALSE;
+#if !defined(PETSC_USE_COMPLEX)
+  for (i=0;i<nep->nconv;i++) if (nep->eigi[i]!=0.0) block = PETSC_FALSE;
+#endif
+  if (!block) {
+    for (i=0;i<nep->nconv;i++) PetscCall(NEPComputeError(nep,i,type,errors+i));
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
+
+  PetscCall(NEPComputeVectors(nep));
+  PetscCall(PetscMalloc3(nep->nconv,&rnorm,nep->nconv,&lnorm,nep->nconv,&vnorm));
+  PetscCall(NEPComputeResidualNorms_Private(nep,PETSC_FALSE,nep->V,nep->nconv,rnorm));
+  PetscCall(BVGetActiveColumns(nep->V,&l,&m));
+  PetscCall(BVSetActiveColumns(nep->V,0,nep->nconv));
+  PetscCall(BVGetMat(nep->V,&X));
+  PetscCall(MatGetColumnNorms(X,NORM_2,vnorm));
+  PetscCall(BVRestoreMat(nep->V,&X));
+  PetscCall(BVSetActiveColumns(nep->V,l,m));
+
+  /* if two-sided, compute left residual norms and take the maximum */
+  if (nep->twosided) {
+    PetscCall(NEPComputeResidualNorms_Private(nep,PETSC_TRUE,nep->W,nep->nconv,lnorm));
+    for (i=0;i<nep->nconv;i++) rnorm[i] = PetscMax(rnorm[i],lnorm[i]);
+  }
+
+  for (i=0;i<nep->nconv;i++) {
+    k = nep->perm[i];
+    errors[i] = rnorm[k];
+    PetscCall(NEPComputeError_Scale(nep,type,nep->eigr[k],vnorm[k],errors+i));
   }
+  PetscCall(PetscFree3(rnorm,lnorm,vnorm));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -152,6 +152,7 @@ PetscErrorCode PEPSetUp(PEP pep)
 
   /* set tolerance if not yet set */
   if (pep->tol==(PetscReal)PETSC_DETERMINE) pep->tol = SLEPC_DEFAULT_TOL;
+  PetscCall(STSetDefaultSolveRefinementTol(pep->st,0.1*pep->tol));
   if (pep->refine) {
     if (pep->rtol==(PetscReal)PETSC_DETERMINE) pep->rtol = PetscMax(pep->tol/1000,PETSC_MACHINE_EPSILON);
     if (pep->rits==PETSC_DETERMINE) pep->rits = (pep->refine==PEP_REFINE_SIMPLE)? 10: 1;
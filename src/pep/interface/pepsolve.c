@@ -442,6 +442,130 @@ PetscErrorCode PEPComputeResidualNorm_Private(PEP pep,PetscScalar kr,PetscScalar
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   PEPComputeError_Scale - Turns the residual norm of an eigenpair into the
+   error of the given type.
+*/
+static PetscErrorCode PEPComputeError_Scale(PEP pep,PEPErrorType type,PetscScalar kr,PetscScalar ki,PetscReal *error)
+{
+  PetscReal t,z=0.0;
+  PetscInt  j;
+  PetscBool flg;
+
+  PetscFunctionBegin;
+  switch (type) {
+    case PEP_ERROR_ABSOLUTE:
+      break;
+    case PEP_ERROR_RELATIVE:
+      *error /= SlepcAbsEigenvalue(kr,ki);
+      break;
+    case PEP_ERROR_BACKWARD:
+      /* initialization of matrix norms */
+      if (!pep->nrma[pep->nmat-1]) {
+        for (j=0;j<pep->nmat;j++) {
+          PetscCall(MatHasOperation(pep->A[j],MATOP_NORM,&flg));
+          PetscCheck(flg,PetscObjectComm((PetscObject)pep),PETSC_ERR_ARG_WRONG,"The computation of backward errors requires a matrix norm operation");
+          PetscCall(MatNorm(pep->A[j],NORM_INFINITY,&pep->nrma[j]));
+        }
+      }
+      t = SlepcAbsEigenvalue(kr,ki);
+      for (j=pep->nmat-1;j>=0;j--) {
+        z = z*t+pep->nrma[j];
+      }
+      *error /= z;
+      break;
+    default:
+      SETERRQ(PetscObjectComm((PetscObject)pep),PETSC_ERR_ARG_OUTOFRANGE,"Invalid error type");
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   PEPComputeResidualNorms_Private - Computes the residual norms of the first n
+   columns of pep->V, with one block product per matrix of the polynomial and
+   a single reduction for all the norms. The result is in the order of the columns.
+*/
+static PetscErrorCode PEPComputeResidualNorms_Private(PEP pep,PetscInt n,PetscReal *norm)
+{
+  PetscInt    i,j,l,k,nmat=pep->nmat,rstart,rend;
+  PetscScalar *vals,*ivals,*pd;
+  Mat         MR,MW;
+  BV          R,W;
+  Vec         d;
+#if !defined(PETSC_USE_COMPLEX)
+  Vec         r,w;
+#endif
+
+  PetscFunctionBegin;
+  PetscCall(PetscMalloc2(nmat*n,&vals,nmat*n,&ivals));
+  for (j=0;j<n;j++) {
+#if defined(PETSC_USE_COMPLEX)
+    PetscCall(PEPEvaluateBasis(pep,pep->eigr[j],0.0,vals+j*nmat,NULL));
+#else
+    PetscCall(PEPEvaluateBasis(pep,pep->eigr[j],pep->eigi[j],vals+j*nmat,ivals+j*nmat));
+    if (pep->eigi[j]!=0.0) {  /* the second column of the pair uses the same values */
+      PetscCall(PetscArraycpy(vals+(j+1)*nmat,vals+j*nmat,nmat));
+      PetscCall(PetscArraycpy(ivals+(j+1)*nmat,ivals+j*nmat,nmat));
+      j++;
+    }
+#endif
+  }
+  PetscCall(BVGetActiveColumns(pep->V,&l,&k));
+  PetscCall(BVSetActiveColumns(pep->V,0,n));
+  PetscCall(BVDuplicateResize(pep->V,n,&R));
+  PetscCall(BVDuplicateResize(pep->V,n,&W));
+  PetscCall(BVGetMat(R,&MR));
+  PetscCall(MatZeroEntries(MR));
+  PetscCall(BVRestoreMat(R,&MR));
+  for (i=0;i<nmat;i++) {
+    PetscCall(BVMatMult(pep->V,pep->A[i],W));                /* W=A_i*X */
+#if !defined(PETSC_USE_COMPLEX)
+    for (j=0;j<n;j++) {
+      if (pep->eigi[j]==0.0) continue;
+      if (ivals[j*nmat+i]!=0.0) {
+        PetscCall(BVGetColumn(R,j,&r));
+        PetscCall(BVGetColumn(W,j+1,&w));
+        PetscCall(VecAXPY(r,-ivals[j*nmat+i],w));
+        PetscCall(BVRestoreColumn(W,j+1,&w));
+        PetscCall(BVRestoreColumn(R,j,&r));
+        PetscCall(BVGetColumn(R,j+1,&r));
+        PetscCall(BVGetColumn(W,j,&w));
+        PetscCall(VecAXPY(r,ivals[j*nmat+i],w));
+        PetscCall(BVRestoreColumn(W,j,&w));
+        PetscCall(BVRestoreColumn(R,j+1,&r));
+      }
+      j++;
+    }
+#endif
+    PetscCall(BVGetMat(R,&MR));                              /* R=R+W*diag(vals_i) */
+    PetscCall(BVGetMat(W,&MW));
+    PetscCall(MatCreateVecs(MW,&d,NULL));
+    PetscCall(VecGetOwnershipRange(d,&rstart,&rend));
+    PetscCall(VecGetArray(d,&pd));
+    for (j=rstart;j<rend;j++) pd[j-rstart] = vals[j*nmat+i];
+    PetscCall(VecRestoreArray(d,&pd));
+    PetscCall(MatDiagonalScale(MW,NULL,d));
+    PetscCall(MatAXPY(MR,1.0,MW,SAME_NONZERO_PATTERN));
+    if (i==nmat-1) PetscCall(MatGetColumnNorms(MR,NORM_2,norm));
+    PetscCall(VecDestroy(&d));
+    PetscCall(BVRestoreMat(W,&MW));
+    PetscCall(BVRestoreMat(R,&MR));
+  }
+  PetscCall(BVDestroy(&R));
+  PetscCall(BVDestroy(&W));
+  PetscCall(BVSetActiveColumns(pep->V,l,k));
+  PetscCall(PetscFree2(vals,ivals));
+
+#if !defined(PETSC_USE_COMPLEX)
+  for (j=0;j<n;j++) {
+    if (pep->eigi[j]==0.0) continue;
+    norm[j] = norm[j+1] = SlepcAbsEigenvalue(norm[j],norm[j+1]);
+    j++;
+  }
+#endif
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@
    PEPComputeError - Computes the error (based on the residual norm) associated
    with the i-th computed eigenpair.
@@ -469,9 +593,6 @@ PetscErrorCode PEPComputeError(PEP pep,PetscInt i,PEPErrorType type,PetscReal *e
 {
   Vec            xr,xi,w[4];
   PetscScalar    kr,ki;
-  PetscReal      t,z=0.0;
-  PetscInt       j;
-  PetscBool      flg;
 
   PetscFunctionBegin;
   PetscValidHeaderSpecific(pep,PEP_CLASSID,1);
@@ -501,29 +622,52 @@ PetscErrorCode PEPComputeError(PEP pep,PetscInt i,PEPErrorType type,PetscReal *e
   PetscCall(PEPComputeResidualNorm_Private(pep,kr,ki,xr,xi,w,error));
 
   /* compute error */
-  switch (type) {
-    case PEP_ERROR_ABSOLUTE:
-      break;
-    case PEP_ERROR_RELATIVE:
-      *error /= SlepcAbsEigenvalue(kr,ki);
-      break;
-    case PEP_ERROR_BACKWARD:
-      /* initialization of matrix norms */
-      if (!pep->nrma[pep->nmat-1]) {
-        for (j=0;j<pep->nmat;j++) {
-          PetscCall(MatHasOperation(pep->A[j],MATOP_NORM,&flg));
-          PetscCheck(flg,PetscObjectComm((PetscObject)pep),PETSC_ERR_ARG_WRONG,"The computation of backward errors requires a matrix norm operation");
-          PetscCall(MatNorm(pep->A[j],NORM_INFINITY,&pep->nrma[j]));
-        }
-      }
-      t = SlepcAbsEigenvalue(kr,ki);
-      for (j=pep->nmat-1;j>=0;j--) {
-        z = z*t+pep->nrma[j];
-      }
-      *error /= z;
-      break;
-    default:
-      SETERRQ(PetscObjectComm((PetscObject)pep),PETSC_ERR_ARG_OUTOFRANGE,"Invalid error type");
+  PetscCall(PEPComputeError_Scale(pep,type,kr,ki,error));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   PEPComputeErrors - Computes the errors (based on the residual norm) associated
+   with all the computed eigenpairs.
+
+   Collective
+
+   Input Parameters:
++  pep  - the polynomial eigensolver context
+-  type - the type of error to compute
+
+   Output Parameter:
+.  errors - array of length nconv (see PEPGetConverged()) with the errors
+
+   Notes:
+   The result is the same as calling PEPComputeError() for i=0,...,nconv-1, but
+   all residuals are computed at once with a block product with each coefficient
+   matrix, and their norms with a single reduction.
+
+   Level: intermediate
+
+.seealso: PEPComputeError(), PEPErrorType, PEPGetConverged()
+@*/
+PetscErrorCode PEPComputeErrors(PEP pep,PEPErrorType type,PetscReal errors[])
+{
+  PetscInt  i,k;
+  PetscReal *rnorm;
+
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(pep,PEP_CLASSID,1);
+  PetscValidLogicalCollectiveEnum(pep,type,2);
+  PetscAssertPointer(errors,3);
+  PEPCheckSolved(pep,1);
+  if (!pep->nconv) PetscFunctionReturn(PETSC_SUCCESS);
+
+  PetscCall(PEPComputeVectors(pep));
+  PetscCall(PetscMalloc1(pep->nconv,&rnorm));
+  PetscCall(PEPComputeResidualNorms_Private(pep,pep->nconv,rnorm));
+  for (i=0;i<pep->nconv;i++) {
+    k = pep->perm[i];
+    errors[i] = rnorm[k];
+    PetscCall(PEPComputeError_Scale(pep,type,pep->eigr[k],pep->eigi[k],errors+i));
   }
+  PetscCall(PetscFree(rnorm));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -285,7 +285,7 @@ PetscErrorCode PEPConvergedReasonViewFromOptions(PEP pep)
 
 static PetscErrorCode PEPErrorView_ASCII(PEP pep,PEPErrorType etype,PetscViewer viewer)
 {
-  PetscReal      error;
+  PetscReal      *error;
   PetscInt       i,j,k,nvals;
 
   PetscFunctionBegin;
@@ -298,13 +298,16 @@ static PetscErrorCode PEPErrorView_ASCII(PEP pep,PEPErrorType etype,PetscViewer
     PetscCall(PetscViewerASCIIPrintf(viewer," No eigenvalues have been found\n\n"));
     PetscFunctionReturn(PETSC_SUCCESS);
   }
+  PetscCall(PetscMalloc1(pep->nconv,&error));
+  PetscCall(PEPComputeErrors(pep,etype,error));
   for (i=0;i<nvals;i++) {
-    PetscCall(PEPComputeError(pep,i,etype,&error));
-    if (error>=5.0*pep->tol) {
+    if (error[i]>=5.0*pep->tol) {
+      PetscCall(PetscFree(error));
       PetscCall(PetscViewerASCIIPrintf(viewer," Problem: some of the first %" PetscInt_FMT " relative errors are higher than the tolerance\n\n",nvals));
       PetscFunctionReturn(PETSC_SUCCESS);
     }
   }
+  PetscCall(PetscFree(error));
   if (pep->which==PEP_ALL) PetscCall(PetscViewerASCIIPrintf(viewer," Found %" PetscInt_FMT " eigenvalues, all of them computed up to the required tolerance:",nvals));
   else PetscCall(PetscViewerASCIIPrintf(viewer," All requested eigenvalues computed up to the required tolerance:"));
   for (i=0;i<=(nvals-1)/8;i++) {
@@ -321,7 +324,7 @@ static PetscErrorCode PEPErrorView_ASCII(PEP pep,PEPErrorType etype,PetscViewer
 
 static PetscErrorCode PEPErrorView_DETAIL(PEP pep,PEPErrorType etype,PetscViewer viewer)
 {
-  PetscReal      error,re,im;
+  PetscReal      *error,re,im;
   PetscScalar    kr,ki;
   PetscInt       i;
   char           ex[30],sep[]=" ---------------------- --------------------\n";
@@ -340,9 +343,10 @@ static PetscErrorCode PEPErrorView_DETAIL(PEP pep,PEPErrorType etype,PetscViewer
       break;
   }
   PetscCall(PetscViewerASCIIPrintf(viewer,"%s            k             %s\n%s",sep,ex,sep));
+  PetscCall(PetscMalloc1(pep->nconv,&error));
+  PetscCall(PEPComputeErrors(pep,etype,error));
   for (i=0;i<pep->nconv;i++) {
     PetscCall(PEPGetEigenpair(pep,i,&kr,&ki,NULL,NULL));
-    PetscCall(PEPComputeError(pep,i,etype,&error));
 #if defined(PETSC_USE_COMPLEX)
     re = PetscRealPart(kr);
     im = PetscImaginaryPart(kr);
@@ -350,26 +354,27 @@ static PetscErrorCode PEPErrorView_DETAIL(PEP pep,PEPErrorType etype,PetscViewer
     re = kr;
     im = ki;
 #endif
-    if (im!=0.0) PetscCall(PetscViewerASCIIPrintf(viewer,"  % 9f%+9fi      %12g\n",(double)re,(double)im,(double)error));
-    else PetscCall(PetscViewerASCIIPrintf(viewer,"    % 12f           %12g\n",(double)re,(double)error));
+    if (im!=0.0) PetscCall(PetscViewerASCIIPrintf(viewer,"  % 9f%+9fi      %12g\n",(double)re,(double)im,(double)error[i]));
+    else PetscCall(PetscViewerASCIIPrintf(viewer,"    % 12f           %12g\n",(double)re,(double)error[i]));
   }
+  PetscCall(PetscFree(error));
   PetscCall(PetscViewerASCIIPrintf(viewer,"%s",sep));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
 static PetscErrorCode PEPErrorView_MATLAB(PEP pep,PEPErrorType etype,PetscViewer viewer)
 {
-  PetscReal      error;
+  PetscReal      *error;
   PetscInt       i;
   const char     *name;
 
   PetscFunctionBegin;
   PetscCall(PetscObjectGetName((PetscObject)pep,&name));
   PetscCall(PetscViewerASCIIPrintf(viewer,"Error_%s = [\n",name));
-  for (i=0;i<pep->nconv;i++) {
-    PetscCall(PEPComputeError(pep,i,etype,&error));
-    PetscCall(PetscViewerASCIIPrintf(viewer,"%18.16e\n",(double)error));
-  }
+  PetscCall(PetscMalloc1(pep->nconv,&error));
+  PetscCall(PEPComputeErrors(pep,etype,error));
+  for (i=0;i<pep->nconv;i++) PetscCall(PetscViewerASCIIPrintf(viewer,"%18.16e\n",(double)error[i]));
+  PetscCall(PetscFree(error));
   PetscCall(PetscViewerASCIIPrintf(viewer,"];\n"));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
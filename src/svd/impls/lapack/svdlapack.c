@@ -8,7 +8,8 @@
    - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 */
 /*
-   This file implements a wrapper to the LAPACK SVD subroutines
+   This file implements a wrapper to the LAPACK SVD subroutines.
+   If available, xGESVDX is used to compute only the wanted singular triplets.
 */
 
 #include <slepc/private/svdimpl.h>
@@ -17,11 +18,20 @@
 static PetscErrorCode SVDSetUp_LAPACK(SVD svd)
 {
   PetscInt       M,N,P=0;
+  PetscBool      range=PETSC_FALSE;
 
   PetscFunctionBegin;
   PetscCall(MatGetSize(svd->A,&M,&N));
-  if (!svd->isgeneralized) svd->ncv = N;
-  else {
+  if (!svd->isgeneralized) {
+    svd->ncv = N;
+#if !defined(SLEPC_MISSING_LAPACK_GESVDX)
+    if (!svd->ishyperbolic && svd->nsv<PetscMin(M,N)) {
+      svd->ncv = svd->nsv;
+      range    = PETSC_TRUE;
+      PetscCall(PetscInfo(svd,"Computing only %" PetscInt_FMT " of %" PetscInt_FMT " singular triplets\n",svd->nsv,PetscMin(M,N)));
+    }
+#endif
+  } else {
     PetscCall(MatGetSize(svd->OPb,&P,NULL));
     svd->ncv = PetscMin(M,PetscMin(N,P));
   }
@@ -30,10 +40,108 @@ static PetscErrorCode SVDSetUp_LAPACK(SVD svd)
   if (svd->max_it==PETSC_DETERMINE) svd->max_it = 1;
   svd->leftbasis = PETSC_TRUE;
   PetscCall(SVDAllocateSolution(svd,0));
-  PetscCall(DSAllocate(svd->ds,PetscMax(N,PetscMax(M,P))));
+  PetscCall(DSAllocate(svd->ds,range? svd->ncv: PetscMax(N,PetscMax(M,P))));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+#if !defined(SLEPC_MISSING_LAPACK_GESVDX)
+/*
+   SVDSolve_LAPACK_Range - Computes only the nsv largest or smallest singular
+   triplets with xGESVDX, without going through the DS
+*/
+static PetscErrorCode SVDSolve_LAPACK_Range(SVD svd)
+{
+  PetscInt       M,N,n,nc,i,j,k,l,lowu,lowv,highu,highv;
+  Mat            Ar,mat;
+  Vec            u,v;
+  PetscScalar    *pA,*U,*VT,*pu,*pv,*work,sdummy;
+  PetscReal      *s,vl=0.0,vu=0.0;
+  PetscBLASInt   M_,N_,lda,ldvt,il,iu,ns,lwork,*iwork,info;
+  PetscMPIInt    len;
+#if defined(PETSC_USE_COMPLEX)
+  PetscReal      *rwork;
+#endif
+
+  PetscFunctionBegin;
+  PetscCall(MatCreateRedundantMatrix(svd->OP,0,PETSC_COMM_SELF,MAT_INITIAL_MATRIX,&Ar));
+  PetscCall(MatConvert(Ar,MATSEQDENSE,MAT_INITIAL_MATRIX,&mat));
+  PetscCall(MatDestroy(&Ar));
+  PetscCall(MatGetSize(mat,&M,&N));
+  n = PetscMin(M,N);
+  k = svd->ncv;
+  PetscCall(PetscBLASIntCast(M,&M_));
+  PetscCall(PetscBLASIntCast(N,&N_));
+  if (svd->which==SVD_LARGEST) { il = 1; PetscCall(PetscBLASIntCast(k,&iu)); }
+  else { PetscCall(PetscBLASIntCast(n-k+1,&il)); PetscCall(PetscBLASIntCast(n,&iu)); }
+  ldvt = iu-il+1;
+  PetscCall(PetscMalloc4(n,&s,M*k,&U,k*N,&VT,12*n,&iwork));
+  PetscCall(MatDenseGetArray(mat,&pA));
+  PetscCall(MatDenseGetLDA(mat,&i));
+  PetscCall(PetscBLASIntCast(i,&lda));
+
+  /* workspace query */
+  lwork = -1;
+#if defined(PETSC_USE_COMPLEX)
+  PetscCall(PetscMalloc1(n*(n*2+15*n),&rwork));
+  PetscCallBLAS("LAPACKgesvdx",LAPACKgesvdx_("V","V","I",&M_,&N_,pA,&lda,&vl,&vu,&il,&iu,&ns,s,U,&M_,VT,&ldvt,&sdummy,&lwork,rwork,iwork,&info));
+#else
+  PetscCallBLAS("LAPACKgesvdx",LAPACKgesvdx_("V","V","I",&M_,&N_,pA,&lda,&vl,&vu,&il,&iu,&ns,s,U,&M_,VT,&ldvt,&sdummy,&lwork,iwork,&info));
+#endif
+  SlepcCheckLapackInfo("gesvdx",info);
+  PetscCall(PetscBLASIntCast((PetscInt)PetscRealPart(sdummy),&lwork));
+  PetscCall(PetscMalloc1(lwork,&work));
+#if defined(PETSC_USE_COMPLEX)
+  PetscCallBLAS("LAPACKgesvdx",LAPACKgesvdx_("V","V","I",&M_,&N_,pA,&lda,&vl,&vu,&il,&iu,&ns,s,U,&M_,VT,&ldvt,work,&lwork,rwork,iwork,&info));
+  PetscCall(PetscFree(rwork));
+#else
+  PetscCallBLAS("LAPACKgesvdx",LAPACKgesvdx_("V","V","I",&M_,&N_,pA,&lda,&vl,&vu,&il,&iu,&ns,s,U,&M_,VT,&ldvt,work,&lwork,iwork,&info));
+#endif
+  SlepcCheckLapackInfo("gesvdx",info);
+  PetscCall(PetscFree(work));
+  PetscCall(MatDenseRestoreArray(mat,&pA));
+  PetscCall(MatDestroy(&mat));
+
+  /* make sure all processes have the same result */
+  nc = ns;
+  PetscCallMPI(MPI_Bcast(&nc,1,MPIU_INT,0,PetscObjectComm((PetscObject)svd)));
+  PetscCall(PetscMPIIntCast(nc,&len));
+  PetscCallMPI(MPI_Bcast(s,len,MPIU_REAL,0,PetscObjectComm((PetscObject)svd)));
+  PetscCall(PetscMPIIntCast(M*k,&len));
+  PetscCallMPI(MPI_Bcast(U,len,MPIU_SCALAR,0,PetscObjectComm((PetscObject)svd)));
+  PetscCall(PetscMPIIntCast(k*N,&len));
+  PetscCallMPI(MPI_Bcast(VT,len,MPIU_SCALAR,0,PetscObjectComm((PetscObject)svd)));
+
+  /* copy singular vectors */
+  for (i=0;i<nc;i++) {
+    j = (svd->which==SVD_SMALLEST)? nc-i-1: i;
+    svd->sigma[j] = s[i];
+    PetscCall(BVGetColumn(svd->U,j,&u));
+    PetscCall(BVGetColumn(svd->V,j,&v));
+    PetscCall(VecGetOwnershipRange(u,&lowu,&highu));
+    PetscCall(VecGetOwnershipRange(v,&lowv,&highv));
+    PetscCall(VecGetArray(u,&pu));
+    PetscCall(VecGetArray(v,&pv));
+    if (M>=N) {
+      for (l=lowu;l<highu;l++) pu[l-lowu] = U[i*M+l];
+      for (l=lowv;l<highv;l++) pv[l-lowv] = PetscConj(VT[i+l*ldvt]);  /* transpose VT returned by Lapack */
+    } else {
+      for (l=lowu;l<highu;l++) pu[l-lowu] = PetscConj(VT[i+l*ldvt]);
+      for (l=lowv;l<highv;l++) pv[l-lowv] = U[i*M+l];
+    }
+    PetscCall(VecRestoreArray(u,&pu));
+    PetscCall(VecRestoreArray(v,&pv));
+    PetscCall(BVRestoreColumn(svd->U,j,&u));
+    PetscCall(BVRestoreColumn(svd->V,j,&v));
+  }
+  PetscCall(PetscFree4(s,U,VT,iwork));
+
+  svd->nconv  = nc;
+  svd->its    = 1;
+  svd->reason = SVD_CONVERGED_TOL;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+#endif
+
 static PetscErrorCode SVDSolve_LAPACK(SVD svd)
 {
   PetscInt          M,N,n,i,j,k,ld,lowu,lowv,highu,highv;
@@ -42,6 +150,13 @@ static PetscErrorCode SVDSolve_LAPACK(SVD svd)
   PetscScalar       *pU,*pV,*pu,*pv,*w;
 
   PetscFunctionBegin;
+#if !defined(SLEPC_MISSING_LAPACK_GESVDX)
+  PetscCall(MatGetSize(svd->OP,&M,&N));
+  if (svd->ncv<PetscMin(M,N)) {
+    PetscCall(SVDSolve_LAPACK_Range(svd));
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
+#endif
   PetscCall(DSGetLeadingDimension(svd->ds,&ld));
   PetscCall(MatCreateRedundantMatrix(svd->OP,0,PETSC_COMM_SELF,MAT_INITIAL_MATRIX,&Ar));
   PetscCall(MatConvert(Ar,MATSEQDENSE,MAT_INITIAL_MATRIX,&mat));
@@ -577,3 +577,128 @@ PetscErrorCode SVDComputeError(SVD svd,PetscInt i,SVDErrorType type,PetscReal *e
   }
   PetscFunctionReturn(PETSC_SUCCESS);
 }
+
+/*
+   SVDComputeResidualNorms_Block - Computes the norms of the left and right
+   residuals of the first n columns of U and V in the standard SVD, with one
+   block product with A and one with A^T, and a single reduction for each set
+   of norms. The result is in the order of the columns.
+*/
+static PetscErrorCode SVDComputeResidualNorms_Block(SVD svd,PetscInt n,PetscReal *norm1,PetscReal *norm2)
+{
+  PetscInt    j,l,k,M,N,rstart,rend;
+  PetscScalar *pd;
+  BV          U,V,R,W;
+  Mat         MR,MW;
+  Vec         d;
+
+  PetscFunctionBegin;
+  PetscCall(MatGetSize(svd->OP,&M,&N));
+  if (M<N) { U = svd->V; V = svd->U; }
+  else { U = svd->U; V = svd->V; }
+  PetscCall(BVGetActiveColumns(U,&l,&k));
+  PetscCall(BVSetActiveColumns(U,0,n));
+  PetscCall(BVSetActiveColumns(V,0,n));
+
+  /* norm1 = ||A*v-sigma*u||_2 */
+  PetscCall(BVDuplicateResize(U,n,&R));
+  PetscCall(BVDuplicateResize(U,n,&W));
+  PetscCall(BVMatMult(V,svd->OP,R));
+  PetscCall(BVCopy(U,W));
+  PetscCall(BVGetMat(R,&MR));
+  PetscCall(BVGetMat(W,&MW));
+  PetscCall(MatCreateVecs(MW,&d,NULL));
+  PetscCall(VecGetOwnershipRange(d,&rstart,&rend));
+  PetscCall(VecGetArray(d,&pd));
+  for (j=rstart;j<rend;j++) pd[j-rstart] = -svd->sigma[j];
+  PetscCall(VecRestoreArray(d,&pd));
+  PetscCall(MatDiagonalScale(MW,NULL,d));
+  PetscCall(MatAXPY(MR,1.0,MW,SAME_NONZERO_PATTERN));
+  PetscCall(MatGetColumnNorms(MR,NORM_2,norm1));
+  PetscCall(BVRestoreMat(W,&MW));
+  PetscCall(BVRestoreMat(R,&MR));
+  PetscCall(BVDestroy(&R));
+  PetscCall(BVDestroy(&W));
+
+  /* norm2 = ||A^T*u-sigma*v||_2 */
+  PetscCall(BVDuplicateResize(V,n,&R));
+  PetscCall(BVDuplicateResize(V,n,&W));
+  PetscCall(BVMatMult(U,(M<N)?svd->A:svd->AT,R));
+  PetscCall(BVCopy(V,W));
+  PetscCall(BVGetMat(R,&MR));
+  PetscCall(BVGetMat(W,&MW));
+  PetscCall(MatDiagonalScale(MW,NULL,d));
+  PetscCall(MatAXPY(MR,1.0,MW,SAME_NONZERO_PATTERN));
+  PetscCall(MatGetColumnNorms(MR,NORM_2,norm2));
+  PetscCall(BVRestoreMat(W,&MW));
+  PetscCall(BVRestoreMat(R,&MR));
+  PetscCall(BVDestroy(&R));
+  PetscCall(BVDestroy(&W));
+  PetscCall(VecDestroy(&d));
+  PetscCall(BVSetActiveColumns(U,l,k));
+  PetscCall(BVSetActiveColumns(V,l,k));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   SVDComputeErrors - Computes the errors (based on the residual norm) associated
+   with all the computed singular triplets.
+
+   Collective
+
+   Input Parameters:
++  svd  - the singular value solver context
+-  type - the type of error to compute
+
+   Output Parameter:
+.  errors - array of length nconv (see SVDGetConverged()) with the errors
+
+   Notes:
+   The result is the same as calling SVDComputeError() for i=0,...,nconv-1.
+   In the standard SVD, all residuals are computed at once with a block product
+   with A and another one with A^T, and their norms with a single reduction.
+   In the generalized and hyperbolic cases the errors are computed one at a time.
+
+   Level: intermediate
+
+.seealso: SVDComputeError(), SVDErrorType, SVDGetConverged()
+@*/
+PetscErrorCode SVDComputeErrors(SVD svd,SVDErrorType type,PetscReal errors[])
+{
+  PetscInt  i,k;
+  PetscReal *norm1,*norm2;
+
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(svd,SVD_CLASSID,1);
+  PetscValidLogicalCollectiveEnum(svd,type,2);
+  PetscAssertPointer(errors,3);
+  SVDCheckSolved(svd,1);
+  if (!svd->nconv) PetscFunctionReturn(PETSC_SUCCESS);
+  if (svd->problem_type!=SVD_STANDARD) {
+    for (i=0;i<svd->nconv;i++) PetscCall(SVDComputeError(svd,i,type,errors+i));
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
+
+  PetscCall(SVDComputeVectors(svd));
+  PetscCall(PetscMalloc2(svd->nconv,&norm1,svd->nconv,&norm2));
+  PetscCall(SVDComputeResidualNorms_Block(svd,svd->nconv,norm1,norm2));
+  if (type==SVD_ERROR_NORM && !svd->nrma) PetscCall(MatNorm(svd->OP,NORM_INFINITY,&svd->nrma));
+  for (i=0;i<svd->nconv;i++) {
+    k = svd->perm[i];
+    errors[i] = SlepcAbs(norm1[k],norm2[k]);
+    switch (type) {
+      case SVD_ERROR_ABSOLUTE:
+        break;
+      case SVD_ERROR_RELATIVE:
+        errors[i] /= svd->sigma[k]*PETSC_SQRT2;
+        break;
+      case SVD_ERROR_NORM:
+        errors[i] /= PetscMax(svd->nrma,svd->nrmb)*PETSC_SQRT2;
+        break;
+      default:
+        SETERRQ(PetscObjectComm((PetscObject)svd),PETSC_ERR_ARG_OUTOFRANGE,"Invalid error type");
+    }
+  }
+  PetscCall(PetscFree2(norm1,norm2));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
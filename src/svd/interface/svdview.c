@@ -207,7 +207,7 @@ PetscErrorCode SVDConvergedReasonViewFromOptions(SVD svd)
 
 static PetscErrorCode SVDErrorView_ASCII(SVD svd,SVDErrorType etype,PetscViewer viewer)
 {
-  PetscReal      error,sigma;
+  PetscReal      *error,sigma;
   PetscInt       i,j;
 
   PetscFunctionBegin;
@@ -215,13 +215,16 @@ static PetscErrorCode SVDErrorView_ASCII(SVD svd,SVDErrorType etype,PetscViewer
     PetscCall(PetscViewerASCIIPrintf(viewer," Problem: less than %" PetscInt_FMT " singular values converged\n\n",svd->nsv));
     PetscFunctionReturn(PETSC_SUCCESS);
   }
+  PetscCall(PetscMalloc1(svd->nconv,&error));
+  PetscCall(SVDComputeErrors(svd,etype,error));
   for (i=0;i<svd->nsv;i++) {
-    PetscCall(SVDComputeError(svd,i,etype,&error));
-    if (error>=5.0*svd->tol) {
+    if (error[i]>=5.0*svd->tol) {
+      PetscCall(PetscFree(error));
       PetscCall(PetscViewerASCIIPrintf(viewer," Problem: some of the first %" PetscInt_FMT " relative errors are higher than the tolerance\n\n",svd->nsv));
       PetscFunctionReturn(PETSC_SUCCESS);
     }
   }
+  PetscCall(PetscFree(error));
   PetscCall(PetscViewerASCIIPrintf(viewer," All requested %ssingular values computed up to the required tolerance:",svd->isgeneralized?"generalized ":""));
   for (i=0;i<=(svd->nsv-1)/8;i++) {
     PetscCall(PetscViewerASCIIPrintf(viewer,"\n     "));
@@ -237,7 +240,7 @@ static PetscErrorCode SVDErrorView_ASCII(SVD svd,SVDErrorType etype,PetscViewer
 
 static PetscErrorCode SVDErrorView_DETAIL(SVD svd,SVDErrorType etype,PetscViewer viewer)
 {
-  PetscReal      error,sigma;
+  PetscReal      *error,sigma;
   PetscInt       i;
   char           ex[30],sep[]=" ---------------------- --------------------\n";
 
@@ -256,28 +259,30 @@ static PetscErrorCode SVDErrorView_DETAIL(SVD svd,SVDErrorType etype,PetscViewer
       break;
   }
   PetscCall(PetscViewerASCIIPrintf(viewer,"%s          sigma           %s\n%s",sep,ex,sep));
+  PetscCall(PetscMalloc1(svd->nconv,&error));
+  PetscCall(SVDComputeErrors(svd,etype,error));
   for (i=0;i<svd->nconv;i++) {
     PetscCall(SVDGetSingularTriplet(svd,i,&sigma,NULL,NULL));
-    PetscCall(SVDComputeError(svd,i,etype,&error));
-    PetscCall(PetscViewerASCIIPrintf(viewer,"       % 6f          %12g\n",(double)sigma,(double)error));
+    PetscCall(PetscViewerASCIIPrintf(viewer,"       % 6f          %12g\n",(double)sigma,(double)error[i]));
   }
+  PetscCall(PetscFree(error));
   PetscCall(PetscViewerASCIIPrintf(viewer,"%s",sep));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
 static PetscErrorCode SVDErrorView_MATLAB(SVD svd,SVDErrorType etype,PetscViewer viewer)
 {
-  PetscReal      error;
+  PetscReal      *error;
   PetscInt       i;
   const char     *name;
 
   PetscFunctionBegin;
   PetscCall(PetscObjectGetName((PetscObject)svd,&name));
   PetscCall(PetscViewerASCIIPrintf(viewer,"Error_%s = [\n",name));
-  for (i=0;i<svd->nconv;i++) {
-    PetscCall(SVDComputeError(svd,i,etype,&error));
-    PetscCall(PetscViewerASCIIPrintf(viewer,"%18.16e\n",(double)error));
-  }
+  PetscCall(PetscMalloc1(svd->nconv,&error));
+  PetscCall(SVDComputeErrors(svd,etype,error));
+  for (i=0;i<svd->nconv;i++) PetscCall(PetscViewerASCIIPrintf(viewer,"%18.16e\n",(double)error[i]));
+  PetscCall(PetscFree(error));
   PetscCall(PetscViewerASCIIPrintf(viewer,"];\n"));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -195,4 +195,14 @@ int main(int argc,char **argv)
          suffix: 4_hip_cross
          args: -svd_type cross
 
+   testset:
+      args: -svd_type lapack -svd_nsv 3 -svd_monitor_cancel
+      requires: !defined(SLEPC_MISSING_LAPACK_GESVDX)
+      filter: grep -v "Transpose mode"
+      test:
+         suffix: 5_largest
+      test:
+         suffix: 5_smallest
+         args: -svd_smallest
+
 TEST*/
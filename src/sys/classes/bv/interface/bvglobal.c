@@ -795,6 +795,41 @@ PetscErrorCode BVNormColumnEnd(BV bv,PetscInt j,NormType type,PetscReal *val)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+  BVNormalize_Matrix_Private - Normalization of the active columns with respect to the
+  B-norm: the product B*V is computed with a single BVMatMult() and only the diagonal
+  of V'*B*V is formed, with local dot products and one global reduction
+*/
+static PetscErrorCode BVNormalize_Matrix_Private(BV bv)
+{
+  PetscInt          i,j,k=bv->k-bv->l,ld,ldc;
+  const PetscScalar *pv,*pw;
+  PetscScalar       *work,*dots;
+  PetscReal         norm;
+
+  PetscFunctionBegin;
+  if (!k) PetscFunctionReturn(PETSC_SUCCESS);
+  PetscCall(BV_IPMatMultBV(bv));
+  PetscCall(BVGetLeadingDimension(bv,&ld));
+  PetscCall(BVGetLeadingDimension(bv->cached,&ldc));
+  PetscCall(PetscMalloc2(k,&work,k,&dots));
+  PetscCall(BVGetArrayRead(bv,&pv));
+  PetscCall(BVGetArrayRead(bv->cached,&pw));
+  for (j=0;j<k;j++) {
+    work[j] = 0.0;
+    for (i=0;i<bv->n;i++) work[j] += PetscConj(pv[i+(bv->nc+bv->l+j)*ld])*pw[i+(bv->cached->nc+bv->l+j)*ldc];
+  }
+  PetscCall(BVRestoreArrayRead(bv->cached,&pw));
+  PetscCall(BVRestoreArrayRead(bv,&pv));
+  PetscCallMPI(MPIU_Allreduce(work,dots,k,MPIU_SCALAR,MPIU_SUM,PetscObjectComm((PetscObject)bv)));
+  for (j=0;j<k;j++) {
+    PetscCall(BV_SafeSqrt(bv,dots[j],&norm));
+    PetscCall(BVScaleColumn(bv,bv->l+j,1.0/norm));
+  }
+  PetscCall(PetscFree2(work,dots));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@
    BVNormalize - Normalize all columns (starting from the leading ones).
 
@@ -817,7 +852,9 @@ PetscErrorCode BVNormColumnEnd(BV bv,PetscInt j,NormType type,PetscReal *val)
    that they contain the real and imaginary parts of a complex conjugate pair of
    eigenvectors.
 
-   If eigi is passed, the inner-product matrix is ignored.
+   If eigi is passed, the inner-product matrix is ignored. Otherwise, in the case of
+   a non-standard inner product, the product with the matrix is done for all columns
+   at once, and all norms are computed with a single global reduction.
 
    If there are leading columns, they are not modified (are assumed to be already
    normalized).
@@ -828,21 +865,14 @@ PetscErrorCode BVNormColumnEnd(BV bv,PetscInt j,NormType type,PetscReal *val)
 @*/
 PetscErrorCode BVNormalize(BV bv,PetscScalar *eigi)
 {
-  PetscReal      norm;
-  PetscInt       i;
-
   PetscFunctionBegin;
   PetscValidHeaderSpecific(bv,BV_CLASSID,1);
   PetscValidType(bv,1);
   BVCheckSizes(bv,1);
 
   PetscCall(PetscLogEventBegin(BV_Normalize,bv,0,0,0));
-  if (bv->matrix && !eigi) {
-    for (i=bv->l;i<bv->k;i++) {
-      PetscCall(BVNormColumn(bv,i,NORM_2,&norm));
-      PetscCall(BVScaleColumn(bv,i,1.0/norm));
-    }
-  } else PetscTryTypeMethod(bv,normalize,eigi);
+  if (bv->matrix && !eigi) PetscCall(BVNormalize_Matrix_Private(bv));
+  else PetscTryTypeMethod(bv,normalize,eigi);
   PetscCall(PetscLogEventEnd(BV_Normalize,bv,0,0,0));
   PetscCall(PetscObjectStateIncrease((PetscObject)bv));
   PetscFunctionReturn(PETSC_SUCCESS);
@@ -15,6 +15,10 @@
       multiplication:    f(x) = f1(x)*f2(x)
       division:          f(x) = f1(x)/f2(x)      f(A) = f2(A)\f1(A)
       composition:       f(x) = f2(f1(x))
+
+   Method 0 evaluates the matrix function by combining the matrix functions of
+   the children, while method 1 applies the Schur-Parlett algorithm directly to
+   the scalar combined function, avoiding intermediate dense matrix functions.
 */
 
 #include <slepc/private/fnimpl.h>      /*I "slepcfn.h" I*/
@@ -200,6 +204,7 @@ static PetscErrorCode FNView_Combine(FN fn,PetscViewer viewer)
         PetscCall(PetscViewerASCIIPrintf(viewer,"  two composed functions f2(f1(.))\n"));
         break;
     }
+    if (fn->method==1) PetscCall(PetscViewerASCIIPrintf(viewer,"  computing matrix functions with: Schur-Parlett\n"));
     PetscCall(PetscViewerASCIIPushTab(viewer));
     PetscCall(FNView(ctx->f1,viewer));
     PetscCall(FNView(ctx->f2,viewer));
@@ -328,6 +333,7 @@ SLEPC_EXTERN PetscErrorCode FNCreate_Combine(FN fn)
   fn->ops->evaluatefunction          = FNEvaluateFunction_Combine;
   fn->ops->evaluatederivative        = FNEvaluateDerivative_Combine;
   fn->ops->evaluatefunctionmat[0]    = FNEvaluateFunctionMat_Combine;
+  fn->ops->evaluatefunctionmat[1]    = FNEvaluateFunctionMat_SchurParlett;
   fn->ops->evaluatefunctionmatvec[0] = FNEvaluateFunctionMatVec_Combine;
 #if defined(PETSC_HAVE_CUDA)
   fn->ops->evaluatefunctionmatcuda[0]    = FNEvaluateFunctionMat_Combine;
@@ -710,8 +710,9 @@ static PetscInt ell(PetscBLASInt n,PetscScalar *A,PetscReal coeff,PetscInt m,Pet
 
 /*
  * Compute scaling parameter (s) and order of Pade approximant (m)  (required workspace is 4*n*n)
+ * If rnd is NULL then a random generator is created internally
  */
-static PetscErrorCode expm_params(PetscInt n,PetscScalar **Apowers,PetscInt *s,PetscInt *m,PetscScalar *work)
+static PetscErrorCode expm_params(PetscInt n,PetscScalar **Apowers,PetscInt *s,PetscInt *m,PetscScalar *work,PetscRandom rnd)
 {
   PetscScalar     sfactor,sone=1.0,szero=0.0,*A=Apowers[0],*Ascaled;
   PetscReal       d4,d6,d8,d10,eta1,eta3,eta4,eta5,rwork[1];
@@ -729,7 +730,8 @@ static PetscErrorCode expm_params(PetscInt n,PetscScalar **Apowers,PetscInt *s,P
   *s = 0;
   *m = 13;
   PetscCall(PetscBLASIntCast(n,&n_));
-  PetscCall(PetscRandomCreate(PETSC_COMM_SELF,&rand));
+  if (rnd) rand = rnd;
+  else PetscCall(PetscRandomCreate(PETSC_COMM_SELF,&rand));
   d4 = PetscPowReal(LAPACKlange_("O",&n_,&n_,Apowers[2],&n_,rwork),1.0/4.0);
   if (d4==0.0) { /* safeguard for the case A = 0 */
     *m = 3;
@@ -784,7 +786,7 @@ static PetscErrorCode expm_params(PetscInt n,PetscScalar **Apowers,PetscInt *s,P
   } else Ascaled = A;
   *s += ell(n_,Ascaled,coeff[4],13,work,rand);
 done:
-  PetscCall(PetscRandomDestroy(&rand));
+  if (!rnd) PetscCall(PetscRandomDestroy(&rand));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -794,13 +796,13 @@ done:
  *     N. J. Higham, "The scaling and squaring method for the matrix exponential
  *     revisited", SIAM J. Matrix Anal. Appl. 26(4):1179-1193, 2005.
  */
-PetscErrorCode FNEvaluateFunctionMat_Exp_Higham(FN fn,Mat A,Mat B)
+static PetscErrorCode FNExpmHigham_Private(PetscInt n,const PetscScalar *Aa,PetscScalar *Ba,PetscScalar *work,PetscBLASInt *ipiv,PetscRandom rand)
 {
-  PetscBLASInt      n_=0,n2,*ipiv,info,one=1;
-  PetscInt          n,m,j,s;
+  PetscBLASInt      n_=0,n2,info,one=1;
+  PetscInt          m,j,s;
   PetscScalar       scale,smone=-1.0,sone=1.0,stwo=2.0,szero=0.0;
-  PetscScalar       *Ba,*Apowers[5],*Q,*P,*W,*work,*aux;
-  const PetscScalar *Aa,*c;
+  PetscScalar       *Apowers[5],*Q,*P,*W,*aux;
+  const PetscScalar *c;
   const PetscScalar c3[4]   = { 120, 60, 12, 1 };
   const PetscScalar c5[6]   = { 30240, 15120, 3360, 420, 30, 1 };
   const PetscScalar c7[8]   = { 17297280, 8648640, 1995840, 277200, 25200, 1512, 56, 1 };
@@ -812,12 +814,8 @@ PetscErrorCode FNEvaluateFunctionMat_Exp_Higham(FN fn,Mat A,Mat B)
                                 40840800,          960960,            16380,  182,  1 };
 
   PetscFunctionBegin;
-  PetscCall(MatDenseGetArrayRead(A,&Aa));
-  PetscCall(MatDenseGetArray(B,&Ba));
-  PetscCall(MatGetSize(A,&n,NULL));
   PetscCall(PetscBLASIntCast(n,&n_));
   n2 = n_*n_;
-  PetscCall(PetscMalloc2(8*n*n,&work,n,&ipiv));
 
   /* Matrix powers */
   Apowers[0] = work;                  /* Apowers[0] = A   */
@@ -833,7 +831,7 @@ PetscErrorCode FNEvaluateFunctionMat_Exp_Higham(FN fn,Mat A,Mat B)
   PetscCall(PetscLogFlops(6.0*n*n*n));
 
   /* Compute scaling parameter and order of Pade approximant */
-  PetscCall(expm_params(n,Apowers,&s,&m,Apowers[4]));
+  PetscCall(expm_params(n,Apowers,&s,&m,Apowers[4],rand));
 
   if (s) { /* rescale */
     for (j=0;j<4;j++) {
@@ -925,13 +923,67 @@ PetscErrorCode FNEvaluateFunctionMat_Exp_Higham(FN fn,Mat A,Mat B)
   }
   if (P!=Ba) PetscCall(PetscArraycpy(Ba,P,n2));
   PetscCall(PetscLogFlops(2.0*n*n*n*s));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
 
+PetscErrorCode FNEvaluateFunctionMat_Exp_Higham(FN fn,Mat A,Mat B)
+{
+  PetscBLASInt      *ipiv;
+  PetscInt          n;
+  PetscScalar       *Ba,*work;
+  const PetscScalar *Aa;
+
+  PetscFunctionBegin;
+  PetscCall(MatDenseGetArrayRead(A,&Aa));
+  PetscCall(MatDenseGetArray(B,&Ba));
+  PetscCall(MatGetSize(A,&n,NULL));
+  PetscCall(PetscMalloc2(8*n*n,&work,n,&ipiv));
+  PetscCall(FNExpmHigham_Private(n,Aa,Ba,work,ipiv,NULL));
   PetscCall(PetscFree2(work,ipiv));
   PetscCall(MatDenseRestoreArrayRead(A,&Aa));
   PetscCall(MatDenseRestoreArray(B,&Ba));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   Batched version of Higham's method: the workspace and the random generator
+   used in the estimation of the scaling and Pade parameters are shared across
+   all the matrices of the batch
+*/
+static PetscErrorCode FNEvaluateFunctionMatBatched_Exp_Higham(FN fn,PetscInt nmat,Mat *A,Mat *B)
+{
+  PetscBLASInt      *ipiv;
+  PetscInt          i,n,nmax=0;
+  PetscScalar       *Ba,*work;
+  const PetscScalar *Aa;
+  PetscRandom       rand;
+
+  PetscFunctionBegin;
+  for (i=0;i<nmat;i++) {
+    PetscCall(MatGetSize(A[i],&n,NULL));
+    nmax = PetscMax(nmax,n);
+  }
+  PetscCall(PetscMalloc2(8*nmax*nmax,&work,nmax,&ipiv));
+  PetscCall(PetscRandomCreate(PETSC_COMM_SELF,&rand));
+  for (i=0;i<nmat;i++) {
+    PetscCall(MatGetSize(A[i],&n,NULL));
+    if (A[i]==B[i]) {
+      PetscCall(MatDenseGetArray(B[i],&Ba));
+      PetscCall(FNExpmHigham_Private(n,Ba,Ba,work,ipiv,rand));
+      PetscCall(MatDenseRestoreArray(B[i],&Ba));
+    } else {
+      PetscCall(MatDenseGetArrayRead(A[i],&Aa));
+      PetscCall(MatDenseGetArray(B[i],&Ba));
+      PetscCall(FNExpmHigham_Private(n,Aa,Ba,work,ipiv,rand));
+      PetscCall(MatDenseRestoreArrayRead(A[i],&Aa));
+      PetscCall(MatDenseRestoreArray(B[i],&Ba));
+    }
+  }
+  PetscCall(PetscRandomDestroy(&rand));
+  PetscCall(PetscFree2(work,ipiv));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 #if defined(PETSC_HAVE_CUDA)
 #include "../src/sys/classes/fn/impls/cuda/fnutilcuda.h"
 #include <slepccupmblas.h>
@@ -1273,7 +1325,7 @@ PetscErrorCode FNEvaluateFunctionMat_Exp_Higham_CUDAm(FN fn,Mat A,Mat B)
   PetscCallCUDA(cudaMemcpy(Apowers[1],d_Apowers[1],3*n2*sizeof(PetscScalar),cudaMemcpyDeviceToHost));
   PetscCall(PetscLogGpuToCpu(4*n2*sizeof(PetscScalar)));
   /* Compute scaling parameter and order of Pade approximant */
-  PetscCall(expm_params(n,Apowers,&s,&m,Apowers[4]));
+  PetscCall(expm_params(n,Apowers,&s,&m,Apowers[4],NULL));
 
   if (s) { /* rescale */
     for (j=0;j<4;j++) {
@@ -1699,6 +1751,7 @@ SLEPC_EXTERN PetscErrorCode FNCreate_Exp(FN fn)
   fn->ops->evaluatefunctionmat[1] = FNEvaluateFunctionMat_Exp_Pade;
   fn->ops->evaluatefunctionmat[2] = FNEvaluateFunctionMat_Exp_GuettelNakatsukasa; /* product form */
   fn->ops->evaluatefunctionmat[3] = FNEvaluateFunctionMat_Exp_GuettelNakatsukasa; /* partial fraction */
+  fn->ops->evaluatefunctionmatbatched[0] = FNEvaluateFunctionMatBatched_Exp_Higham;
 #if defined(PETSC_HAVE_CUDA)
   fn->ops->evaluatefunctionmatcuda[1] = FNEvaluateFunctionMat_Exp_Pade_CUDA;
 #if defined(PETSC_HAVE_MAGMA)
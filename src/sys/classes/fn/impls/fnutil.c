@@ -74,21 +74,36 @@ static PetscErrorCode SlepcMatDenseSqrt(PetscBLASInt n,PetscScalar *T,PetscBLASI
 
 #define BLOCKSIZE 64
 
+/*
+   Workspace needed by FNSqrtmSchur_Private() for a matrix of order n: number
+   of scalars, reals and integers, respectively.
+ */
+PetscErrorCode FNSqrtmSchurWorkSize(PetscBLASInt n,PetscBool firstonly,PetscInt *lwork,PetscInt *lrwork,PetscInt *liwork)
+{
+  PetscInt k = firstonly? 1: n;
+
+  PetscFunctionBegin;
+  if (lwork) *lwork = (PetscInt)n*n+(PetscInt)n*k+6*(PetscInt)n;
+  if (lrwork) *lrwork = n;
+  if (liwork) *liwork = 2*((n+BLOCKSIZE-1)/BLOCKSIZE);
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*
    Schur method for the square root of an upper quasi-triangular matrix T.
    T is overwritten with sqrtm(T).
    If firstonly then only the first column of T will contain relevant values.
+   The workspace is provided by the caller, with the sizes given by
+   FNSqrtmSchurWorkSize(), so that it can be shared across several calls.
  */
-PetscErrorCode FNSqrtmSchur(FN fn,PetscBLASInt n,PetscScalar *T,PetscBLASInt ld,PetscBool firstonly)
+PetscErrorCode FNSqrtmSchur_Private(PetscBLASInt n,PetscScalar *T,PetscBLASInt ld,PetscBool firstonly,PetscScalar *swork,PetscReal *rwork,PetscBLASInt *iwork)
 {
   PetscBLASInt   i,j,k,r,ione=1,sdim,lwork,*s,*p,info,bs=BLOCKSIZE;
   PetscScalar    *wr,*W,*Q,*work,one=1.0,zero=0.0,mone=-1.0;
   PetscInt       m,nblk;
   PetscReal      scal;
-#if defined(PETSC_USE_COMPLEX)
-  PetscReal      *rwork;
-#else
-  PetscReal      *wi;
+#if !defined(PETSC_USE_COMPLEX)
+  PetscReal      *wi = rwork;
 #endif
 
   PetscFunctionBegin;
@@ -96,13 +111,17 @@ PetscErrorCode FNSqrtmSchur(FN fn,PetscBLASInt n,PetscScalar *T,PetscBLASInt ld,
   nblk  = (m+bs-1)/bs;
   lwork = 5*n;
   k     = firstonly? 1: n;
+  wr    = swork;
+  W     = wr+m;
+  Q     = W+m*k;
+  work  = Q+m*m;
+  s     = iwork;
+  p     = iwork+nblk;
 
   /* compute Schur decomposition A*Q = Q*T */
 #if !defined(PETSC_USE_COMPLEX)
-  PetscCall(PetscMalloc7(m,&wr,m,&wi,m*k,&W,m*m,&Q,lwork,&work,nblk,&s,nblk,&p));
   PetscCallBLAS("LAPACKgees",LAPACKgees_("V","N",NULL,&n,T,&ld,&sdim,wr,wi,Q,&ld,work,&lwork,NULL,&info));
 #else
-  PetscCall(PetscMalloc7(m,&wr,m,&rwork,m*k,&W,m*m,&Q,lwork,&work,nblk,&s,nblk,&p));
   PetscCallBLAS("LAPACKgees",LAPACKgees_("V","N",NULL,&n,T,&ld,&sdim,wr,Q,&ld,work,&lwork,rwork,NULL,&info));
 #endif
   SlepcCheckLapackInfo("gees",info);
@@ -140,12 +159,26 @@ PetscErrorCode FNSqrtmSchur(FN fn,PetscBLASInt n,PetscScalar *T,PetscBLASInt ld,
 
   /* flop count: Schur decomposition, triangular square root, and backtransform */
   PetscCall(PetscLogFlops(25.0*n*n*n+n*n*n/3.0+4.0*n*n*k));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
 
-#if !defined(PETSC_USE_COMPLEX)
-  PetscCall(PetscFree7(wr,wi,W,Q,work,s,p));
-#else
-  PetscCall(PetscFree7(wr,rwork,W,Q,work,s,p));
-#endif
+/*
+   Schur method for the square root of an upper quasi-triangular matrix T.
+   T is overwritten with sqrtm(T).
+   If firstonly then only the first column of T will contain relevant values.
+ */
+PetscErrorCode FNSqrtmSchur(FN fn,PetscBLASInt n,PetscScalar *T,PetscBLASInt ld,PetscBool firstonly)
+{
+  PetscInt       lwork,lrwork,liwork;
+  PetscScalar    *work;
+  PetscReal      *rwork;
+  PetscBLASInt   *iwork;
+
+  PetscFunctionBegin;
+  PetscCall(FNSqrtmSchurWorkSize(n,firstonly,&lwork,&lrwork,&liwork));
+  PetscCall(PetscMalloc3(lwork,&work,lrwork,&rwork,liwork,&iwork));
+  PetscCall(FNSqrtmSchur_Private(n,T,ld,firstonly,work,rwork,iwork));
+  PetscCall(PetscFree3(work,rwork,iwork));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -641,3 +674,326 @@ PetscErrorCode SlepcNormAm(PetscBLASInt n,PetscScalar *A,PetscInt m,PetscScalar
   }
   PetscFunctionReturn(PETSC_SUCCESS);
 }
+
+#define SP_DELTA  0.1   /* tolerance for clustering eigenvalues in Schur-Parlett */
+#define SP_NNODES 32    /* number of nodes of the polynomial approximation in clustered blocks */
+#define SP_TOL    (1e4*PETSC_MACHINE_EPSILON)   /* accepted error estimate of the approximation */
+
+/*
+   Determine whether the function has a singularity or a branch point at the origin,
+   with the branch cut along the negative real axis (square root, logarithm)
+*/
+static PetscErrorCode FNSchurParlettSingularAtZero(FN fn,PetscBool *sing)
+{
+  PetscBool     iscomb;
+  FNCombineType ctype;
+  FN            f1,f2;
+
+  PetscFunctionBegin;
+  PetscCall(PetscObjectTypeCompareAny((PetscObject)fn,sing,FNSQRT,FNINVSQRT,FNLOG,""));
+  PetscCall(PetscObjectTypeCompare((PetscObject)fn,FNCOMBINE,&iscomb));
+  if (iscomb) {
+    PetscCall(FNCombineGetChildren(fn,&ctype,&f1,&f2));
+    PetscCall(FNSchurParlettSingularAtZero(f1,sing));
+    if (!*sing) PetscCall(FNSchurParlettSingularAtZero(f2,sing));
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   Coefficients of the polynomial approximation of f around sigma with N nodes.
+   In complex scalars, c_k*rho^k where c_k are the Taylor coefficients obtained with
+   the trapezoidal rule on the circle of radius rho. In real scalars, the Chebyshev
+   coefficients on [sigma-rho,sigma+rho].
+*/
+static PetscErrorCode FNSchurParlettCoeffs(FN fn,PetscScalar sigma,PetscReal rho,PetscInt N,PetscScalar *fz,PetscScalar *c)
+{
+  PetscInt  j,k;
+#if !defined(PETSC_USE_COMPLEX)
+  PetscReal x;
+#endif
+
+  PetscFunctionBegin;
+#if defined(PETSC_USE_COMPLEX)
+  for (j=0;j<N;j++) PetscUseTypeMethod(fn,evaluatefunction,sigma+rho*PetscExpComplex(PetscCMPLX(0.0,2.0*PETSC_PI*j/N)),fz+j);
+  for (k=0;k<N;k++) {
+    c[k] = 0.0;
+    for (j=0;j<N;j++) c[k] += fz[j]*PetscExpComplex(PetscCMPLX(0.0,-2.0*PETSC_PI*j*k/N));
+    c[k] /= N;
+  }
+#else
+  for (j=0;j<N;j++) {
+    x = PetscCosReal(PETSC_PI*(j+0.5)/N);
+    PetscUseTypeMethod(fn,evaluatefunction,sigma+rho*x,fz+j);
+  }
+  for (k=0;k<N;k++) {
+    c[k] = 0.0;
+    for (j=0;j<N;j++) c[k] += fz[j]*PetscCosReal(PETSC_PI*k*(j+0.5)/N);
+    c[k] *= 2.0/N;
+  }
+  c[0] /= 2.0;
+#endif
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   Evaluate F = f(T) where T is an upper triangular block of order s with a
+   cluster of eigenvalues around their mean sigma. Blocks of order one are
+   evaluated directly. Otherwise, in complex scalars the truncated Taylor series
+   about sigma is used, with f'(sigma) obtained from the derivative of the FN and
+   the higher order coefficients from the trapezoidal rule applied to the Cauchy
+   integral on a circle enclosing the cluster. In real scalars all eigenvalues
+   are real and a Chebyshev interpolant on an interval containing the cluster
+   is evaluated with the Clenshaw recurrence.
+
+   For functions that are singular at the origin, the circle (or interval) is
+   shrunk so that it does not reach the origin or the branch cut. The error of
+   the approximation is estimated by comparing the coefficients obtained with
+   SP_NNODES and 2*SP_NNODES nodes. If the cluster is too close to the origin or
+   the estimate is not small enough, the block is evaluated with the specific
+   matrix method of the FN type, if any. The workspace has room for 4*s*s.
+*/
+static PetscErrorCode FNSchurParlettDiagBlock(FN fn,PetscBLASInt s,PetscScalar *T,PetscBLASInt ld,PetscScalar *F,PetscScalar *work)
+{
+  PetscInt       i,j,k,K=0,N=2*SP_NNODES;
+  PetscScalar    sigma=0.0,c[2*SP_NNODES],c0[SP_NNODES],fz[2*SP_NNODES],*M=work,*P=work+s*s,*R=work+2*s*s,*aux,sone=1.0,szero=0.0,*pA;
+  PetscReal      spread=0.0,rho,dist,cmax=0.0,err=0.0;
+  PetscBool      sing,ok=PETSC_TRUE;
+  Mat            Ablk,Fblk;
+#if defined(PETSC_USE_COMPLEX)
+  PetscReal      nrmM,tk,rwork[1];
+#else
+  PetscScalar    stwo=2.0,*S=work+3*s*s;
+#endif
+
+  PetscFunctionBegin;
+  if (s==1) {
+    PetscUseTypeMethod(fn,evaluatefunction,T[0],F);
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
+  for (i=0;i<s;i++) sigma += T[i+i*ld];
+  sigma /= s;
+  for (i=0;i<s;i++) spread = PetscMax(spread,PetscAbsScalar(T[i+i*ld]-sigma));
+#if defined(PETSC_USE_COMPLEX)
+  rho  = PetscMax(2.0*spread,SP_DELTA);
+  dist = (PetscRealPart(sigma)>=0.0)? PetscAbsScalar(sigma): PetscAbsReal(PetscImaginaryPart(sigma));  /* distance to (-inf,0] */
+#else
+  rho  = PetscMax(spread,SP_DELTA/2.0);
+  dist = sigma;
+#endif
+
+  /* keep the nodes away from the singular set of the function */
+  PetscCall(FNSchurParlettSingularAtZero(fn,&sing));
+  if (sing) {
+    if (dist<=spread) ok = PETSC_FALSE;
+    else rho = PetscMin(rho,(spread+dist)/2.0);
+  }
+
+  /* error estimate from the difference between the coefficients with N/2 and N nodes */
+  if (ok) {
+    PetscCall(FNSchurParlettCoeffs(fn,sigma,rho,N/2,fz,c0));
+    PetscCall(FNSchurParlettCoeffs(fn,sigma,rho,N,fz,c));
+    for (k=0;k<N;k++) cmax = PetscMax(cmax,PetscAbsScalar(c[k]));
+    for (k=0;k<N/2;k++) err = PetscMax(err,PetscAbsScalar(c[k]-c0[k]));
+    if (PetscIsInfOrNanReal(err) || err>SP_TOL*cmax) ok = PETSC_FALSE;
+  }
+  if (!ok) {
+    PetscCheck(fn->ops->evaluatefunctionmat[0],PETSC_COMM_SELF,PETSC_ERR_CONV_FAILED,"Unable to evaluate the function accurately on a cluster of eigenvalues around %g",(double)PetscRealPart(sigma));
+    PetscCall(PetscInfo(fn,"Cluster of %" PetscBLASInt_FMT " eigenvalues around %g evaluated with the specific method of the FN\n",s,(double)PetscRealPart(sigma)));
+    PetscCall(MatCreateSeqDense(PETSC_COMM_SELF,s,s,NULL,&Ablk));
+    PetscCall(MatCreateSeqDense(PETSC_COMM_SELF,s,s,NULL,&Fblk));
+    PetscCall(MatDenseGetArray(Ablk,&pA));
+    for (j=0;j<s;j++) for (i=0;i<s;i++) pA[i+j*s] = (i<=j)? T[i+j*ld]: 0.0;
+    PetscCall(MatDenseRestoreArray(Ablk,&pA));
+    PetscUseTypeMethod(fn,evaluatefunctionmat[0],Ablk,Fblk);
+    PetscCall(MatDenseGetArray(Fblk,&pA));
+    for (j=0;j<s;j++) for (i=0;i<s;i++) F[i+j*ld] = pA[i+j*s];
+    PetscCall(MatDenseRestoreArray(Fblk,&pA));
+    PetscCall(MatDestroy(&Ablk));
+    PetscCall(MatDestroy(&Fblk));
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
+
+  /* M = T-sigma*I */
+  for (j=0;j<s;j++) for (i=0;i<s;i++) M[i+j*s] = (i<=j)? T[i+j*ld]: 0.0;
+  for (i=0;i<s;i++) M[i+i*s] -= sigma;
+  cmax = 0.0;
+
+#if defined(PETSC_USE_COMPLEX)
+  /* Taylor coefficients c_k = f^(k)(sigma)/k! */
+  for (k=0;k<N;k++) c[k] /= PetscPowRealInt(rho,k);
+  PetscUseTypeMethod(fn,evaluatefunction,sigma,c);
+  if (fn->ops->evaluatederivative) PetscUseTypeMethod(fn,evaluatederivative,sigma,c+1);
+  /* truncate the series when the terms are negligible */
+  nrmM = LAPACKlange_("F",&s,&s,M,&s,rwork);
+  for (k=0,tk=1.0;k<N;k++,tk*=nrmM) cmax = PetscMax(cmax,PetscAbsScalar(c[k])*tk);
+  for (k=0,tk=1.0;k<N;k++,tk*=nrmM) if (PetscAbsScalar(c[k])*tk>PETSC_MACHINE_EPSILON*cmax) K = k;
+  /* Horner scheme, P = sum_k c_k*M^k */
+  PetscCall(PetscArrayzero(P,s*s));
+  for (i=0;i<s;i++) P[i+i*s] = c[K];
+  for (k=K-1;k>=0;k--) {
+    PetscCallBLAS("BLASgemm",BLASgemm_("N","N",&s,&s,&s,&sone,P,&s,M,&s,&szero,R,&s));
+    for (i=0;i<s;i++) R[i+i*s] += c[k];
+    SlepcSwap(P,R,aux);
+  }
+  PetscCall(PetscLogFlops(2.0*s*s*s*K));
+#else
+  /* Chebyshev coefficients of f on [sigma-rho,sigma+rho] */
+  for (k=0;k<N;k++) cmax = PetscMax(cmax,PetscAbsScalar(c[k]));
+  for (k=0;k<N;k++) if (PetscAbsScalar(c[k])>PETSC_MACHINE_EPSILON*cmax) K = k;
+  /* Clenshaw recurrence with X = M/rho, P=b_{k+1}, R=b_{k+2} */
+  for (j=0;j<s;j++) for (i=0;i<s;i++) M[i+j*s] /= rho;
+  PetscCall(PetscArrayzero(P,s*s));
+  PetscCall(PetscArrayzero(R,s*s));
+  for (k=K;k>=1;k--) {
+    PetscCallBLAS("BLASgemm",BLASgemm_("N","N",&s,&s,&s,&stwo,M,&s,P,&s,&szero,S,&s));
+    for (i=0;i<s*s;i++) S[i] -= R[i];
+    for (i=0;i<s;i++) S[i+i*s] += c[k];
+    aux = R; R = P; P = S; S = aux;
+  }
+  /* f(T) = c_0*I + X*b_1 - b_2 */
+  PetscCallBLAS("BLASgemm",BLASgemm_("N","N",&s,&s,&s,&sone,M,&s,P,&s,&szero,S,&s));
+  for (i=0;i<s*s;i++) S[i] -= R[i];
+  for (i=0;i<s;i++) S[i+i*s] += c[0];
+  P = S;
+  PetscCall(PetscLogFlops(2.0*s*s*s*(K+1)));
+#endif
+  for (j=0;j<s;j++) for (i=0;i<s;i++) F[i+j*ld] = P[i+j*s];
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   General matrix function evaluation by the blocked Schur-Parlett algorithm of
+   Davies and Higham, that only requires the evaluation of f (and f') at scalar
+   values, so it can be used for any FN type.
+
+     P. I. Davies and N. J. Higham, "A Schur-Parlett algorithm for computing
+     matrix functions", SIAM J. Matrix Anal. Appl. 25(2):464-485, 2003.
+
+   The eigenvalues of the Schur form are clustered and reordered so that close
+   eigenvalues lie in the same diagonal block, which is evaluated with
+   FNSchurParlettDiagBlock(), while the off-diagonal blocks are obtained from the
+   block Parlett recurrence, solving a Sylvester equation for each of them.
+   In real scalars only matrices with real eigenvalues are supported.
+*/
+PetscErrorCode FNEvaluateFunctionMat_SchurParlett(FN fn,Mat A,Mat B)
+{
+  PetscBLASInt      n=0,ld,sdim,lwork,info,ifst,ilst,isgn=-1,r,*s,*pos;
+  PetscInt          m,i,j,k,p,q,c,nc=0,nblk=0,*cl;
+  PetscScalar       *T,*Q,*F,*W,*wr,*work,*Ba,one=1.0,zero=0.0,mone=-1.0,sscal;
+  const PetscScalar *Aa;
+  PetscReal         scal;
+#if defined(PETSC_USE_COMPLEX)
+  PetscReal         *rwork;
+#else
+  PetscReal         *wi;
+#endif
+
+  PetscFunctionBegin;
+  PetscCall(MatGetSize(A,&m,NULL));
+  PetscCall(PetscBLASIntCast(m,&n));
+  ld    = n;
+  lwork = 5*n;
+#if defined(PETSC_USE_COMPLEX)
+  PetscCall(PetscMalloc6(m*m,&T,m*m,&Q,m*m,&F,4*m*m,&W,m,&wr,lwork,&work));
+  PetscCall(PetscMalloc4(m,&rwork,m,&cl,m,&s,m,&pos));
+#else
+  PetscCall(PetscMalloc6(m*m,&T,m*m,&Q,m*m,&F,4*m*m,&W,m,&wr,lwork,&work));
+  PetscCall(PetscMalloc4(m,&wi,m,&cl,m,&s,m,&pos));
+#endif
+  PetscCall(MatDenseGetArrayRead(A,&Aa));
+  PetscCall(PetscArraycpy(T,Aa,m*m));
+  PetscCall(MatDenseRestoreArrayRead(A,&Aa));
+
+  /* compute Schur decomposition A*Q = Q*T */
+#if !defined(PETSC_USE_COMPLEX)
+  PetscCallBLAS("LAPACKgees",LAPACKgees_("V","N",NULL,&n,T,&ld,&sdim,wr,wi,Q,&ld,work,&lwork,NULL,&info));
+#else
+  PetscCallBLAS("LAPACKgees",LAPACKgees_("V","N",NULL,&n,T,&ld,&sdim,wr,Q,&ld,work,&lwork,rwork,NULL,&info));
+#endif
+  SlepcCheckLapackInfo("gees",info);
+#if !defined(PETSC_USE_COMPLEX)
+  for (j=0;j<m-1;j++) PetscCheck(T[j+1+j*ld]==0.0,PETSC_COMM_SELF,PETSC_ERR_SUP,"The Schur-Parlett method requires complex scalars for matrices with complex eigenvalues");
+#endif
+
+  /* cluster eigenvalues that are closer than delta, merging clusters transitively */
+  for (i=0;i<m;i++) cl[i] = -1;
+  for (i=0;i<m;i++) {
+    if (cl[i]==-1) cl[i] = nc++;
+    for (j=i+1;j<m;j++) {
+      if (PetscAbsScalar(T[i+i*ld]-T[j+j*ld])>SP_DELTA) continue;
+      if (cl[j]==-1) cl[j] = cl[i];
+      else if (cl[j]!=cl[i]) {
+        c = cl[j];
+        for (k=0;k<m;k++) if (cl[k]==c) cl[k] = cl[i];
+      }
+    }
+  }
+
+  /* reorder the Schur form so that each cluster forms a contiguous diagonal block */
+  p = 0;
+  while (p<m) {
+    c = cl[p];
+    for (q=p+1;q<m;q++) {
+      if (cl[q]!=c) continue;
+      if (q>p+1) {
+        PetscCall(PetscBLASIntCast(q+1,&ifst));
+        PetscCall(PetscBLASIntCast(p+2,&ilst));
+#if !defined(PETSC_USE_COMPLEX)
+        PetscCallBLAS("LAPACKtrexc",LAPACKtrexc_("V",&n,T,&ld,Q,&ld,&ifst,&ilst,work,&info));
+#else
+        PetscCallBLAS("LAPACKtrexc",LAPACKtrexc_("V",&n,T,&ld,Q,&ld,&ifst,&ilst,&info));
+#endif
+        SlepcCheckLapackInfo("trexc",info);
+        for (k=q;k>p+1;k--) cl[k] = cl[k-1];
+        cl[p+1] = c;
+      }
+      p++;
+    }
+    p++;
+  }
+  for (i=0;i<m;) {
+    j = i;
+    while (j<m && cl[j]==cl[i]) j++;
+    PetscCall(PetscBLASIntCast(i,pos+nblk));
+    PetscCall(PetscBLASIntCast(j-i,s+nblk));
+    nblk++;
+    i = j;
+  }
+  PetscCall(PetscInfo(fn,"Schur-Parlett with %" PetscInt_FMT " diagonal blocks for a matrix of order %" PetscInt_FMT "\n",nblk,m));
+
+  /* block Parlett recurrence */
+  PetscCall(PetscArrayzero(F,m*m));
+  for (j=0;j<nblk;j++) {
+    PetscCall(FNSchurParlettDiagBlock(fn,s[j],T+pos[j]*(ld+1),ld,F+pos[j]*(ld+1),W));
+    for (i=j-1;i>=0;i--) {
+      /* right-hand side F_ii*T_ij - T_ij*F_jj + sum_k (F_ik*T_kj - T_ik*F_kj) */
+      r = pos[j]-pos[i];
+      PetscCallBLAS("BLASgemm",BLASgemm_("N","N",s+i,s+j,&r,&one,F+pos[i]+pos[i]*ld,&ld,T+pos[i]+pos[j]*ld,&ld,&zero,F+pos[i]+pos[j]*ld,&ld));
+      r = pos[j]+s[j]-pos[i]-s[i];
+      PetscCallBLAS("BLASgemm",BLASgemm_("N","N",s+i,s+j,&r,&mone,T+pos[i]+(pos[i]+s[i])*ld,&ld,F+pos[i]+s[i]+pos[j]*ld,&ld,&one,F+pos[i]+pos[j]*ld,&ld));
+      /* solve Sylvester equation T_ii*F_ij - F_ij*T_jj = rhs */
+      PetscCallBLAS("LAPACKtrsyl",LAPACKtrsyl_("N","N",&isgn,s+i,s+j,T+pos[i]+pos[i]*ld,&ld,T+pos[j]+pos[j]*ld,&ld,F+pos[i]+pos[j]*ld,&ld,&scal,&info));
+      SlepcCheckLapackInfo("trsyl",info);
+      if (scal!=1.0) {
+        sscal = 1.0/scal;
+        for (k=0;k<s[j];k++) for (q=0;q<s[i];q++) F[pos[i]+q+(pos[j]+k)*ld] *= sscal;
+      }
+    }
+  }
+
+  /* backtransform B = Q*F*Q' */
+  PetscCall(MatDenseGetArray(B,&Ba));
+  PetscCallBLAS("BLASgemm",BLASgemm_("N","C",&n,&n,&n,&one,F,&ld,Q,&ld,&zero,W,&ld));
+  PetscCallBLAS("BLASgemm",BLASgemm_("N","N",&n,&n,&n,&one,Q,&ld,W,&ld,&zero,Ba,&ld));
+  PetscCall(MatDenseRestoreArray(B,&Ba));
+  PetscCall(PetscLogFlops(25.0*m*m*m+m*m*m/3.0+4.0*m*m*m));
+
+  PetscCall(PetscFree6(T,Q,F,W,wr,work));
+#if defined(PETSC_USE_COMPLEX)
+  PetscCall(PetscFree4(rwork,cl,s,pos));
+#else
+  PetscCall(PetscFree4(wi,cl,s,pos));
+#endif
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
@@ -51,6 +51,38 @@ static PetscErrorCode FNEvaluateFunctionMat_Sqrt_Schur(FN fn,Mat A,Mat B)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   Batched version of the Schur method, the workspace is allocated only once
+   for the largest matrix in the batch
+*/
+static PetscErrorCode FNEvaluateFunctionMatBatched_Sqrt_Schur(FN fn,PetscInt nmat,Mat *A,Mat *B)
+{
+  PetscBLASInt   n=0;
+  PetscScalar    *T,*work;
+  PetscReal      *rwork;
+  PetscBLASInt   *iwork;
+  PetscInt       i,m,mmax=0,lwork,lrwork,liwork;
+
+  PetscFunctionBegin;
+  for (i=0;i<nmat;i++) {
+    PetscCall(MatGetSize(A[i],&m,NULL));
+    mmax = PetscMax(mmax,m);
+  }
+  PetscCall(PetscBLASIntCast(mmax,&n));
+  PetscCall(FNSqrtmSchurWorkSize(n,PETSC_FALSE,&lwork,&lrwork,&liwork));
+  PetscCall(PetscMalloc3(lwork,&work,lrwork,&rwork,liwork,&iwork));
+  for (i=0;i<nmat;i++) {
+    if (A[i]!=B[i]) PetscCall(MatCopy(A[i],B[i],SAME_NONZERO_PATTERN));
+    PetscCall(MatDenseGetArray(B[i],&T));
+    PetscCall(MatGetSize(A[i],&m,NULL));
+    PetscCall(PetscBLASIntCast(m,&n));
+    PetscCall(FNSqrtmSchur_Private(n,T,n,PETSC_FALSE,work,rwork,iwork));
+    PetscCall(MatDenseRestoreArray(B[i],&T));
+  }
+  PetscCall(PetscFree3(work,rwork,iwork));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode FNEvaluateFunctionMatVec_Sqrt_Schur(FN fn,Mat A,Vec v)
 {
   PetscBLASInt   n=0;
@@ -416,6 +448,7 @@ SLEPC_EXTERN PetscErrorCode FNCreate_Sqrt(FN fn)
 #endif /* PETSC_HAVE_MAGMA */
 #endif /* PETSC_HAVE_CUDA */
   fn->ops->evaluatefunctionmatvec[0] = FNEvaluateFunctionMatVec_Sqrt_Schur;
+  fn->ops->evaluatefunctionmatbatched[0] = FNEvaluateFunctionMatBatched_Sqrt_Schur;
   fn->ops->view                      = FNView_Sqrt;
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -514,9 +514,15 @@ PetscErrorCode FNEvaluateDerivative(FN fn,PetscScalar x,PetscScalar *y)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
-static PetscErrorCode FNEvaluateFunctionMat_Sym_Private(FN fn,const PetscScalar *As,PetscScalar *Bs,PetscInt m,PetscBool firstonly)
+/*
+   FNEvaluateFunctionMat_Sym_Private - given a symmetric matrix A, computes f_l(A) for
+   each of the nfn functions with the spectral decomposition of A, which is computed only
+   once. The result for the l-th function is stored in Bs[l], which is skipped if NULL.
+   If firstonly is set, only the first column of each f_l(A) is computed.
+*/
+static PetscErrorCode FNEvaluateFunctionMat_Sym_Private(PetscInt nfn,FN *fn,const PetscScalar *As,PetscScalar **Bs,PetscInt m,PetscBool firstonly)
 {
-  PetscInt       i,j;
+  PetscInt       i,j,l,cnt=0;
   PetscBLASInt   n,k,ld,lwork,info;
   PetscScalar    *Q,*W,*work,adummy,a,x,y,one=1.0,zero=0.0;
   PetscReal      *eig,dummy;
@@ -550,20 +556,24 @@ static PetscErrorCode FNEvaluateFunctionMat_Sym_Private(FN fn,const PetscScalar
 #endif
   SlepcCheckLapackInfo("syev",info);
 
-  /* W = f(Lambda)*Q' */
-  for (i=0;i<n;i++) {
-    x = fn->alpha*eig[i];
-    PetscUseTypeMethod(fn,evaluatefunction,x,&y);  /* y = f(x) */
-    for (j=0;j<k;j++) W[i+j*ld] = PetscConj(Q[j+i*ld])*fn->beta*y;
+  for (l=0;l<nfn;l++) {
+    if (!Bs[l]) continue;
+    /* W = f(Lambda)*Q' */
+    for (i=0;i<n;i++) {
+      x = fn[l]->alpha*eig[i];
+      PetscUseTypeMethod(fn[l],evaluatefunction,x,&y);  /* y = f(x) */
+      for (j=0;j<k;j++) W[i+j*ld] = PetscConj(Q[j+i*ld])*fn[l]->beta*y;
+    }
+    /* Bs = Q*W */
+    PetscCallBLAS("BLASgemm",BLASgemm_("N","N",&n,&k,&n,&one,Q,&ld,W,&ld,&zero,Bs[l],&ld));
+    cnt++;
   }
-  /* Bs = Q*W */
-  PetscCallBLAS("BLASgemm",BLASgemm_("N","N",&n,&k,&n,&one,Q,&ld,W,&ld,&zero,Bs,&ld));
 #if defined(PETSC_USE_COMPLEX)
   PetscCall(PetscFree5(eig,Q,W,work,rwork));
 #else
   PetscCall(PetscFree4(eig,Q,W,work));
 #endif
-  PetscCall(PetscLogFlops(9.0*n*n*n+2.0*n*n*n));
+  PetscCall(PetscLogFlops(9.0*n*n*n+2.0*n*n*k*cnt));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -582,7 +592,7 @@ static PetscErrorCode FNEvaluateFunctionMat_Sym_Default(FN fn,Mat A,Mat B)
   PetscCall(MatDenseGetArrayRead(A,&As));
   PetscCall(MatDenseGetArray(B,&Bs));
   PetscCall(MatGetSize(A,&m,NULL));
-  PetscCall(FNEvaluateFunctionMat_Sym_Private(fn,As,Bs,m,PETSC_FALSE));
+  PetscCall(FNEvaluateFunctionMat_Sym_Private(1,&fn,As,&Bs,m,PETSC_FALSE));
   PetscCall(MatDenseRestoreArrayRead(A,&As));
   PetscCall(MatDenseRestoreArray(B,&Bs));
   PetscFunctionReturn(PETSC_SUCCESS);
@@ -598,8 +608,11 @@ static PetscErrorCode FNEvaluateFunctionMat_Basic(FN fn,Mat A,Mat F)
   if (iscuda && fn->ops->evaluatefunctionmatcuda[fn->method]) PetscUseTypeMethod(fn,evaluatefunctionmatcuda[fn->method],A,F);
   else if (fn->ops->evaluatefunctionmat[fn->method]) PetscUseTypeMethod(fn,evaluatefunctionmat[fn->method],A,F);
   else {
-    PetscCheck(fn->method,PetscObjectComm((PetscObject)fn),PETSC_ERR_SUP,"Matrix functions not implemented in this FN type");
     PetscCheck(!fn->method,PetscObjectComm((PetscObject)fn),PETSC_ERR_ARG_OUTOFRANGE,"The specified method number does not exist for this FN type");
+    PetscCheck(fn->ops->evaluatefunction,PetscObjectComm((PetscObject)fn),PETSC_ERR_SUP,"Matrix functions not implemented in this FN type");
+    /* no specific method, fall back to the general Schur-Parlett algorithm */
+    PetscCall(PetscInfo(fn,"Computing matrix function with the Schur-Parlett algorithm\n"));
+    PetscCall(FNEvaluateFunctionMat_SchurParlett(fn,A,F));
   }
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -679,6 +692,11 @@ PetscErrorCode FNEvaluateFunctionMat_Private(FN fn,Mat A,Mat B,PetscBool sync)
    Scaling factors are taken into account, so the actual function evaluation
    will return beta*f(alpha*A).
 
+   If the FN type does not provide a specific method for matrix functions, the
+   blocked Schur-Parlett algorithm is used, which only requires evaluating the
+   function (and its derivative) at scalar values. In real scalars, this is
+   restricted to matrices with real eigenvalues.
+
    Level: advanced
 
 .seealso: FNEvaluateFunction(), FNEvaluateFunctionMatVec(), FNSetMethod()
@@ -717,6 +735,251 @@ PetscErrorCode FNEvaluateFunctionMat(FN fn,Mat A,Mat B)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   FNEvaluateFunctionMatBatched_Private - evaluates f(A[i]) for all matrices in the batch,
+   storing the result in F[i] (F[i] may be equal to A[i] for in-place computation). Matrices
+   that qualify for the type-specific batched method are processed together, sharing the
+   workspace, and synchronization in parallel runs is done with a single message.
+*/
+static PetscErrorCode FNEvaluateFunctionMatBatched_Private(FN fn,PetscInt nmat,Mat *A,Mat *F)
+{
+  PetscBool         set,flg,iscuda,hasspecificmeth;
+  PetscInt          i,k=0,m,nt=0,off;
+  PetscMPIInt       size,rank,nt2;
+  PetscScalar       *pF,*buf;
+  const PetscScalar *cF;
+  Mat               *M,*G;
+
+  PetscFunctionBegin;
+  PetscCallMPI(MPI_Comm_size(PetscObjectComm((PetscObject)fn),&size));
+  PetscCallMPI(MPI_Comm_rank(PetscObjectComm((PetscObject)fn),&rank));
+  if (size==1 || fn->pmode==FN_PARALLEL_REDUNDANT || (fn->pmode==FN_PARALLEL_SYNCHRONIZED && !rank)) {
+    PetscCall(PetscFPTrapPush(PETSC_FP_TRAP_OFF));
+    PetscCall(PetscMalloc2(nmat,&M,nmat,&G));
+    for (i=0;i<nmat;i++) {
+      PetscCall(MatIsHermitianKnown(A[i],&set,&flg));
+      PetscCall(PetscObjectTypeCompare((PetscObject)A[i],MATSEQDENSECUDA,&iscuda));
+      hasspecificmeth = ((iscuda && fn->ops->evaluatefunctionmatcuda[fn->method]) || (!iscuda && fn->method && fn->ops->evaluatefunctionmat[fn->method]))? PETSC_TRUE: PETSC_FALSE;
+      if (!hasspecificmeth && set && flg && !fn->method) PetscCall(FNEvaluateFunctionMat_Sym_Default(fn,A[i],F[i]));
+      else if (iscuda || !fn->ops->evaluatefunctionmatbatched[fn->method]) PetscCall(FNEvaluateFunctionMat_Private(fn,A[i],F[i],PETSC_FALSE));
+      else {
+        /* scale argument directly in the destination matrix, so no work matrices are needed */
+        if (fn->alpha!=(PetscScalar)1.0) {
+          if (F[i]!=A[i]) PetscCall(MatCopy(A[i],F[i],SAME_NONZERO_PATTERN));
+          PetscCall(MatScale(F[i],fn->alpha));
+          M[k] = F[i];
+        } else M[k] = A[i];
+        G[k++] = F[i];
+      }
+    }
+    if (k) {
+      PetscCall(PetscInfo(fn,"Computing %" PetscInt_FMT " matrix functions in batched mode\n",k));
+      PetscUseTypeMethod(fn,evaluatefunctionmatbatched[fn->method],k,M,G);
+      for (i=0;i<k;i++) PetscCall(MatScale(G[i],fn->beta));
+    }
+    PetscCall(PetscFree2(M,G));
+    PetscCall(PetscFPTrapPop());
+  }
+  if (size>1 && fn->pmode==FN_PARALLEL_SYNCHRONIZED) {  /* synchronize all matrices with one message */
+    for (i=0;i<nmat;i++) {
+      PetscCall(MatGetSize(F[i],&m,NULL));
+      nt += m*m;
+    }
+    PetscCall(PetscMalloc1(nt,&buf));
+    for (i=0,off=0;i<nmat && !rank;i++) {
+      PetscCall(MatGetSize(F[i],&m,NULL));
+      PetscCall(MatDenseGetArrayRead(F[i],&cF));
+      PetscCall(PetscArraycpy(buf+off,cF,m*m));
+      PetscCall(MatDenseRestoreArrayRead(F[i],&cF));
+      off += m*m;
+    }
+    PetscCall(PetscMPIIntCast(nt,&nt2));
+    PetscCallMPI(MPI_Bcast(buf,nt2,MPIU_SCALAR,0,PetscObjectComm((PetscObject)fn)));
+    for (i=0,off=0;i<nmat && rank;i++) {
+      PetscCall(MatGetSize(F[i],&m,NULL));
+      PetscCall(MatDenseGetArrayWrite(F[i],&pF));
+      PetscCall(PetscArraycpy(pF,buf+off,m*m));
+      PetscCall(MatDenseRestoreArrayWrite(F[i],&pF));
+      off += m*m;
+    }
+    PetscCall(PetscFree(buf));
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   FNEvaluateFunctionMatBatched - Computes the value of the function f(A) for
+   several matrices A, where the results are also matrices.
+
+   Logically Collective
+
+   Input Parameters:
++  fn   - the math function context
+.  nmat - number of matrices
+-  A    - array of matrices on which the function must be evaluated
+
+   Output Parameter:
+.  B    - (optional) array of matrices resulting from evaluating f(A[i])
+
+   Notes:
+   This is equivalent to calling FNEvaluateFunctionMat() for each of the nmat
+   matrices, but the fixed overhead of each call is reduced. The workspace
+   required by the selected method is allocated only once (for the largest
+   matrix) and shared by all matrices in the batch, no work matrices are
+   allocated to apply the scaling factor, and in the 'synchronized' parallel
+   mode all the results are broadcast in a single message.
+
+   The matrices A[i] must be square sequential dense Mat, possibly of different
+   sizes. If B is provided, then B[i] must have the same type and dimensions as A[i].
+   If B is NULL then the computation is done in-place, overwriting A[i] with f(A[i]).
+
+   Level: advanced
+
+.seealso: FNEvaluateFunctionMat(), FNEvaluateFunctionsMat()
+@*/
+PetscErrorCode FNEvaluateFunctionMatBatched(FN fn,PetscInt nmat,Mat A[],Mat B[])
+{
+  PetscInt       i,m,n,n1;
+  MatType        type;
+  Mat            *F;
+
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(fn,FN_CLASSID,1);
+  PetscValidType(fn,1);
+  PetscValidLogicalCollectiveInt(fn,nmat,2);
+  PetscCheck(nmat>=0,PetscObjectComm((PetscObject)fn),PETSC_ERR_ARG_OUTOFRANGE,"Number of matrices cannot be negative");
+  if (!nmat) PetscFunctionReturn(PETSC_SUCCESS);
+  PetscAssertPointer(A,3);
+  for (i=0;i<nmat;i++) {
+    PetscValidHeaderSpecific(A[i],MAT_CLASSID,3);
+    PetscValidType(A[i],3);
+    PetscCheckTypeNames(A[i],MATSEQDENSE,MATSEQDENSECUDA);
+    PetscCall(MatGetSize(A[i],&m,&n));
+    PetscCheck(m==n,PetscObjectComm((PetscObject)fn),PETSC_ERR_ARG_SIZ,"Mat A[%" PetscInt_FMT "] is not square (has %" PetscInt_FMT " rows, %" PetscInt_FMT " cols)",i,m,n);
+    if (B) {
+      PetscValidHeaderSpecific(B[i],MAT_CLASSID,4);
+      PetscValidType(B[i],4);
+      PetscCall(MatGetType(A[i],&type));
+      PetscCheckTypeName(B[i],type);
+      n1 = n;
+      PetscCall(MatGetSize(B[i],&m,&n));
+      PetscCheck(m==n && n1==n,PetscObjectComm((PetscObject)fn),PETSC_ERR_ARG_SIZ,"Matrices A[%" PetscInt_FMT "] and B[%" PetscInt_FMT "] must be square with the same dimension",i,i);
+    }
+  }
+
+  /* evaluate matrix functions */
+  PetscCall(PetscLogEventBegin(FN_Evaluate,fn,0,0,0));
+  if (B) F = B;
+  else F = A;
+  PetscCall(FNEvaluateFunctionMatBatched_Private(fn,nmat,A,F));
+  PetscCall(PetscLogEventEnd(FN_Evaluate,fn,0,0,0));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   FNEvaluateFunctionsMat - Computes the value of several functions f_i(A) for
+   a given matrix A, where the results are also matrices.
+
+   Logically Collective
+
+   Input Parameters:
++  nfn - number of functions
+.  fn  - array of math function contexts
+-  A   - matrix on which the functions must be evaluated
+
+   Output Parameter:
+.  B   - array of matrices resulting from evaluating f_i(A)
+
+   Notes:
+   This is equivalent to calling FNEvaluateFunctionMat() for each of the nfn
+   functions, but the analysis of matrix A is shared whenever possible. For
+   instance, if A is known to be Hermitian then its spectral decomposition is
+   computed only once and reused for all functions that would be evaluated
+   via diagonalization.
+
+   Matrix A must be a square sequential dense Mat, and B[i] must have the same
+   type and dimensions as A. In-place computation is not allowed, i.e., none
+   of the B[i] can be equal to A.
+
+   Level: advanced
+
+.seealso: FNEvaluateFunctionMat(), FNEvaluateFunctionMatBatched()
+@*/
+PetscErrorCode FNEvaluateFunctionsMat(PetscInt nfn,FN fn[],Mat A,Mat B[])
+{
+  PetscBool         set,flg,symm,iscuda,*shared;
+  PetscInt          i,m,n,n1,nshared=0;
+  PetscMPIInt       size,rank,n2;
+  MatType           type;
+  const PetscScalar *As;
+  PetscScalar       **Bs,*pF;
+
+  PetscFunctionBegin;
+  PetscCheck(nfn>=0,PETSC_COMM_SELF,PETSC_ERR_ARG_OUTOFRANGE,"Number of functions cannot be negative");
+  if (!nfn) PetscFunctionReturn(PETSC_SUCCESS);
+  PetscAssertPointer(fn,2);
+  PetscValidHeaderSpecific(fn[0],FN_CLASSID,2);
+  PetscValidLogicalCollectiveInt(fn[0],nfn,1);
+  PetscValidHeaderSpecific(A,MAT_CLASSID,3);
+  PetscValidType(A,3);
+  PetscAssertPointer(B,4);
+  PetscCheckTypeNames(A,MATSEQDENSE,MATSEQDENSECUDA);
+  PetscCall(MatGetSize(A,&m,&n));
+  PetscCheck(m==n,PETSC_COMM_SELF,PETSC_ERR_ARG_SIZ,"Mat A is not square (has %" PetscInt_FMT " rows, %" PetscInt_FMT " cols)",m,n);
+  PetscCall(MatGetType(A,&type));
+  n1 = n;
+  for (i=0;i<nfn;i++) {
+    PetscValidHeaderSpecific(fn[i],FN_CLASSID,2);
+    PetscValidType(fn[i],2);
+    PetscValidHeaderSpecific(B[i],MAT_CLASSID,4);
+    PetscValidType(B[i],4);
+    PetscCheck(B[i]!=A,PetscObjectComm((PetscObject)fn[i]),PETSC_ERR_ARG_IDN,"In-place computation is not allowed, B[%" PetscInt_FMT "] must be different from A",i);
+    PetscCheckTypeName(B[i],type);
+    PetscCall(MatGetSize(B[i],&m,&n));
+    PetscCheck(m==n && n1==n,PetscObjectComm((PetscObject)fn[i]),PETSC_ERR_ARG_SIZ,"Matrices A and B[%" PetscInt_FMT "] must be square with the same dimension",i);
+  }
+
+  PetscCall(PetscLogEventBegin(FN_Evaluate,fn[0],0,0,0));
+  PetscCall(MatIsHermitianKnown(A,&set,&flg));
+  symm = set? flg: PETSC_FALSE;
+  PetscCall(PetscObjectTypeCompare((PetscObject)A,MATSEQDENSECUDA,&iscuda));
+
+  /* functions that would be evaluated via diagonalization share the spectral decomposition */
+  PetscCall(PetscCalloc2(nfn,&shared,nfn,&Bs));
+  if (symm && !iscuda) for (i=0;i<nfn;i++) if (!fn[i]->method) { shared[i] = PETSC_TRUE; nshared++; }
+  if (nshared>1) {
+    for (i=0;i<nfn;i++) {
+      if (!shared[i]) continue;
+      PetscCallMPI(MPI_Comm_size(PetscObjectComm((PetscObject)fn[i]),&size));
+      PetscCallMPI(MPI_Comm_rank(PetscObjectComm((PetscObject)fn[i]),&rank));
+      if (size==1 || fn[i]->pmode==FN_PARALLEL_REDUNDANT || (fn[i]->pmode==FN_PARALLEL_SYNCHRONIZED && !rank)) PetscCall(MatDenseGetArray(B[i],&Bs[i]));
+    }
+    PetscCall(PetscInfo(fn[0],"Computing %" PetscInt_FMT " matrix functions via a shared diagonalization\n",nshared));
+    PetscCall(PetscFPTrapPush(PETSC_FP_TRAP_OFF));
+    PetscCall(MatDenseGetArrayRead(A,&As));
+    PetscCall(FNEvaluateFunctionMat_Sym_Private(nfn,fn,As,Bs,n1,PETSC_FALSE));
+    PetscCall(MatDenseRestoreArrayRead(A,&As));
+    PetscCall(PetscFPTrapPop());
+    for (i=0;i<nfn;i++) if (Bs[i]) PetscCall(MatDenseRestoreArray(B[i],&Bs[i]));
+  } else PetscCall(PetscArrayzero(shared,nfn));
+
+  for (i=0;i<nfn;i++) {
+    if (!shared[i]) PetscCall(FNEvaluateFunctionMat_Private(fn[i],A,B[i],PETSC_TRUE));
+    else {
+      PetscCallMPI(MPI_Comm_size(PetscObjectComm((PetscObject)fn[i]),&size));
+      if (size>1 && fn[i]->pmode==FN_PARALLEL_SYNCHRONIZED) {  /* synchronize */
+        PetscCall(MatDenseGetArray(B[i],&pF));
+        PetscCall(PetscMPIIntCast(n1*n1,&n2));
+        PetscCallMPI(MPI_Bcast(pF,n2,MPIU_SCALAR,0,PetscObjectComm((PetscObject)fn[i])));
+        PetscCall(MatDenseRestoreArray(B[i],&pF));
+      }
+    }
+  }
+  PetscCall(PetscFree2(shared,Bs));
+  PetscCall(PetscLogEventEnd(FN_Evaluate,fn[0],0,0,0));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*
    FNEvaluateFunctionMatVec_Default - computes the full matrix f(A)
    and then copies the first column.
@@ -748,7 +1011,7 @@ static PetscErrorCode FNEvaluateFunctionMatVec_Sym_Default(FN fn,Mat A,Vec v)
   PetscCall(MatDenseGetArrayRead(A,&As));
   PetscCall(VecGetArray(v,&vs));
   PetscCall(MatGetSize(A,&m,NULL));
-  PetscCall(FNEvaluateFunctionMat_Sym_Private(fn,As,vs,m,PETSC_TRUE));
+  PetscCall(FNEvaluateFunctionMat_Sym_Private(1,&fn,As,&vs,m,PETSC_TRUE));
   PetscCall(MatDenseRestoreArrayRead(A,&As));
   PetscCall(VecRestoreArray(v,&vs));
   PetscFunctionReturn(PETSC_SUCCESS);
@@ -0,0 +1,135 @@
+/*
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+   SLEPc - Scalable Library for Eigenvalue Problem Computations
+   Copyright (c) 2002-, Universitat Politecnica de Valencia, Spain
+
+   This file is part of SLEPc.
+   SLEPc is distributed under a 2-clause BSD license (see LICENSE).
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+*/
+
+static char help[] = "Test batched evaluation of matrix functions.\n\n"
+  "The command line options are:\n"
+  "  -n <n>, where <n> = dimension of the largest matrix.\n"
+  "  -nmat <nmat>, where <nmat> = number of matrices in the batch.\n\n";
+
+#include <slepcfn.h>
+
+/* Fill A with a non-symmetric (or symmetric) Toeplitz matrix with positive eigenvalues */
+static PetscErrorCode FillMatrix(Mat A,PetscBool symm)
+{
+  PetscInt       i,j,n;
+  PetscScalar    *As;
+
+  PetscFunctionBeginUser;
+  PetscCall(MatGetSize(A,&n,NULL));
+  PetscCall(MatDenseGetArray(A,&As));
+  for (i=0;i<n;i++) As[i+i*n] = 2.5;
+  for (j=1;j<3;j++) {
+    for (i=0;i<n-j;i++) {
+      As[i+(i+j)*n] = 0.5;
+      As[(i+j)+i*n] = symm? 0.5: -0.5;
+    }
+  }
+  PetscCall(MatDenseRestoreArray(A,&As));
+  if (symm) PetscCall(MatSetOption(A,MAT_HERMITIAN,PETSC_TRUE));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+int main(int argc,char **argv)
+{
+  FN             fn,fns[3];
+  Mat            *A,*B,*C,S,F[3],G;
+  PetscInt       i,n=20,nmat=4,m;
+  PetscReal      nrm,nrmb,err,tol=1000*PETSC_MACHINE_EPSILON;
+  PetscBool      inplace;
+
+  PetscFunctionBeginUser;
+  PetscCall(SlepcInitialize(&argc,&argv,NULL,help));
+  PetscCall(PetscOptionsGetInt(NULL,NULL,"-n",&n,NULL));
+  PetscCall(PetscOptionsGetInt(NULL,NULL,"-nmat",&nmat,NULL));
+  PetscCall(PetscOptionsHasName(NULL,NULL,"-inplace",&inplace));
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD,"Batched matrix functions, n=%" PetscInt_FMT ", nmat=%" PetscInt_FMT ".\n",n,nmat));
+
+  PetscCall(FNCreate(PETSC_COMM_WORLD,&fn));
+  PetscCall(FNSetType(fn,FNEXP));
+  PetscCall(FNSetFromOptions(fn));
+
+  /* Create a batch of matrices of different sizes */
+  PetscCall(PetscMalloc3(nmat,&A,nmat,&B,nmat,&C));
+  for (i=0;i<nmat;i++) {
+    m = PetscMax(1,n-2*i);
+    PetscCall(MatCreateSeqDense(PETSC_COMM_SELF,m,m,NULL,&A[i]));
+    PetscCall(FillMatrix(A[i],PETSC_FALSE));
+    PetscCall(MatDuplicate(A[i],MAT_COPY_VALUES,&B[i]));
+    PetscCall(MatDuplicate(A[i],MAT_DO_NOT_COPY_VALUES,&C[i]));
+  }
+
+  /* Compare batched evaluation with one-by-one evaluation */
+  if (inplace) PetscCall(FNEvaluateFunctionMatBatched(fn,nmat,B,NULL));
+  else PetscCall(FNEvaluateFunctionMatBatched(fn,nmat,A,B));
+  err = 0.0;
+  for (i=0;i<nmat;i++) {
+    PetscCall(FNEvaluateFunctionMat(fn,A[i],C[i]));
+    PetscCall(MatNorm(B[i],NORM_FROBENIUS,&nrmb));
+    PetscCall(MatAXPY(C[i],-1.0,B[i],SAME_NONZERO_PATTERN));
+    PetscCall(MatNorm(C[i],NORM_FROBENIUS,&nrm));
+    err = PetscMax(err,nrm/nrmb);
+  }
+  if (err<tol) PetscCall(PetscPrintf(PETSC_COMM_WORLD,"Batched evaluation: difference below tolerance\n"));
+  else PetscCall(PetscPrintf(PETSC_COMM_WORLD,"Batched evaluation: difference %g\n",(double)err));
+
+  /* Evaluate several functions on the same symmetric matrix */
+  PetscCall(FNCreate(PETSC_COMM_WORLD,&fns[0]));
+  PetscCall(FNSetType(fns[0],FNEXP));
+  PetscCall(FNCreate(PETSC_COMM_WORLD,&fns[1]));
+  PetscCall(FNSetType(fns[1],FNSQRT));
+  PetscCall(FNSetScale(fns[1],0.5,2.0));
+  PetscCall(FNCreate(PETSC_COMM_WORLD,&fns[2]));
+  PetscCall(FNSetType(fns[2],FNLOG));
+  PetscCall(MatCreateSeqDense(PETSC_COMM_SELF,n,n,NULL,&S));
+  PetscCall(FillMatrix(S,PETSC_TRUE));
+  PetscCall(MatDuplicate(S,MAT_DO_NOT_COPY_VALUES,&G));
+  for (i=0;i<3;i++) PetscCall(MatDuplicate(S,MAT_DO_NOT_COPY_VALUES,&F[i]));
+  PetscCall(FNEvaluateFunctionsMat(3,fns,S,F));
+  err = 0.0;
+  for (i=0;i<3;i++) {
+    PetscCall(FNEvaluateFunctionMat(fns[i],S,G));
+    PetscCall(MatNorm(F[i],NORM_FROBENIUS,&nrmb));
+    PetscCall(MatAXPY(G,-1.0,F[i],SAME_NONZERO_PATTERN));
+    PetscCall(MatNorm(G,NORM_FROBENIUS,&nrm));
+    err = PetscMax(err,nrm/nrmb);
+  }
+  if (err<tol) PetscCall(PetscPrintf(PETSC_COMM_WORLD,"Several functions: difference below tolerance\n"));
+  else PetscCall(PetscPrintf(PETSC_COMM_WORLD,"Several functions: difference %g\n",(double)err));
+
+  for (i=0;i<3;i++) {
+    PetscCall(MatDestroy(&F[i]));
+    PetscCall(FNDestroy(&fns[i]));
+  }
+  PetscCall(MatDestroy(&S));
+  PetscCall(MatDestroy(&G));
+  for (i=0;i<nmat;i++) {
+    PetscCall(MatDestroy(&A[i]));
+    PetscCall(MatDestroy(&B[i]));
+    PetscCall(MatDestroy(&C[i]));
+  }
+  PetscCall(PetscFree3(A,B,C));
+  PetscCall(FNDestroy(&fn));
+  PetscCall(SlepcFinalize());
+  return 0;
+}
+
+/*TEST
+
+   testset:
+      output_file: output/test14_1.out
+      requires: !single
+      test:
+         suffix: 1
+         args: -fn_type {{exp sqrt}} -fn_scale 0.3,1.5
+      test:
+         suffix: 1_inplace
+         args: -fn_type {{exp sqrt}} -inplace
+
+TEST*/
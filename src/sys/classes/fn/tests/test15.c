@@ -0,0 +1,127 @@
+/*
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+   SLEPc - Scalable Library for Eigenvalue Problem Computations
+   Copyright (c) 2002-, Universitat Politecnica de Valencia, Spain
+
+   This file is part of SLEPc.
+   SLEPc is distributed under a 2-clause BSD license (see LICENSE).
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+*/
+
+static char help[] = "Test the Schur-Parlett algorithm for general matrix functions.\n\n";
+
+#include <slepcfn.h>
+
+int main(int argc,char **argv)
+{
+  FN             phi1,fexp,fsqrt,fcomb,flog,fsq,fx;
+  Mat            A,E,F,G;
+  PetscInt       i,n=12;
+  PetscScalar    *As,csq[3]={1.0,0.0,0.0},cx[2]={1.0,0.0};
+  PetscReal      nrm,nrmf,tol=1e-10;
+
+  PetscFunctionBeginUser;
+  PetscCall(SlepcInitialize(&argc,&argv,NULL,help));
+  PetscCall(PetscOptionsGetInt(NULL,NULL,"-n",&n,NULL));
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD,"Schur-Parlett matrix functions, n=%" PetscInt_FMT ".\n",n));
+
+  /* Non-normal matrix with real eigenvalues, some of them repeated */
+  PetscCall(MatCreateSeqDense(PETSC_COMM_SELF,n,n,NULL,&A));
+  PetscCall(MatDenseGetArray(A,&As));
+  for (i=0;i<n;i++) As[i+i*n] = 0.5+0.25*(i/2);
+  for (i=0;i<n-1;i++) As[i+(i+1)*n] = 1.0;
+  for (i=0;i<n-2;i++) As[i+(i+2)*n] = 0.5;
+  PetscCall(MatDenseRestoreArray(A,&As));
+  PetscCall(MatDuplicate(A,MAT_DO_NOT_COPY_VALUES,&E));
+  PetscCall(MatDuplicate(A,MAT_DO_NOT_COPY_VALUES,&F));
+
+  /* phi_1 has no specific method: check A*phi_1(A) = exp(A)-I */
+  PetscCall(FNCreate(PETSC_COMM_WORLD,&phi1));
+  PetscCall(FNSetType(phi1,FNPHI));
+  PetscCall(FNCreate(PETSC_COMM_WORLD,&fexp));
+  PetscCall(FNSetType(fexp,FNEXP));
+  PetscCall(FNEvaluateFunctionMat(phi1,A,F));
+  PetscCall(FNEvaluateFunctionMat(fexp,A,E));
+  PetscCall(MatShift(E,-1.0));
+  PetscCall(MatMatMult(A,F,MAT_INITIAL_MATRIX,PETSC_DEFAULT,&G));
+  PetscCall(MatAXPY(G,-1.0,E,SAME_NONZERO_PATTERN));
+  PetscCall(MatNorm(G,NORM_FROBENIUS,&nrm));
+  PetscCall(MatNorm(E,NORM_FROBENIUS,&nrmf));
+  if (nrm/nrmf<tol) PetscCall(PetscPrintf(PETSC_COMM_WORLD,"phi_1: residual below tolerance\n"));
+  else PetscCall(PetscPrintf(PETSC_COMM_WORLD,"phi_1: relative residual %g\n",(double)(nrm/nrmf)));
+  PetscCall(MatDestroy(&G));
+
+  /* composition exp(sqrt(x)): compare Schur-Parlett (method 1) with chained evaluation */
+  PetscCall(FNCreate(PETSC_COMM_WORLD,&fsqrt));
+  PetscCall(FNSetType(fsqrt,FNSQRT));
+  PetscCall(FNCreate(PETSC_COMM_WORLD,&fcomb));
+  PetscCall(FNSetType(fcomb,FNCOMBINE));
+  PetscCall(FNCombineSetChildren(fcomb,FN_COMBINE_COMPOSE,fsqrt,fexp));
+  PetscCall(FNSetScale(fcomb,0.8,1.5));
+  PetscCall(FNEvaluateFunctionMat(fcomb,A,E));
+  PetscCall(FNSetMethod(fcomb,1));
+  PetscCall(FNEvaluateFunctionMat(fcomb,A,F));
+  PetscCall(MatNorm(E,NORM_FROBENIUS,&nrmf));
+  PetscCall(MatAXPY(F,-1.0,E,SAME_NONZERO_PATTERN));
+  PetscCall(MatNorm(F,NORM_FROBENIUS,&nrm));
+  if (nrm/nrmf<tol) PetscCall(PetscPrintf(PETSC_COMM_WORLD,"exp(sqrt(x)): difference below tolerance\n"));
+  else PetscCall(PetscPrintf(PETSC_COMM_WORLD,"exp(sqrt(x)): relative difference %g\n",(double)(nrm/nrmf)));
+
+  /* Non-normal matrix with a cluster of eigenvalues close to the branch point of sqrt and log */
+  PetscCall(MatDenseGetArray(A,&As));
+  for (i=0;i<n;i++) As[i+i*n] = (i<4)? 0.01*(1+i/2): 0.5+0.25*(i/2);
+  for (i=0;i<n-1;i++) As[i+(i+1)*n] = 0.1;
+  for (i=0;i<n-2;i++) As[i+(i+2)*n] = 0.05;
+  PetscCall(MatDenseRestoreArray(A,&As));
+  PetscCall(MatNorm(A,NORM_FROBENIUS,&nrmf));
+
+  /* sqrt(x^2) with Schur-Parlett must give A back */
+  PetscCall(FNCreate(PETSC_COMM_WORLD,&fsq));
+  PetscCall(FNSetType(fsq,FNRATIONAL));
+  PetscCall(FNRationalSetNumerator(fsq,3,csq));
+  PetscCall(FNCombineSetChildren(fcomb,FN_COMBINE_COMPOSE,fsq,fsqrt));
+  PetscCall(FNSetScale(fcomb,1.0,1.0));
+  PetscCall(FNEvaluateFunctionMat(fcomb,A,F));
+  PetscCall(MatAXPY(F,-1.0,A,SAME_NONZERO_PATTERN));
+  PetscCall(MatNorm(F,NORM_FROBENIUS,&nrm));
+  if (nrm/nrmf<tol) PetscCall(PetscPrintf(PETSC_COMM_WORLD,"sqrt(x^2): difference below tolerance\n"));
+  else PetscCall(PetscPrintf(PETSC_COMM_WORLD,"sqrt(x^2): relative difference %g\n",(double)(nrm/nrmf)));
+
+  /* x*log(x) with Schur-Parlett, compared with A*log(A) */
+  PetscCall(FNCreate(PETSC_COMM_WORLD,&flog));
+  PetscCall(FNSetType(flog,FNLOG));
+  PetscCall(FNCreate(PETSC_COMM_WORLD,&fx));
+  PetscCall(FNSetType(fx,FNRATIONAL));
+  PetscCall(FNRationalSetNumerator(fx,2,cx));
+  PetscCall(FNCombineSetChildren(fcomb,FN_COMBINE_MULTIPLY,fx,flog));
+  PetscCall(FNEvaluateFunctionMat(flog,A,E));
+  PetscCall(MatMatMult(A,E,MAT_INITIAL_MATRIX,PETSC_DEFAULT,&G));
+  PetscCall(FNEvaluateFunctionMat(fcomb,A,F));
+  PetscCall(MatNorm(G,NORM_FROBENIUS,&nrmf));
+  PetscCall(MatAXPY(F,-1.0,G,SAME_NONZERO_PATTERN));
+  PetscCall(MatNorm(F,NORM_FROBENIUS,&nrm));
+  if (nrm/nrmf<tol) PetscCall(PetscPrintf(PETSC_COMM_WORLD,"x*log(x): difference below tolerance\n"));
+  else PetscCall(PetscPrintf(PETSC_COMM_WORLD,"x*log(x): relative difference %g\n",(double)(nrm/nrmf)));
+  PetscCall(MatDestroy(&G));
+
+  PetscCall(FNDestroy(&phi1));
+  PetscCall(FNDestroy(&fexp));
+  PetscCall(FNDestroy(&fsqrt));
+  PetscCall(FNDestroy(&fcomb));
+  PetscCall(FNDestroy(&flog));
+  PetscCall(FNDestroy(&fsq));
+  PetscCall(FNDestroy(&fx));
+  PetscCall(MatDestroy(&A));
+  PetscCall(MatDestroy(&E));
+  PetscCall(MatDestroy(&F));
+  PetscCall(SlepcFinalize());
+  return 0;
+}
+
+/*TEST
+
+   test:
+      suffix: 1
+      requires: !single
+
+TEST*/
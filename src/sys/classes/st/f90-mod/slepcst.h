@@ -20,6 +20,9 @@
       PetscEnum, parameter :: ST_MATMODE_INPLACE       =  1
       PetscEnum, parameter :: ST_MATMODE_SHELL         =  2
 
+      PetscEnum, parameter :: STFILTER_FILTLAN         =  0
+      PetscEnum, parameter :: STFILTER_CHEBYSHEV       =  1
+
 #if defined(_WIN32) && defined(PETSC_USE_SHARED_LIBRARIES)
 !DEC$ ATTRIBUTES DLLEXPORT::SLEPC_NULL_ST
 #endif
@@ -174,6 +174,7 @@ static PetscErrorCode STSetUp_Cayley(ST st)
 static PetscErrorCode STSetShift_Cayley(ST st,PetscScalar newshift)
 {
   ST_CAYLEY      *ctx = (ST_CAYLEY*)st->data;
+  PetscBool      hit;
 
   PetscFunctionBegin;
   PetscCheck(newshift!=0.0 || (ctx->nu_set && ctx->nu!=0.0),PetscObjectComm((PetscObject)st),PETSC_ERR_USER_INPUT,"Values of shift and antishift cannot be zero simultaneously");
@@ -183,6 +184,8 @@ static PetscErrorCode STSetShift_Cayley(ST st,PetscScalar newshift)
     if (st->matmode!=ST_MATMODE_INPLACE) PetscCall(STMatMAXPY_Private(st,newshift,ctx->nu,0,NULL,PETSC_FALSE,PETSC_FALSE,&st->T[0]));
     ctx->nu = newshift;
   }
+  PetscCall(STFactorCacheSwap(st,newshift,&hit));
+  if (hit) PetscFunctionReturn(PETSC_SUCCESS);
   PetscCall(STMatMAXPY_Private(st,-newshift,-st->sigma,0,NULL,PETSC_FALSE,PETSC_FALSE,&st->T[1]));
   if (st->P!=st->T[1]) {
     PetscCall(PetscObjectReference((PetscObject)st->T[1]));
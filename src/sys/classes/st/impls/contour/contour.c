@@ -0,0 +1,554 @@
+/*
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+   SLEPc - Scalable Library for Eigenvalue Problem Computations
+   Copyright (c) 2002-, Universitat Politecnica de Valencia, Spain
+
+   This file is part of SLEPc.
+   SLEPc is distributed under a 2-clause BSD license (see LICENSE).
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+*/
+/*
+   Rational filter obtained from a quadrature rule applied to the contour
+   integral that defines the spectral projector onto a region
+
+   References:
+
+       [1] E. Polizzi, "Density-matrix-based algorithm for solving eigenvalue
+           problems", Phys. Rev. B 79(11):115112, 2009.
+
+       [2] P. T. P. Tang and E. Polizzi, "FEAST as a subspace iteration
+           eigensolver accelerated by approximate spectral projection", SIAM
+           J. Matrix Anal. Appl. 35(2):354-390, 2014.
+*/
+
+#include <slepc/private/stimpl.h>         /*I "slepcst.h" I*/
+#include <slepc/private/slepccontour.h>
+
+typedef struct {
+  RG               rg;        /* region enclosing the wanted eigenvalues */
+  PetscInt         N;         /* number of integration points, i.e., poles of the filter (16) */
+  PetscInt         npart;     /* number of partitions of the communicator */
+  SlepcContourData contour;   /* subcommunicators and one KSP per integration point */
+  PetscScalar      *omega;    /* integration points */
+  PetscScalar      *pp;       /* normalized integration points */
+  PetscScalar      *weight;   /* quadrature weights */
+  Vec              ysub,zsub; /* work vectors in the subcommunicator */
+} ST_CONTOUR;
+
+#define p_id(i) (i*subcomm->n + subcomm->color)
+
+/*
+   Operator (contour):
+               Op                                    P         M
+   if nmat=1:  -sum_j w_j*(A-z_j*I)^-1               NULL      NULL
+   if nmat=2:  -sum_j w_j*(A-z_j*B)^-1 B             NULL      NULL
+
+   that is, the quadrature of the contour integral of (zB-A)^-1 B along the
+   boundary of the region, whose eigenvalues are close to 1 for eigenvalues
+   of (A,B) inside the region and close to 0 for those outside
+*/
+static PetscErrorCode STApply_Contour(ST st,Vec x,Vec y)
+{
+  ST_CONTOUR        *ctx = (ST_CONTOUR*)st->data;
+  SlepcContourData  contour = ctx->contour;
+  PetscSubcomm      subcomm = contour->subcomm;
+  PetscInt          i;
+  Vec               b,rhs,z,acc;
+  const PetscScalar *array;
+
+  PetscFunctionBegin;
+  b = x;
+  if (st->nmat>1) {
+    PetscCall(MatMult(st->A[1],x,st->work[0]));
+    b = st->work[0];
+  }
+  if (contour->pA) {  /* send a copy of the right-hand side to each subcommunicator */
+    PetscCall(VecScatterBegin(contour->scatterin,b,contour->xdup,INSERT_VALUES,SCATTER_FORWARD));
+    PetscCall(VecScatterEnd(contour->scatterin,b,contour->xdup,INSERT_VALUES,SCATTER_FORWARD));
+    PetscCall(VecGetArrayRead(contour->xdup,&array));
+    PetscCall(VecPlaceArray(contour->xsub,array));
+    rhs = contour->xsub;
+    z   = ctx->zsub;
+    acc = ctx->ysub;
+  } else {
+    rhs = b;
+    z   = st->work[1];
+    acc = y;
+  }
+  PetscCall(VecSet(acc,0.0));
+  for (i=0;i<contour->npoints;i++) {
+    PetscCall(KSPSolve(contour->ksp[i],rhs,z));
+    PetscCall(VecAXPY(acc,-ctx->weight[p_id(i)],z));
+  }
+  if (contour->pA) {  /* add up the contributions of all subcommunicators */
+    PetscCall(VecResetArray(contour->xsub));
+    PetscCall(VecRestoreArrayRead(contour->xdup,&array));
+    PetscCall(VecSet(y,0.0));
+    PetscCall(VecScatterBegin(contour->scatterin,acc,y,ADD_VALUES,SCATTER_REVERSE));
+    PetscCall(VecScatterEnd(contour->scatterin,acc,y,ADD_VALUES,SCATTER_REVERSE));
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   Block version of STApply_Contour: without subcommunicators all columns are
+   solved at once with KSPMatSolve() for each integration point
+*/
+static PetscErrorCode STApplyMat_Contour(ST st,Mat X,Mat Y)
+{
+  ST_CONTOUR       *ctx = (ST_CONTOUR*)st->data;
+  SlepcContourData contour = ctx->contour;
+  PetscSubcomm     subcomm = contour->subcomm;
+  PetscInt         i,n;
+  Mat              BX,Z;
+  Vec              x,y;
+
+  PetscFunctionBegin;
+  if (contour->pA) {
+    PetscCall(MatGetSize(X,NULL,&n));
+    for (i=0;i<n;i++) {
+      PetscCall(MatDenseGetColumnVecRead(X,i,&x));
+      PetscCall(MatDenseGetColumnVecWrite(Y,i,&y));
+      PetscCall(STApply_Contour(st,x,y));
+      PetscCall(MatDenseRestoreColumnVecWrite(Y,i,&y));
+      PetscCall(MatDenseRestoreColumnVecRead(X,i,&x));
+    }
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
+  if (st->nmat>1) PetscCall(MatMatMult(st->A[1],X,MAT_INITIAL_MATRIX,PETSC_DEFAULT,&BX));
+  else BX = X;
+  PetscCall(MatDuplicate(X,MAT_DO_NOT_COPY_VALUES,&Z));
+  PetscCall(MatZeroEntries(Y));
+  for (i=0;i<contour->npoints;i++) {
+    PetscCall(KSPMatSolve(contour->ksp[i],BX,Z));
+    PetscCall(MatAXPY(Y,-ctx->weight[p_id(i)],Z,SAME_NONZERO_PATTERN));
+  }
+  PetscCall(MatDestroy(&Z));
+  if (st->nmat>1) PetscCall(MatDestroy(&BX));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode STContourGetKSPs_Contour(ST,PetscInt*,KSP**);
+
+/*
+   Computes the integration points and factorizes A-z_j*B for each of them,
+   the factorizations are kept in the KSP objects and reused in all STApply()
+*/
+static PetscErrorCode STComputeOperator_Contour(ST st)
+{
+  ST_CONTOUR       *ctx = (ST_CONTOUR*)st->data;
+  SlepcContourData contour;
+  PetscSubcomm     subcomm;
+  PetscInt         i;
+  PetscBool        istrivial,flg;
+  Mat              K,*A;
+  Vec              v;
+
+  PetscFunctionBegin;
+  PetscCheck(st->nmat<=2,PetscObjectComm((PetscObject)st),PETSC_ERR_SUP,"Not implemented for polynomial eigenproblems");
+  if (!ctx->rg) PetscCall(STContourGetRG(st,&ctx->rg));
+  PetscCall(RGIsTrivial(ctx->rg,&istrivial));
+  PetscCheck(!istrivial,PetscObjectComm((PetscObject)st),PETSC_ERR_ORDER,"Must pass a nontrivial region with STContourSetRG(), e.g. -st_contour_rg_type ellipse ...");
+  PetscCall(RGGetComplement(ctx->rg,&flg));
+  PetscCheck(!flg,PetscObjectComm((PetscObject)st),PETSC_ERR_SUP,"A region with complement flag set is not allowed");
+
+  if (!ctx->contour || !ctx->contour->ksp) PetscCall(STContourGetKSPs_Contour(st,NULL,NULL));
+  contour = ctx->contour;
+  subcomm = contour->subcomm;
+  PetscCall(PetscFree3(ctx->omega,ctx->pp,ctx->weight));
+  PetscCall(PetscMalloc3(ctx->N,&ctx->omega,ctx->N,&ctx->pp,ctx->N,&ctx->weight));
+  PetscCall(RGComputeQuadrature(ctx->rg,RG_QUADRULE_TRAPEZOIDAL,ctx->N,ctx->omega,ctx->pp,ctx->weight));
+
+  /* redundant copies of the matrices in each subcommunicator */
+  PetscCall(SlepcContourRedundantMat(contour,st->nmat,st->A,NULL));
+  if (contour->pA) {
+    PetscCall(MatCreateVecs(st->A[0],&v,NULL));
+    PetscCall(SlepcContourScatterCreate(contour,v));
+    PetscCall(VecDestroy(&v));
+    PetscCall(VecDestroy(&ctx->ysub));
+    PetscCall(VecDestroy(&ctx->zsub));
+    PetscCall(MatCreateVecs(contour->pA[0],&ctx->ysub,&ctx->zsub));
+  }
+  A = contour->pA? contour->pA: st->A;
+
+  /* factorize A-z_j*B for the integration points of this subcommunicator */
+  for (i=0;i<contour->npoints;i++) {
+    PetscCall(MatDuplicate(A[0],MAT_COPY_VALUES,&K));
+    if (st->nmat>1) PetscCall(MatAXPY(K,-ctx->omega[p_id(i)],A[1],st->str));
+    else PetscCall(MatShift(K,-ctx->omega[p_id(i)]));
+    PetscCall(KSPSetOperators(contour->ksp[i],K,K));
+    PetscCall(MatDestroy(&K));
+    PetscCall(KSPSetUp(contour->ksp[i]));
+  }
+  PetscCall(MatDestroy(&st->P));
+  st->M = NULL;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode STSetUp_Contour(ST st)
+{
+  PetscFunctionBegin;
+  PetscCall(STSetWorkVecs(st,2));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode STSetFromOptions_Contour(ST st,PetscOptionItems *PetscOptionsObject)
+{
+  ST_CONTOUR *ctx = (ST_CONTOUR*)st->data;
+  PetscInt   i,i1,i2;
+  PetscBool  flg,flg2;
+
+  PetscFunctionBegin;
+  PetscOptionsHeadBegin(PetscOptionsObject,"ST Contour Options");
+
+    PetscCall(STContourGetSizes(st,&i1,&i2));
+    PetscCall(PetscOptionsInt("-st_contour_integration_points","Number of integration points","STContourSetSizes",i1,&i1,&flg));
+    PetscCall(PetscOptionsInt("-st_contour_partitions","Number of partitions","STContourSetSizes",i2,&i2,&flg2));
+    if (flg || flg2) PetscCall(STContourSetSizes(st,i1,i2));
+
+  PetscOptionsHeadEnd();
+
+  if (!ctx->rg) PetscCall(STContourGetRG(st,&ctx->rg));
+  PetscCall(RGSetFromOptions(ctx->rg));
+  if (!ctx->contour || !ctx->contour->ksp) PetscCall(STContourGetKSPs_Contour(st,NULL,NULL));
+  for (i=0;i<ctx->contour->npoints;i++) PetscCall(KSPSetFromOptions(ctx->contour->ksp[i]));
+  PetscCall(PetscSubcommSetFromOptions(ctx->contour->subcomm));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode STContourSetSizes_Contour(ST st,PetscInt ip,PetscInt npart)
+{
+  ST_CONTOUR  *ctx = (ST_CONTOUR*)st->data;
+  PetscInt    oN,onpart;
+  PetscMPIInt size;
+
+  PetscFunctionBegin;
+  oN = ctx->N;
+  if (ip == PETSC_DETERMINE) ctx->N = 16;
+  else if (ip != PETSC_CURRENT) {
+    PetscCheck(ip>0,PetscObjectComm((PetscObject)st),PETSC_ERR_ARG_OUTOFRANGE,"The ip argument must be > 0");
+    ctx->N = ip;
+  }
+  onpart = ctx->npart;
+  if (npart == PETSC_DETERMINE) ctx->npart = 1;
+  else if (npart != PETSC_CURRENT) {
+    PetscCallMPI(MPI_Comm_size(PetscObjectComm((PetscObject)st),&size));
+    PetscCheck(npart>0 && npart<=size,PetscObjectComm((PetscObject)st),PETSC_ERR_ARG_OUTOFRANGE,"Illegal value of npart");
+    ctx->npart = npart;
+  }
+  if (onpart != ctx->npart || oN != ctx->N) {
+    PetscCall(SlepcContourDataDestroy(&ctx->contour));
+    PetscCall(PetscInfo(st,"Resetting the contour data structure due to a change of parameters\n"));
+    st->state   = ST_STATE_INITIAL;
+    st->opready = PETSC_FALSE;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   STContourSetSizes - Sets the number of integration points and the number
+   of partitions of the communicator for the contour filter.
+
+   Logically Collective
+
+   Input Parameters:
++  st    - the spectral transformation context
+.  ip    - number of integration points
+-  npart - number of partitions when splitting the communicator
+
+   Options Database Keys:
++  -st_contour_integration_points - sets the number of integration points
+-  -st_contour_partitions - sets the number of partitions
+
+   Notes:
+   For all integer arguments, you can use PETSC_CURRENT to keep the current value, and
+   PETSC_DETERMINE to set them to a default value.
+
+   Each integration point is a pole of the rational filter, and requires the
+   factorization of a shifted matrix, which is computed once and kept for all
+   subsequent applications of the filter. The parameter npart allows
+   the user to split the communicator into npart communicators, so that npart
+   groups of integration points are processed simultaneously, each of them with
+   a redundant copy of the matrices.
+
+   Level: advanced
+
+.seealso: STContourGetSizes(), STContourSetRG()
+@*/
+PetscErrorCode STContourSetSizes(ST st,PetscInt ip,PetscInt npart)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(st,ST_CLASSID,1);
+  PetscValidLogicalCollectiveInt(st,ip,2);
+  PetscValidLogicalCollectiveInt(st,npart,3);
+  PetscTryMethod(st,"STContourSetSizes_C",(ST,PetscInt,PetscInt),(st,ip,npart));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode STContourGetSizes_Contour(ST st,PetscInt *ip,PetscInt *npart)
+{
+  ST_CONTOUR *ctx = (ST_CONTOUR*)st->data;
+
+  PetscFunctionBegin;
+  if (ip) *ip = ctx->N;
+  if (npart) *npart = ctx->npart;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   STContourGetSizes - Gets the number of integration points and the number
+   of partitions of the communicator for the contour filter.
+
+   Not Collective
+
+   Input Parameter:
+.  st - the spectral transformation context
+
+   Output Parameters:
++  ip    - number of integration points
+-  npart - number of partitions when splitting the communicator
+
+   Level: advanced
+
+.seealso: STContourSetSizes()
+@*/
+PetscErrorCode STContourGetSizes(ST st,PetscInt *ip,PetscInt *npart)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(st,ST_CLASSID,1);
+  PetscUseMethod(st,"STContourGetSizes_C",(ST,PetscInt*,PetscInt*),(st,ip,npart));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode STContourSetRG_Contour(ST st,RG rg)
+{
+  ST_CONTOUR *ctx = (ST_CONTOUR*)st->data;
+
+  PetscFunctionBegin;
+  PetscCall(PetscObjectReference((PetscObject)rg));
+  PetscCall(RGDestroy(&ctx->rg));
+  ctx->rg     = rg;
+  st->state   = ST_STATE_INITIAL;
+  st->opready = PETSC_FALSE;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   STContourSetRG - Associates a region object to the contour filter.
+
+   Collective
+
+   Input Parameters:
++  st - the spectral transformation context
+-  rg - the region object
+
+   Notes:
+   The integration points, i.e., the poles of the filter, are obtained with
+   RGComputeQuadrature() on the boundary of the region. The filter maps the
+   eigenvalues inside the region to values close to 1, and those outside to
+   values close to 0.
+
+   If not set, a region is created that can be configured from the command
+   line with options prefixed by -st_contour_, e.g., -st_contour_rg_type ellipse.
+
+   Level: advanced
+
+.seealso: STContourGetRG(), STContourSetSizes()
+@*/
+PetscErrorCode STContourSetRG(ST st,RG rg)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(st,ST_CLASSID,1);
+  PetscValidHeaderSpecific(rg,RG_CLASSID,2);
+  PetscCheckSameComm(st,1,rg,2);
+  PetscTryMethod(st,"STContourSetRG_C",(ST,RG),(st,rg));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode STContourGetRG_Contour(ST st,RG *rg)
+{
+  ST_CONTOUR *ctx = (ST_CONTOUR*)st->data;
+
+  PetscFunctionBegin;
+  if (!ctx->rg) {
+    PetscCall(RGCreate(PetscObjectComm((PetscObject)st),&ctx->rg));
+    PetscCall(PetscObjectIncrementTabLevel((PetscObject)ctx->rg,(PetscObject)st,1));
+    PetscCall(RGSetOptionsPrefix(ctx->rg,((PetscObject)st)->prefix));
+    PetscCall(RGAppendOptionsPrefix(ctx->rg,"st_contour_"));
+    PetscCall(PetscObjectSetOptions((PetscObject)ctx->rg,((PetscObject)st)->options));
+  }
+  *rg = ctx->rg;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   STContourGetRG - Obtain the region object associated to the contour filter.
+
+   Collective
+
+   Input Parameter:
+.  st - the spectral transformation context
+
+   Output Parameter:
+.  rg - the region object
+
+   Level: advanced
+
+.seealso: STContourSetRG()
+@*/
+PetscErrorCode STContourGetRG(ST st,RG *rg)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(st,ST_CLASSID,1);
+  PetscAssertPointer(rg,2);
+  PetscUseMethod(st,"STContourGetRG_C",(ST,RG*),(st,rg));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode STContourGetKSPs_Contour(ST st,PetscInt *nsolve,KSP **ksp)
+{
+  ST_CONTOUR       *ctx = (ST_CONTOUR*)st->data;
+  SlepcContourData contour;
+  PetscInt         i;
+  PC               pc;
+  MPI_Comm         child;
+
+  PetscFunctionBegin;
+  if (!ctx->contour) PetscCall(SlepcContourDataCreate(ctx->N,ctx->npart,(PetscObject)st,&ctx->contour));
+  contour = ctx->contour;
+  if (!contour->ksp) {
+    PetscCall(PetscMalloc1(contour->npoints,&contour->ksp));
+    PetscCall(PetscSubcommGetChild(contour->subcomm,&child));
+    for (i=0;i<contour->npoints;i++) {
+      PetscCall(KSPCreate(child,&contour->ksp[i]));
+      PetscCall(PetscObjectIncrementTabLevel((PetscObject)contour->ksp[i],(PetscObject)st,1));
+      PetscCall(KSPSetOptionsPrefix(contour->ksp[i],((PetscObject)st)->prefix));
+      PetscCall(KSPAppendOptionsPrefix(contour->ksp[i],"st_contour_"));
+      PetscCall(PetscObjectSetOptions((PetscObject)contour->ksp[i],((PetscObject)st)->options));
+      PetscCall(KSPSetErrorIfNotConverged(contour->ksp[i],PETSC_TRUE));
+      PetscCall(KSPSetType(contour->ksp[i],KSPPREONLY));
+      PetscCall(KSPGetPC(contour->ksp[i],&pc));
+      PetscCall(PCSetType(pc,PCLU));
+    }
+  }
+  if (nsolve) *nsolve = contour->npoints;
+  if (ksp)    *ksp    = contour->ksp;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@C
+   STContourGetKSPs - Retrieve the array of linear solver objects associated with
+   the integration points of the contour filter.
+
+   Collective
+
+   Input Parameter:
+.  st - the spectral transformation context
+
+   Output Parameters:
++  nsolve - number of solver objects
+-  ksp    - array of linear solver object
+
+   Notes:
+   The number of KSP solvers is equal to the number of integration points divided by
+   the number of partitions. By default, they are configured as direct solvers (preonly
+   with LU), and can be changed from the command line with options prefixed
+   by -st_contour_, e.g., -st_contour_pc_factor_mat_solver_type mumps.
+
+   Level: advanced
+
+.seealso: STContourSetSizes()
+@*/
+PetscErrorCode STContourGetKSPs(ST st,PetscInt *nsolve,KSP **ksp)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(st,ST_CLASSID,1);
+  PetscUseMethod(st,"STContourGetKSPs_C",(ST,PetscInt*,KSP**),(st,nsolve,ksp));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode STReset_Contour(ST st)
+{
+  ST_CONTOUR *ctx = (ST_CONTOUR*)st->data;
+
+  PetscFunctionBegin;
+  if (ctx->contour) PetscCall(SlepcContourDataReset(ctx->contour));
+  PetscCall(VecDestroy(&ctx->ysub));
+  PetscCall(VecDestroy(&ctx->zsub));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode STView_Contour(ST st,PetscViewer viewer)
+{
+  ST_CONTOUR  *ctx = (ST_CONTOUR*)st->data;
+  PetscBool   isascii;
+  PetscViewer sviewer;
+
+  PetscFunctionBegin;
+  PetscCall(PetscObjectTypeCompare((PetscObject)viewer,PETSCVIEWERASCII,&isascii));
+  if (isascii) {
+    PetscCall(PetscViewerASCIIPrintf(viewer,"  sizes { integration points: %" PetscInt_FMT ", partitions: %" PetscInt_FMT " }\n",ctx->N,ctx->npart));
+    if (!ctx->rg) PetscCall(STContourGetRG(st,&ctx->rg));
+    PetscCall(PetscViewerASCIIPushTab(viewer));
+    PetscCall(RGView(ctx->rg,viewer));
+    if (!ctx->contour || !ctx->contour->ksp) PetscCall(STContourGetKSPs_Contour(st,NULL,NULL));
+    if (ctx->npart>1 && ctx->contour->subcomm) {
+      PetscCall(PetscViewerGetSubViewer(viewer,ctx->contour->subcomm->child,&sviewer));
+      if (!ctx->contour->subcomm->color) PetscCall(KSPView(ctx->contour->ksp[0],sviewer));
+      PetscCall(PetscViewerFlush(sviewer));
+      PetscCall(PetscViewerRestoreSubViewer(viewer,ctx->contour->subcomm->child,&sviewer));
+      /* extra call needed because of the two calls to PetscViewerASCIIPushSynchronized() in PetscViewerGetSubViewer() */
+      PetscCall(PetscViewerASCIIPopSynchronized(viewer));
+    } else PetscCall(KSPView(ctx->contour->ksp[0],viewer));
+    PetscCall(PetscViewerASCIIPopTab(viewer));
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode STDestroy_Contour(ST st)
+{
+  ST_CONTOUR *ctx = (ST_CONTOUR*)st->data;
+
+  PetscFunctionBegin;
+  PetscCall(SlepcContourDataDestroy(&ctx->contour));
+  PetscCall(RGDestroy(&ctx->rg));
+  PetscCall(PetscFree3(ctx->omega,ctx->pp,ctx->weight));
+  PetscCall(PetscFree(st->data));
+  PetscCall(PetscObjectComposeFunction((PetscObject)st,"STContourSetSizes_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)st,"STContourGetSizes_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)st,"STContourSetRG_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)st,"STContourGetRG_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)st,"STContourGetKSPs_C",NULL));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+SLEPC_EXTERN PetscErrorCode STCreate_Contour(ST st)
+{
+  ST_CONTOUR *ctx;
+
+  PetscFunctionBegin;
+  PetscCall(PetscNew(&ctx));
+  st->data = (void*)ctx;
+
+  st->usesksp = PETSC_FALSE;
+
+  ctx->N     = 16;
+  ctx->npart = 1;
+
+  st->ops->apply           = STApply_Contour;
+  st->ops->applymat        = STApplyMat_Contour;
+  st->ops->getbilinearform = STGetBilinearForm_Default;
+  st->ops->setup           = STSetUp_Contour;
+  st->ops->computeoperator = STComputeOperator_Contour;
+  st->ops->setfromoptions  = STSetFromOptions_Contour;
+  st->ops->destroy         = STDestroy_Contour;
+  st->ops->reset           = STReset_Contour;
+  st->ops->view            = STView_Contour;
+
+  PetscCall(PetscObjectComposeFunction((PetscObject)st,"STContourSetSizes_C",STContourSetSizes_Contour));
+  PetscCall(PetscObjectComposeFunction((PetscObject)st,"STContourGetSizes_C",STContourGetSizes_Contour));
+  PetscCall(PetscObjectComposeFunction((PetscObject)st,"STContourSetRG_C",STContourSetRG_Contour));
+  PetscCall(PetscObjectComposeFunction((PetscObject)st,"STContourGetRG_C",STContourGetRG_Contour));
+  PetscCall(PetscObjectComposeFunction((PetscObject)st,"STContourGetKSPs_C",STContourGetKSPs_Contour));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
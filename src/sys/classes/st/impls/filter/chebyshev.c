@@ -0,0 +1,204 @@
+/*
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+   SLEPc - Scalable Library for Eigenvalue Problem Computations
+   Copyright (c) 2002-, Universitat Politecnica de Valencia, Spain
+
+   This file is part of SLEPc.
+   SLEPc is distributed under a 2-clause BSD license (see LICENSE).
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+*/
+/*
+   Polynomial filter given by the Chebyshev expansion of the indicator function
+   of the interval, with Jackson damping to remove Gibbs oscillations.
+
+   References:
+
+       [1] R. Li, Y. Xi, E. Vecharynski, C. Yang, and Y. Saad, "A thick-restart
+           Lanczos algorithm with polynomial filtering for Hermitian eigenvalue
+           problems", SIAM J. Sci. Comput. 38(4):A2512-A2534, 2016.
+*/
+
+#include <slepc/private/stimpl.h>
+#include "filter.h"
+
+/*
+   Evaluates p(t) = sum_k coeffs[k]*T_k(t) for t in [-1,1]
+*/
+static inline PetscReal STFilter_Chebyshev_Evaluate(PetscInt deg,const PetscReal *coeffs,PetscReal t)
+{
+  PetscInt  k;
+  PetscReal t0=1.0,t1=t,t2,y;
+
+  y = coeffs[0]+coeffs[1]*t;
+  for (k=2;k<=deg;k++) {
+    t2 = 2.0*t*t1-t0;
+    y += coeffs[k]*t2;
+    t0 = t1;
+    t1 = t2;
+  }
+  return y;
+}
+
+/*
+   Computes the coefficients of the Chebyshev expansion of degree deg of the
+   indicator function of [a,b], a subinterval of [-1,1], multiplied by the
+   Jackson damping factors
+*/
+static PetscErrorCode STFilter_Chebyshev_Coefficients(PetscInt deg,PetscReal a,PetscReal b,PetscReal *coeffs)
+{
+  PetscInt  k;
+  PetscReal ta=PetscAcosReal(a),tb=PetscAcosReal(b),alpha=PETSC_PI/(deg+2),g;
+
+  PetscFunctionBegin;
+  coeffs[0] = (ta-tb)/PETSC_PI;
+  for (k=1;k<=deg;k++) {
+    g = (1.0-k/(PetscReal)(deg+2))*PetscCosReal(k*alpha)+PetscSinReal(k*alpha)/(PetscTanReal(alpha)*(deg+2));
+    coeffs[k] = g*2.0*(PetscSinReal(k*ta)-PetscSinReal(k*tb))/(k*PETSC_PI);
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   Applies y=p(A)*x with the three-term recurrence of Chebyshev polynomials
+   evaluated at S=(A-c*I)/e, where [c-e,c+e] is the numerical range
+*/
+static PetscErrorCode MatMult_Chebyshev(Mat G,Vec x,Vec y)
+{
+  ST        st;
+  ST_FILTER *ctx;
+  PetscInt  k;
+  PetscReal c,e;
+  Vec       v0,v1,v2,w;
+
+  PetscFunctionBegin;
+  PetscCall(MatShellGetContext(G,&st));
+  ctx = (ST_FILTER*)st->data;
+  c = (ctx->right+ctx->left)/2.0;
+  e = (ctx->right-ctx->left)/2.0;
+  v0 = x;
+  v1 = st->work[1];
+  v2 = st->work[2];
+  PetscCall(MatMult(st->A[0],x,v1));         /* v1 = S*x */
+  PetscCall(VecAXPBY(v1,-c/e,1.0/e,x));
+  PetscCall(VecCopy(x,y));
+  PetscCall(VecScale(y,ctx->coeffs[0]));
+  PetscCall(VecAXPY(y,ctx->coeffs[1],v1));
+  for (k=2;k<=ctx->deg;k++) {
+    PetscCall(MatMult(st->A[0],v1,v2));      /* v2 = 2*S*v1-v0 */
+    PetscCall(VecAXPBYPCZ(v2,-2.0*c/e,-1.0,2.0/e,v1,v0));
+    PetscCall(VecAXPY(y,ctx->coeffs[k],v2));
+    w  = (v0==x)? st->work[3]: v0;
+    v0 = v1;
+    v1 = v2;
+    v2 = w;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   Block version of MatMult_Chebyshev, C=p(A)*B
+*/
+static PetscErrorCode MatMatMult_Chebyshev(Mat G,Mat B,Mat C,void *pctx)
+{
+  ST        st;
+  ST_FILTER *ctx;
+  PetscInt  i,k,m1,m2;
+  PetscReal c,e;
+  Mat       X0,X1,X2,W;
+
+  PetscFunctionBegin;
+  PetscCall(MatShellGetContext(G,&st));
+  ctx = (ST_FILTER*)st->data;
+  if (ctx->nW) {  /* check if work matrices must be resized */
+    PetscCall(MatGetSize(B,NULL,&m1));
+    PetscCall(MatGetSize(ctx->W[0],NULL,&m2));
+    if (m1!=m2) {
+      PetscCall(MatDestroyMatrices(ctx->nW,&ctx->W));
+      ctx->nW = 0;
+    }
+  }
+  if (!ctx->nW) {  /* allocate work matrices */
+    ctx->nW = 3;
+    PetscCall(PetscMalloc1(ctx->nW,&ctx->W));
+    for (i=0;i<ctx->nW;i++) PetscCall(MatDuplicate(B,MAT_DO_NOT_COPY_VALUES,&ctx->W[i]));
+  }
+  c = (ctx->right+ctx->left)/2.0;
+  e = (ctx->right-ctx->left)/2.0;
+  X0 = B;
+  X1 = ctx->W[0];
+  X2 = ctx->W[1];
+  PetscCall(MatMatMult(st->A[0],B,MAT_REUSE_MATRIX,PETSC_DEFAULT,&X1));   /* X1 = S*B */
+  PetscCall(MatScale(X1,1.0/e));
+  PetscCall(MatAXPY(X1,-c/e,B,SAME_NONZERO_PATTERN));
+  PetscCall(MatCopy(B,C,SAME_NONZERO_PATTERN));
+  PetscCall(MatScale(C,ctx->coeffs[0]));
+  PetscCall(MatAXPY(C,ctx->coeffs[1],X1,SAME_NONZERO_PATTERN));
+  for (k=2;k<=ctx->deg;k++) {
+    PetscCall(MatMatMult(st->A[0],X1,MAT_REUSE_MATRIX,PETSC_DEFAULT,&X2));  /* X2 = 2*S*X1-X0 */
+    PetscCall(MatScale(X2,2.0/e));
+    PetscCall(MatAXPY(X2,-2.0*c/e,X1,SAME_NONZERO_PATTERN));
+    PetscCall(MatAXPY(X2,-1.0,X0,SAME_NONZERO_PATTERN));
+    PetscCall(MatAXPY(C,ctx->coeffs[k],X2,SAME_NONZERO_PATTERN));
+    W  = (X0==B)? ctx->W[2]: X0;
+    X0 = X1;
+    X1 = X2;
+    X2 = W;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   Computes the damped Chebyshev coefficients and the threshold gamma, and
+   creates the shell matrix G whose MatMult() applies the filter.
+
+   If the degree has not been set, it is chosen from the target gap, that is,
+   the width of the transition band on each side of the interval, which is
+   taken as half the length of the interval in the variable theta=acos(t).
+   The transition band of the Jackson-damped expansion is about 3*pi/(deg+2)
+   wide in theta.
+*/
+PetscErrorCode STFilter_Chebyshev_setFilter(ST st,Mat *G)
+{
+  ST_FILTER *ctx = (ST_FILTER*)st->data;
+  PetscInt  i,n,m,N,M,npoints=200;
+  PetscReal c,e,a,b,ta,tb;
+
+  PetscFunctionBegin;
+  /* map the interval of desired eigenvalues onto [-1,1] */
+  c = (ctx->right+ctx->left)/2.0;
+  e = (ctx->right-ctx->left)/2.0;
+  a = PetscMax(-1.0,(ctx->inta-c)/e);
+  b = PetscMin(1.0,(ctx->intb-c)/e);
+
+  /* no need to recompute filter if the parameters did not change */
+  if (st->state==ST_STATE_INITIAL || ctx->filtch) {
+    ta = PetscAcosReal(a);
+    tb = PetscAcosReal(b);
+    if (ctx->polyDegree) ctx->deg = ctx->polyDegree;
+    else {
+      ctx->deg = (PetscInt)PetscCeilReal(6.0*PETSC_PI/(ta-tb))-2;
+      ctx->deg = PetscMax(ctx->deg,10);
+      PetscCall(PetscInfo(st,"Chebyshev filter degree chosen from the interval: %" PetscInt_FMT "\n",ctx->deg));
+    }
+    PetscCall(PetscFree(ctx->coeffs));
+    PetscCall(PetscMalloc1(ctx->deg+1,&ctx->coeffs));
+    PetscCall(STFilter_Chebyshev_Coefficients(ctx->deg,a,b,ctx->coeffs));
+    /* the threshold is the lowest value of the filter in the interval */
+    ctx->gamma = PETSC_MAX_REAL;
+    for (i=0;i<=npoints;i++) ctx->gamma = PetscMin(ctx->gamma,STFilter_Chebyshev_Evaluate(ctx->deg,ctx->coeffs,a+i*(b-a)/npoints));
+    PetscCall(PetscInfo(st,"Computed value of gamma = %g\n",(double)ctx->gamma));
+  }
+  ctx->filtch = PETSC_FALSE;
+
+  /* create shell matrix */
+  if (!*G) {
+    PetscCall(MatGetSize(st->A[0],&N,&M));
+    PetscCall(MatGetLocalSize(st->A[0],&n,&m));
+    PetscCall(MatCreateShell(PetscObjectComm((PetscObject)st),n,m,N,M,st,G));
+    PetscCall(MatShellSetOperation(*G,MATOP_MULT,(void(*)(void))MatMult_Chebyshev));
+    PetscCall(MatShellSetMatProductOperation(*G,MATPRODUCT_AB,NULL,MatMatMult_Chebyshev,NULL,MATDENSE,MATDENSE));
+    PetscCall(MatShellSetMatProductOperation(*G,MATPRODUCT_AB,NULL,MatMatMult_Chebyshev,NULL,MATDENSECUDA,MATDENSECUDA));
+    PetscCall(MatShellSetMatProductOperation(*G,MATPRODUCT_AB,NULL,MatMatMult_Chebyshev,NULL,MATDENSEHIP,MATDENSEHIP));
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
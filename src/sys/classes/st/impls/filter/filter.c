@@ -28,12 +28,19 @@ static PetscErrorCode STComputeOperator_Filter(ST st)
   PetscCheck(ctx->intb<PETSC_MAX_REAL || ctx->inta>PETSC_MIN_REAL,PetscObjectComm((PetscObject)st),PETSC_ERR_ORDER,"Must pass an interval with STFilterSetInterval()");
   PetscCheck(ctx->right!=0.0 || ctx->left!=0.0,PetscObjectComm((PetscObject)st),PETSC_ERR_ORDER,"Must pass an approximate numerical range with STFilterSetRange()");
   PetscCheck(ctx->left<=ctx->inta && ctx->right>=ctx->intb,PetscObjectComm((PetscObject)st),PETSC_ERR_USER_INPUT,"The requested interval [%g,%g] must be contained in the numerical range [%g,%g]",(double)ctx->inta,(double)ctx->intb,(double)ctx->left,(double)ctx->right);
-  if (!ctx->polyDegree) ctx->polyDegree = 100;
-  ctx->frame[0] = ctx->left;
-  ctx->frame[1] = ctx->inta;
-  ctx->frame[2] = ctx->intb;
-  ctx->frame[3] = ctx->right;
-  PetscCall(STFilter_FILTLAN_setFilter(st,&st->T[0]));
+  switch (ctx->type) {
+  case STFILTER_FILTLAN:
+    if (!ctx->polyDegree) ctx->polyDegree = 100;
+    ctx->frame[0] = ctx->left;
+    ctx->frame[1] = ctx->inta;
+    ctx->frame[2] = ctx->intb;
+    ctx->frame[3] = ctx->right;
+    PetscCall(STFilter_FILTLAN_setFilter(st,&st->T[0]));
+    break;
+  case STFILTER_CHEBYSHEV:
+    PetscCall(STFilter_Chebyshev_setFilter(st,&st->T[0]));
+    break;
+  }
   st->M = st->T[0];
   PetscCall(MatDestroy(&st->P));
   PetscFunctionReturn(PETSC_SUCCESS);
@@ -48,13 +55,17 @@ static PetscErrorCode STSetUp_Filter(ST st)
 
 static PetscErrorCode STSetFromOptions_Filter(ST st,PetscOptionItems *PetscOptionsObject)
 {
-  PetscReal array[2]={0,0};
-  PetscInt  k;
-  PetscBool flg;
+  ST_FILTER    *ctx = (ST_FILTER*)st->data;
+  PetscReal    array[2]={0,0};
+  PetscInt     k;
+  PetscBool    flg;
+  STFilterType type;
 
   PetscFunctionBegin;
   PetscOptionsHeadBegin(PetscOptionsObject,"ST Filter Options");
 
+    PetscCall(PetscOptionsEnum("-st_filter_type","Method used to build the polynomial filter","STFilterSetType",STFilterTypes,(PetscEnum)ctx->type,(PetscEnum*)&type,&flg));
+    if (flg) PetscCall(STFilterSetType(st,type));
     k = 2;
     PetscCall(PetscOptionsRealArray("-st_filter_interval","Interval containing the desired eigenvalues (two real values separated with a comma without spaces)","STFilterSetInterval",array,&k,&flg));
     if (flg) {
@@ -74,6 +85,92 @@ static PetscErrorCode STSetFromOptions_Filter(ST st,PetscOptionItems *PetscOptio
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode STFilterSetType_Filter(ST st,STFilterType type)
+{
+  ST_FILTER *ctx = (ST_FILTER*)st->data;
+
+  PetscFunctionBegin;
+  if (ctx->type != type) {
+    ctx->type   = type;
+    st->state   = ST_STATE_INITIAL;
+    st->opready = PETSC_FALSE;
+    ctx->filtch = PETSC_TRUE;
+    if (st->T) {  /* the shell matrix of the previous filter type cannot be reused */
+      PetscCall(MatDestroy(&st->T[0]));
+      st->M = NULL;
+    }
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   STFilterSetType - Sets the method used to build the polynomial filter.
+
+   Logically Collective
+
+   Input Parameters:
++  st   - the spectral transformation context
+-  type - the type of filter
+
+   Options Database Key:
+.  -st_filter_type <type> - the filter type, either 'filtlan' or 'chebyshev'
+
+   Notes:
+   The default is STFILTER_FILTLAN, the filter of the FILTLAN package [Fang and Saad, 2012],
+   whose construction involves an iterative search of the transition intervals.
+
+   With STFILTER_CHEBYSHEV the filter is the Chebyshev expansion of the indicator function
+   of the interval, with Jackson damping. Its construction is cheap and it is applied with a
+   three-term recurrence, also to blocks of vectors via MatMatMult(). If the degree has not
+   been set with STFilterSetDegree(), it is chosen from the length of the interval relative
+   to the numerical range.
+
+   Level: intermediate
+
+.seealso: STFilterGetType(), STFilterSetDegree(), STFilterType
+@*/
+PetscErrorCode STFilterSetType(ST st,STFilterType type)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(st,ST_CLASSID,1);
+  PetscValidLogicalCollectiveEnum(st,type,2);
+  PetscTryMethod(st,"STFilterSetType_C",(ST,STFilterType),(st,type));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode STFilterGetType_Filter(ST st,STFilterType *type)
+{
+  ST_FILTER *ctx = (ST_FILTER*)st->data;
+
+  PetscFunctionBegin;
+  *type = ctx->type;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   STFilterGetType - Gets the method used to build the polynomial filter.
+
+   Not Collective
+
+   Input Parameter:
+.  st  - the spectral transformation context
+
+   Output Parameter:
+.  type - the type of filter
+
+   Level: intermediate
+
+.seealso: STFilterSetType()
+@*/
+PetscErrorCode STFilterGetType(ST st,STFilterType *type)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(st,ST_CLASSID,1);
+  PetscAssertPointer(type,2);
+  PetscUseMethod(st,"STFilterGetType_C",(ST,STFilterType*),(st,type));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode STFilterSetInterval_Filter(ST st,PetscReal inta,PetscReal intb)
 {
   ST_FILTER *ctx = (ST_FILTER*)st->data;
@@ -295,7 +392,7 @@ static PetscErrorCode STFilterGetDegree_Filter(ST st,PetscInt *deg)
   ST_FILTER *ctx = (ST_FILTER*)st->data;
 
   PetscFunctionBegin;
-  *deg = ctx->polyDegree;
+  *deg = (ctx->type==STFILTER_CHEBYSHEV && ctx->deg)? ctx->deg: ctx->polyDegree;
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -310,6 +407,11 @@ static PetscErrorCode STFilterGetDegree_Filter(ST st,PetscInt *deg)
    Output Parameter:
 .  deg - polynomial degree
 
+   Note:
+   If the degree has not been set with STFilterSetDegree(), in the Chebyshev filter
+   it is chosen from the interval during the setup, and this function returns that
+   value once STSetUp() has been called (zero before that).
+
    Level: intermediate
 
 .seealso: STFilterSetDegree()
@@ -328,7 +430,7 @@ static PetscErrorCode STFilterGetThreshold_Filter(ST st,PetscReal *gamma)
   ST_FILTER *ctx = (ST_FILTER*)st->data;
 
   PetscFunctionBegin;
-  *gamma = ctx->filterInfo->yLimit;
+  *gamma = (ctx->type==STFILTER_CHEBYSHEV)? ctx->gamma: ctx->filterInfo->yLimit;
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -378,10 +480,11 @@ static PetscErrorCode STView_Filter(ST st,PetscViewer viewer)
   PetscFunctionBegin;
   PetscCall(PetscObjectTypeCompare((PetscObject)viewer,PETSCVIEWERASCII,&isascii));
   if (isascii) {
+    PetscCall(PetscViewerASCIIPrintf(viewer,"  type of filter: %s\n",STFilterTypes[ctx->type]));
     PetscCall(PetscViewerASCIIPrintf(viewer,"  interval of desired eigenvalues: [%g,%g]\n",(double)ctx->inta,(double)ctx->intb));
     PetscCall(PetscViewerASCIIPrintf(viewer,"  numerical range: [%g,%g]\n",(double)ctx->left,(double)ctx->right));
-    PetscCall(PetscViewerASCIIPrintf(viewer,"  degree of filter polynomial: %" PetscInt_FMT "\n",ctx->polyDegree));
-    if (st->state>=ST_STATE_SETUP) PetscCall(PetscViewerASCIIPrintf(viewer,"  limit to accept eigenvalues: theta=%g\n",(double)ctx->filterInfo->yLimit));
+    PetscCall(PetscViewerASCIIPrintf(viewer,"  degree of filter polynomial: %" PetscInt_FMT "\n",(ctx->type==STFILTER_CHEBYSHEV && ctx->deg)? ctx->deg: ctx->polyDegree));
+    if (st->state>=ST_STATE_SETUP) PetscCall(PetscViewerASCIIPrintf(viewer,"  limit to accept eigenvalues: theta=%g\n",(double)((ctx->type==STFILTER_CHEBYSHEV)? ctx->gamma: ctx->filterInfo->yLimit)));
   }
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -394,7 +497,10 @@ static PetscErrorCode STDestroy_Filter(ST st)
   PetscCall(PetscFree(ctx->opts));
   PetscCall(PetscFree(ctx->filterInfo));
   PetscCall(PetscFree(ctx->baseFilter));
+  PetscCall(PetscFree(ctx->coeffs));
   PetscCall(PetscFree(st->data));
+  PetscCall(PetscObjectComposeFunction((PetscObject)st,"STFilterSetType_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)st,"STFilterGetType_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)st,"STFilterSetInterval_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)st,"STFilterGetInterval_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)st,"STFilterSetRange_C",NULL));
@@ -417,6 +523,7 @@ SLEPC_EXTERN PetscErrorCode STCreate_Filter(ST st)
 
   st->usesksp = PETSC_FALSE;
 
+  ctx->type               = STFILTER_FILTLAN;
   ctx->inta               = PETSC_MIN_REAL;
   ctx->intb               = PETSC_MAX_REAL;
   ctx->left               = 0.0;
@@ -448,6 +555,7 @@ SLEPC_EXTERN PetscErrorCode STCreate_Filter(ST st)
   ctx->filterInfo         = pfi;
 
   st->ops->apply           = STApply_Generic;
+  st->ops->applymat        = STApplyMat_Generic;
   st->ops->setup           = STSetUp_Filter;
   st->ops->computeoperator = STComputeOperator_Filter;
   st->ops->setfromoptions  = STSetFromOptions_Filter;
@@ -455,6 +563,8 @@ SLEPC_EXTERN PetscErrorCode STCreate_Filter(ST st)
   st->ops->reset           = STReset_Filter;
   st->ops->view            = STView_Filter;
 
+  PetscCall(PetscObjectComposeFunction((PetscObject)st,"STFilterSetType_C",STFilterSetType_Filter));
+  PetscCall(PetscObjectComposeFunction((PetscObject)st,"STFilterGetType_C",STFilterGetType_Filter));
   PetscCall(PetscObjectComposeFunction((PetscObject)st,"STFilterSetInterval_C",STFilterSetInterval_Filter));
   PetscCall(PetscObjectComposeFunction((PetscObject)st,"STFilterGetInterval_C",STFilterGetInterval_Filter));
   PetscCall(PetscObjectComposeFunction((PetscObject)st,"STFilterSetRange_C",STFilterSetRange_Filter));
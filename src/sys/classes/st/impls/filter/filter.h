@@ -49,6 +49,7 @@ typedef struct _n_FILTLAN_PFI *FILTLAN_PFI;
 
 typedef struct {
   /* user options */
+  STFilterType type;               /* the method used to build the filter */
   PetscReal   inta,intb;           /* bounds of the interval of desired eigenvalues */
   PetscReal   left,right;          /* approximate left and right bounds of the interval containing all eigenvalues */
   PetscInt    polyDegree;          /* degree of s(z), with z*s(z) the polynomial filter */
@@ -68,7 +69,11 @@ typedef struct {
   PetscBool   filtch;              /* filter parameters have changed since last setup */
   Mat         *W;                  /* work matrices for the matrix-matrix application of the filter */
   PetscInt    nW;                  /* number of W matrices */
+  PetscInt    deg;                 /* degree in use, computed if polyDegree is not set (Chebyshev filter) */
+  PetscReal   *coeffs;             /* Jackson-damped Chebyshev coefficients (Chebyshev filter) */
+  PetscReal   gamma;               /* lowest filter value in the interval of desired eigenvalues (Chebyshev filter) */
 } ST_FILTER;
 
 SLEPC_INTERN PetscErrorCode STFilter_FILTLAN_Apply(ST,Vec,Vec);
 SLEPC_INTERN PetscErrorCode STFilter_FILTLAN_setFilter(ST,Mat*);
+SLEPC_INTERN PetscErrorCode STFilter_Chebyshev_setFilter(ST,Mat*);
@@ -164,8 +164,11 @@ static PetscErrorCode STSetShift_Sinvert(ST st,PetscScalar newshift)
 {
   PetscInt       nmat=PetscMax(st->nmat,2),k,nc;
   PetscScalar    *coeffs=NULL;
+  PetscBool      hit=PETSC_FALSE;
 
   PetscFunctionBegin;
+  if (st->transform) PetscCall(STFactorCacheSwap(st,newshift,&hit));
+  if (hit) PetscFunctionReturn(PETSC_SUCCESS);
   if (st->transform) {
     if (st->matmode == ST_MATMODE_COPY && nmat>2) {
       nc = (nmat*(nmat+1))/2;
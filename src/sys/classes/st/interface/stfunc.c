@@ -14,10 +14,11 @@
 #include <slepc/private/stimpl.h>            /*I "slepcst.h" I*/
 
 PetscClassId     ST_CLASSID = 0;
-PetscLogEvent    ST_SetUp = 0,ST_ComputeOperator = 0,ST_Apply = 0,ST_ApplyTranspose = 0,ST_ApplyHermitianTranspose = 0,ST_MatSetUp = 0,ST_MatMult = 0,ST_MatMultTranspose = 0,ST_MatSolve = 0,ST_MatSolveTranspose = 0;
+PetscLogEvent    ST_SetUp = 0,ST_ComputeOperator = 0,ST_Apply = 0,ST_ApplyTranspose = 0,ST_ApplyHermitianTranspose = 0,ST_MatSetUp = 0,ST_MatMult = 0,ST_MatMultTranspose = 0,ST_MatSolve = 0,ST_MatSolveTranspose = 0,ST_FactorCacheHit = 0,ST_FactorCacheMiss = 0;
 static PetscBool STPackageInitialized = PETSC_FALSE;
 
 const char *STMatModes[] = {"COPY","INPLACE","SHELL","STMatMode","ST_MATMODE_",NULL};
+const char *STFilterTypes[] = {"FILTLAN","CHEBYSHEV","STFilterType","STFILTER_",NULL};
 
 /*@C
    STFinalizePackage - This function destroys everything in the Slepc interface
@@ -69,6 +70,8 @@ PetscErrorCode STInitializePackage(void)
   PetscCall(PetscLogEventRegister("STMatMultTranspose",ST_CLASSID,&ST_MatMultTranspose));
   PetscCall(PetscLogEventRegister("STMatSolve",ST_CLASSID,&ST_MatSolve));
   PetscCall(PetscLogEventRegister("STMatSolveTranspose",ST_CLASSID,&ST_MatSolveTranspose));
+  PetscCall(PetscLogEventRegister("STFactCacheHit",ST_CLASSID,&ST_FactorCacheHit));
+  PetscCall(PetscLogEventRegister("STFactCacheMiss",ST_CLASSID,&ST_FactorCacheMiss));
   /* Process Info */
   classids[0] = ST_CLASSID;
   PetscCall(PetscInfoProcessClass("st",1,&classids[0]));
@@ -118,6 +121,18 @@ PetscErrorCode STReset(ST st)
   PetscCall(VecDestroy(&st->wb));
   PetscCall(VecDestroy(&st->wht));
   PetscCall(VecDestroy(&st->D));
+  PetscCall(STFactorCacheReset(st));
+  st->fchits   = 0;
+  st->fcmisses = 0;
+  PetscCall(BVDestroy(&st->rQ));
+  PetscCall(BVDestroy(&st->rZ));
+  PetscCall(BVDestroy(&st->rW));
+  PetscCall(MatDestroy(&st->rH));
+  st->rk        = 0;
+  st->mscalls   = 0;
+  st->msrhs     = 0;
+  st->msits     = 0;
+  st->mslastits = 0;
   st->state   = ST_STATE_INITIAL;
   st->opready = PETSC_FALSE;
   PetscFunctionReturn(PETSC_SUCCESS);
@@ -204,6 +219,27 @@ PetscErrorCode STCreate(MPI_Comm comm,ST *newst)
   st->sigma_set    = PETSC_FALSE;
   st->asymm        = PETSC_FALSE;
   st->aherm        = PETSC_FALSE;
+  st->fcmax        = 0;
+  st->fcmaxmem     = 0.0;
+  st->fcn          = 0;
+  st->fc           = NULL;
+  st->fcclock      = 0;
+  st->fchits       = 0;
+  st->fcmisses     = 0;
+  st->fcsrc        = NULL;
+  st->refineits    = 0;
+  st->refinetol    = PETSC_DETERMINE;
+  st->defrefinetol = SLEPC_DEFAULT_TOL;
+  st->recycle      = PETSC_FALSE;
+  st->rQ           = NULL;
+  st->rZ           = NULL;
+  st->rk           = 0;
+  st->rW           = NULL;
+  st->rH           = NULL;
+  st->mscalls      = 0;
+  st->msrhs        = 0;
+  st->msits        = 0;
+  st->mslastits    = 0;
   st->data         = NULL;
 
   *newst = st;
@@ -1051,6 +1087,13 @@ PetscErrorCode STView(ST st,PetscViewer viewer)
     if (st->Psplit) PetscCall(PetscViewerASCIIPrintf(viewer,"  using split preconditioner matrices with %s\n",MatStructures[st->strp]));
     if (st->transform && st->nmat>2) PetscCall(PetscViewerASCIIPrintf(viewer,"  computing transformed matrices\n"));
     if (st->structured) PetscCall(PetscViewerASCIIPrintf(viewer,"  exploiting structure in the application of the operator\n"));
+    if (st->refineits) PetscCall(PetscViewerASCIIPrintf(viewer,"  iterative refinement of linear solves: at most %" PetscInt_FMT " steps, tolerance %g\n",st->refineits,(double)((st->refinetol==(PetscReal)PETSC_DETERMINE)?st->defrefinetol:st->refinetol)));
+    if (st->fcmax) {
+      if (st->fcmaxmem>0.0) PetscCall(PetscViewerASCIIPrintf(viewer,"  caching up to %" PetscInt_FMT " factorizations within %g MB: %" PetscInt_FMT " hits, %" PetscInt_FMT " misses\n",st->fcmax,(double)st->fcmaxmem,st->fchits,st->fcmisses));
+      else PetscCall(PetscViewerASCIIPrintf(viewer,"  caching up to %" PetscInt_FMT " factorizations: %" PetscInt_FMT " hits, %" PetscInt_FMT " misses\n",st->fcmax,st->fchits,st->fcmisses));
+    }
+    if (st->recycle) PetscCall(PetscViewerASCIIPrintf(viewer,"  recycling previous solutions in block linear solves\n"));
+    if (st->mscalls) PetscCall(PetscViewerASCIIPrintf(viewer,"  block linear solves: %" PetscInt_FMT " calls with %" PetscInt_FMT " right-hand sides, %" PetscInt_FMT " iterations (%" PetscInt_FMT " in the last call)\n",st->mscalls,st->msrhs,st->msits,st->mslastits));
   } else if (isstring) {
     PetscCall(STGetType(st,&cstr));
     PetscCall(PetscViewerStringSPrintf(viewer," %-7.7s",cstr));
@@ -16,6 +16,9 @@ SLEPC_EXTERN PetscErrorCode STCreate_Sinvert(ST);
 SLEPC_EXTERN PetscErrorCode STCreate_Cayley(ST);
 SLEPC_EXTERN PetscErrorCode STCreate_Precond(ST);
 SLEPC_EXTERN PetscErrorCode STCreate_Filter(ST);
+#if defined(PETSC_USE_COMPLEX)
+SLEPC_EXTERN PetscErrorCode STCreate_Contour(ST);
+#endif
 
 /*@C
    STRegisterAll - Registers all of the spectral transformations in the ST package.
@@ -37,5 +40,8 @@ PetscErrorCode STRegisterAll(void)
   PetscCall(STRegister(STCAYLEY,STCreate_Cayley));
   PetscCall(STRegister(STPRECOND,STCreate_Precond));
   PetscCall(STRegister(STFILTER,STCreate_Filter));
+#if defined(PETSC_USE_COMPLEX)
+  PetscCall(STRegister(STCONTOUR,STCreate_Contour));
+#endif
   PetscFunctionReturn(PETSC_SUCCESS);
 }
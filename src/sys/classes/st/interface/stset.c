@@ -111,8 +111,10 @@ PetscErrorCode STGetType(ST st,STType *type)
 PetscErrorCode STSetFromOptions(ST st)
 {
   PetscScalar    s;
+  PetscInt       nfc,its;
+  PetscReal      tol,mem;
   char           type[256];
-  PetscBool      flg,bval;
+  PetscBool      flg,flg2,bval;
   STMatMode      mode;
   MatStructure   mstr;
 
@@ -136,6 +138,21 @@ PetscErrorCode STSetFromOptions(ST st)
     PetscCall(PetscOptionsBool("-st_transform","Whether transformed matrices are computed or not","STSetTransform",st->transform,&bval,&flg));
     if (flg) PetscCall(STSetTransform(st,bval));
 
+    nfc = st->fcmax;
+    mem = st->fcmaxmem;
+    PetscCall(PetscOptionsInt("-st_factor_cache","Number of factorizations kept for previous shifts","STSetFactorCache",nfc,&nfc,&flg));
+    PetscCall(PetscOptionsReal("-st_factor_cache_memory","Memory budget of the cache of factorizations in megabytes","STSetFactorCache",mem,&mem,&flg2));
+    if (flg || flg2) PetscCall(STSetFactorCache(st,nfc,mem));
+
+    its = st->refineits;
+    tol = st->refinetol;
+    PetscCall(PetscOptionsInt("-st_refine_its","Maximum number of iterative refinement steps in linear solves","STSetSolveRefinement",its,&its,&flg));
+    PetscCall(PetscOptionsReal("-st_refine_tol","Tolerance for iterative refinement in linear solves","STSetSolveRefinement",tol,&tol,&flg2));
+    if (flg || flg2) PetscCall(STSetSolveRefinement(st,its,tol));
+
+    PetscCall(PetscOptionsBool("-st_matsolve_recycle","Recycle previous solutions as initial guess in block linear solves","STSetMatSolveRecycle",st->recycle,&bval,&flg));
+    if (flg) PetscCall(STSetMatSolveRecycle(st,bval));
+
     PetscTryTypeMethod(st,setfromoptions,PetscOptionsObject);
     PetscCall(PetscObjectProcessOptionsHandlers((PetscObject)st,PetscOptionsObject));
   PetscOptionsEnd();
@@ -15,12 +15,23 @@
 #include <slepc/private/stimpl.h>
 
 typedef struct {
-  PetscScalar alpha;
-  PetscScalar *coeffs;
-  ST          st;
-  Vec         z;
-  PetscInt    nmat;
-  PetscInt    *matIdx;
+  PetscScalar       alpha;
+  PetscScalar       *coeffs;
+  ST                st;
+  Vec               z;
+  PetscInt          nmat;
+  PetscInt          *matIdx;
+  /* data for the fused kernels, used when all matrices are AIJ */
+  PetscBool         fused;     /* use the fused kernels */
+  PetscBool         mpi;       /* the matrices are MPIAIJ */
+  PetscScalar       *c;        /* coefficient of each matrix in the current product */
+  Mat               *Ad,*Ao;   /* diagonal and off-diagonal blocks of each matrix */
+  const PetscInt    **di,**dj,**oi,**oj;
+  const PetscScalar **da,**oa;
+  PetscObjectState  *nzstate;  /* nonzero state of each matrix when the ghost maps were built */
+  PetscInt          **cmap;    /* map from the off-diagonal columns of each matrix to lvec */
+  Vec               lvec;      /* ghost values, for the union of the off-diagonal columns */
+  VecScatter        scatter;   /* scatter from the column layout to lvec */
 } ST_MATSHELL;
 
 PetscErrorCode STMatShellShift(Mat A,PetscScalar alpha)
@@ -34,6 +45,204 @@ PetscErrorCode STMatShellShift(Mat A,PetscScalar alpha)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   Fused kernels for AIJ matrices: the ghost values of x are gathered with a single
+   scatter, whose pattern is the union of the off-diagonal columns of all matrices,
+   and the linear combination is accumulated in a single pass over the rows. This
+   avoids one scatter and one traversal of x, z and y per matrix.
+*/
+static PetscErrorCode STMatShellFusedSetUp(ST_MATSHELL *ctx)
+{
+  ST               st = ctx->st;
+  PetscInt         i,j,nc,n=0,*cols;
+  const PetscInt   *garray;
+  PetscObjectState state;
+  PetscBool        uptodate=PETSC_TRUE;
+  Mat              Ad,Ao;
+  IS               is;
+
+  PetscFunctionBegin;
+  if (!ctx->mpi) PetscFunctionReturn(PETSC_SUCCESS);
+  for (i=0;i<ctx->nmat;i++) {
+    PetscCall(MatGetNonzeroState(st->A[ctx->matIdx[i]],&state));
+    if (!ctx->lvec || state!=ctx->nzstate[i]) uptodate = PETSC_FALSE;
+    ctx->nzstate[i] = state;
+  }
+  if (uptodate) PetscFunctionReturn(PETSC_SUCCESS);
+
+  /* union of the off-diagonal columns */
+  PetscCall(VecDestroy(&ctx->lvec));
+  PetscCall(VecScatterDestroy(&ctx->scatter));
+  for (i=0;i<ctx->nmat;i++) {
+    PetscCall(MatMPIAIJGetSeqAIJ(st->A[ctx->matIdx[i]],&Ad,&Ao,NULL));
+    PetscCall(MatGetSize(Ao,NULL,&nc));
+    n += nc;
+  }
+  PetscCall(PetscMalloc1(n,&cols));
+  n = 0;
+  for (i=0;i<ctx->nmat;i++) {
+    PetscCall(MatMPIAIJGetSeqAIJ(st->A[ctx->matIdx[i]],&Ad,&Ao,&garray));
+    PetscCall(MatGetSize(Ao,NULL,&nc));
+    PetscCall(PetscArraycpy(cols+n,garray,nc));
+    n += nc;
+  }
+  PetscCall(PetscSortRemoveDupsInt(&n,cols));
+
+  /* position of each off-diagonal column in the union */
+  for (i=0;i<ctx->nmat;i++) {
+    PetscCall(MatMPIAIJGetSeqAIJ(st->A[ctx->matIdx[i]],&Ad,&Ao,&garray));
+    PetscCall(MatGetSize(Ao,NULL,&nc));
+    PetscCall(PetscFree(ctx->cmap[i]));
+    PetscCall(PetscMalloc1(nc,&ctx->cmap[i]));
+    for (j=0;j<nc;j++) PetscCall(PetscFindInt(garray[j],n,cols,&ctx->cmap[i][j]));
+  }
+
+  PetscCall(VecCreateSeq(PETSC_COMM_SELF,n,&ctx->lvec));
+  PetscCall(ISCreateGeneral(PETSC_COMM_SELF,n,cols,PETSC_OWN_POINTER,&is));
+  PetscCall(VecScatterCreate(ctx->z,is,ctx->lvec,NULL,&ctx->scatter));
+  PetscCall(ISDestroy(&is));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode STMatShellFusedGetArrays(ST_MATSHELL *ctx,PetscInt *nr)
+{
+  ST             st = ctx->st;
+  PetscInt       i,n;
+  PetscBool      done;
+
+  PetscFunctionBegin;
+  for (i=0;i<ctx->nmat;i++) {
+    if (ctx->mpi) PetscCall(MatMPIAIJGetSeqAIJ(st->A[ctx->matIdx[i]],&ctx->Ad[i],&ctx->Ao[i],NULL));
+    else ctx->Ad[i] = st->A[ctx->matIdx[i]];
+    PetscCall(MatGetRowIJ(ctx->Ad[i],0,PETSC_FALSE,PETSC_FALSE,&n,&ctx->di[i],&ctx->dj[i],&done));
+    PetscCheck(done,PetscObjectComm((PetscObject)st),PETSC_ERR_PLIB,"Cannot get the row structure of the matrix");
+    PetscCall(MatSeqAIJGetArrayRead(ctx->Ad[i],&ctx->da[i]));
+    if (ctx->mpi) {
+      PetscCall(MatGetRowIJ(ctx->Ao[i],0,PETSC_FALSE,PETSC_FALSE,&n,&ctx->oi[i],&ctx->oj[i],&done));
+      PetscCheck(done,PetscObjectComm((PetscObject)st),PETSC_ERR_PLIB,"Cannot get the row structure of the matrix");
+      PetscCall(MatSeqAIJGetArrayRead(ctx->Ao[i],&ctx->oa[i]));
+    }
+  }
+  *nr = n;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode STMatShellFusedRestoreArrays(ST_MATSHELL *ctx,PetscInt nr)
+{
+  PetscInt       i,n,nz=0;
+  PetscBool      done;
+
+  PetscFunctionBegin;
+  for (i=0;i<ctx->nmat;i++) {
+    nz += ctx->di[i][nr];
+    if (ctx->mpi) nz += ctx->oi[i][nr];
+  }
+  PetscCall(PetscLogFlops(2.0*nz));
+  for (i=0;i<ctx->nmat;i++) {
+    PetscCall(MatSeqAIJRestoreArrayRead(ctx->Ad[i],&ctx->da[i]));
+    PetscCall(MatRestoreRowIJ(ctx->Ad[i],0,PETSC_FALSE,PETSC_FALSE,&n,&ctx->di[i],&ctx->dj[i],&done));
+    if (ctx->mpi) {
+      PetscCall(MatSeqAIJRestoreArrayRead(ctx->Ao[i],&ctx->oa[i]));
+      PetscCall(MatRestoreRowIJ(ctx->Ao[i],0,PETSC_FALSE,PETSC_FALSE,&n,&ctx->oi[i],&ctx->oj[i],&done));
+    }
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   y = (sum_i c[i]*A_i) x, where c[i] have been stored in the context
+*/
+static PetscErrorCode STMatShellMultFused(ST_MATSHELL *ctx,Vec x,Vec y)
+{
+  PetscInt          i,r,k,nr;
+  PetscScalar       *py,sum,s;
+  const PetscScalar *px,*pl=NULL;
+
+  PetscFunctionBegin;
+  PetscCall(STMatShellFusedSetUp(ctx));
+  if (ctx->mpi) {
+    PetscCall(VecScatterBegin(ctx->scatter,x,ctx->lvec,INSERT_VALUES,SCATTER_FORWARD));
+    PetscCall(VecScatterEnd(ctx->scatter,x,ctx->lvec,INSERT_VALUES,SCATTER_FORWARD));
+    PetscCall(VecGetArrayRead(ctx->lvec,&pl));
+  }
+  PetscCall(STMatShellFusedGetArrays(ctx,&nr));
+  PetscCall(VecGetArrayRead(x,&px));
+  PetscCall(VecGetArrayWrite(y,&py));
+  for (r=0;r<nr;r++) {
+    sum = 0.0;
+    for (i=0;i<ctx->nmat;i++) {
+      s = 0.0;
+      for (k=ctx->di[i][r];k<ctx->di[i][r+1];k++) s += ctx->da[i][k]*px[ctx->dj[i][k]];
+      if (ctx->mpi) for (k=ctx->oi[i][r];k<ctx->oi[i][r+1];k++) s += ctx->oa[i][k]*pl[ctx->cmap[i][ctx->oj[i][k]]];
+      sum += ctx->c[i]*s;
+    }
+    py[r] = sum;
+  }
+  PetscCall(VecRestoreArrayWrite(y,&py));
+  PetscCall(VecRestoreArrayRead(x,&px));
+  PetscCall(STMatShellFusedRestoreArrays(ctx,nr));
+  if (ctx->mpi) PetscCall(VecRestoreArrayRead(ctx->lvec,&pl));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   y = (sum_i c[i]*A_i)^T x, or the conjugate transpose if herm=true
+*/
+static PetscErrorCode STMatShellMultTransposeFused(ST_MATSHELL *ctx,Vec x,Vec y,PetscBool herm)
+{
+  PetscInt          i,r,k,nr;
+  PetscScalar       *py,*pl=NULL,s;
+  const PetscScalar *px;
+
+  PetscFunctionBegin;
+  PetscCall(STMatShellFusedSetUp(ctx));
+  if (ctx->mpi) {
+    PetscCall(VecSet(ctx->lvec,0.0));
+    PetscCall(VecGetArray(ctx->lvec,&pl));
+  }
+  PetscCall(STMatShellFusedGetArrays(ctx,&nr));
+  PetscCall(VecSet(y,0.0));
+  PetscCall(VecGetArrayRead(x,&px));
+  PetscCall(VecGetArray(y,&py));
+  for (r=0;r<nr;r++) {
+    for (i=0;i<ctx->nmat;i++) {
+      s = herm? PetscConj(ctx->c[i])*px[r]: ctx->c[i]*px[r];
+      if (herm) {
+        for (k=ctx->di[i][r];k<ctx->di[i][r+1];k++) py[ctx->dj[i][k]] += PetscConj(ctx->da[i][k])*s;
+        if (ctx->mpi) for (k=ctx->oi[i][r];k<ctx->oi[i][r+1];k++) pl[ctx->cmap[i][ctx->oj[i][k]]] += PetscConj(ctx->oa[i][k])*s;
+      } else {
+        for (k=ctx->di[i][r];k<ctx->di[i][r+1];k++) py[ctx->dj[i][k]] += ctx->da[i][k]*s;
+        if (ctx->mpi) for (k=ctx->oi[i][r];k<ctx->oi[i][r+1];k++) pl[ctx->cmap[i][ctx->oj[i][k]]] += ctx->oa[i][k]*s;
+      }
+    }
+  }
+  PetscCall(VecRestoreArray(y,&py));
+  PetscCall(VecRestoreArrayRead(x,&px));
+  PetscCall(STMatShellFusedRestoreArrays(ctx,nr));
+  if (ctx->mpi) {
+    PetscCall(VecRestoreArray(ctx->lvec,&pl));
+    PetscCall(VecScatterBegin(ctx->scatter,ctx->lvec,y,ADD_VALUES,SCATTER_REVERSE));
+    PetscCall(VecScatterEnd(ctx->scatter,ctx->lvec,y,ADD_VALUES,SCATTER_REVERSE));
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   Coefficients of the linear combination, c[i] = coeffs[i]*alpha^i
+*/
+static PetscErrorCode STMatShellFusedCoefficients(ST_MATSHELL *ctx)
+{
+  PetscInt    i;
+  PetscScalar t=1.0;
+
+  PetscFunctionBegin;
+  for (i=0;i<ctx->nmat;i++) {
+    ctx->c[i] = (ctx->coeffs)?t*ctx->coeffs[i]:t;
+    t *= ctx->alpha;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*
   For i=0:nmat-1 computes y = (sum_i (coeffs[i]*alpha^i*st->A[idx[i]]))x
   If null coeffs computes with coeffs[i]=1.0
@@ -47,6 +256,11 @@ static PetscErrorCode MatMult_Shell(Mat A,Vec x,Vec y)
 
   PetscFunctionBegin;
   PetscCall(MatShellGetContext(A,&ctx));
+  if (ctx->fused && ctx->alpha!=0.0) {
+    PetscCall(STMatShellFusedCoefficients(ctx));
+    PetscCall(STMatShellMultFused(ctx,x,y));
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
   st = ctx->st;
   PetscCall(MatMult(st->A[ctx->matIdx[0]],x,y));
   if (ctx->coeffs && ctx->coeffs[0]!=1.0) PetscCall(VecScale(y,ctx->coeffs[0]));
@@ -71,6 +285,11 @@ static PetscErrorCode MatMultTranspose_Shell(Mat A,Vec x,Vec y)
 
   PetscFunctionBegin;
   PetscCall(MatShellGetContext(A,&ctx));
+  if (ctx->fused && ctx->alpha!=0.0) {
+    PetscCall(STMatShellFusedCoefficients(ctx));
+    PetscCall(STMatShellMultTransposeFused(ctx,x,y,PETSC_FALSE));
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
   st = ctx->st;
   PetscCall(MatMultTranspose(st->A[ctx->matIdx[0]],x,y));
   if (ctx->coeffs && ctx->coeffs[0]!=1.0) PetscCall(VecScale(y,ctx->coeffs[0]));
@@ -96,6 +315,11 @@ static PetscErrorCode MatMultHermitianTranspose_Shell(Mat A,Vec x,Vec y)
 
   PetscFunctionBegin;
   PetscCall(MatShellGetContext(A,&ctx));
+  if (ctx->fused && ctx->alpha!=0.0) {
+    PetscCall(STMatShellFusedCoefficients(ctx));
+    PetscCall(STMatShellMultTransposeFused(ctx,x,y,PETSC_TRUE));
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
   st = ctx->st;
   PetscCall(MatMultHermitianTranspose(st->A[ctx->matIdx[0]],x,y));
   if (ctx->coeffs && ctx->coeffs[0]!=1.0) PetscCall(VecScale(y,PetscConj(ctx->coeffs[0])));
@@ -144,9 +368,19 @@ static PetscErrorCode MatGetDiagonal_Shell(Mat A,Vec diag)
 static PetscErrorCode MatDestroy_Shell(Mat A)
 {
   ST_MATSHELL    *ctx;
+  PetscInt       i;
 
   PetscFunctionBegin;
   PetscCall(MatShellGetContext(A,&ctx));
+  if (ctx->fused) {
+    for (i=0;i<ctx->nmat;i++) PetscCall(PetscFree(ctx->cmap[i]));
+    PetscCall(PetscFree(ctx->cmap));
+    PetscCall(PetscFree2(ctx->c,ctx->nzstate));
+    PetscCall(PetscFree2(ctx->Ad,ctx->Ao));
+    PetscCall(PetscFree6(ctx->di,ctx->dj,ctx->oi,ctx->oj,ctx->da,ctx->oa));
+    PetscCall(VecDestroy(&ctx->lvec));
+    PetscCall(VecScatterDestroy(&ctx->scatter));
+  }
   PetscCall(VecDestroy(&ctx->z));
   PetscCall(PetscFree(ctx->matIdx));
   PetscCall(PetscFree(ctx->coeffs));
@@ -157,7 +391,7 @@ static PetscErrorCode MatDestroy_Shell(Mat A)
 PetscErrorCode STMatShellCreate(ST st,PetscScalar alpha,PetscInt nmat,PetscInt *matIdx,PetscScalar *coeffs,Mat *mat)
 {
   PetscInt       n,m,N,M,i;
-  PetscBool      has=PETSC_FALSE,hasA,hasB;
+  PetscBool      has=PETSC_FALSE,hasA,hasB,isseq,ismpi,allseq=PETSC_TRUE,allmpi=PETSC_TRUE;
   ST_MATSHELL    *ctx;
 
   PetscFunctionBegin;
@@ -179,6 +413,22 @@ PetscErrorCode STMatShellCreate(ST st,PetscScalar alpha,PetscInt nmat,PetscInt *
     for (i=0;i<ctx->nmat;i++) ctx->coeffs[i] = coeffs[i];
   }
   PetscCall(MatCreateVecs(st->A[0],&ctx->z,NULL));
+
+  /* the fused kernels can be used if all matrices are (host) AIJ */
+  for (i=0;i<ctx->nmat;i++) {
+    PetscCall(PetscObjectTypeCompare((PetscObject)st->A[ctx->matIdx[i]],MATSEQAIJ,&isseq));
+    PetscCall(PetscObjectTypeCompare((PetscObject)st->A[ctx->matIdx[i]],MATMPIAIJ,&ismpi));
+    allseq = (allseq && isseq)? PETSC_TRUE: PETSC_FALSE;
+    allmpi = (allmpi && ismpi)? PETSC_TRUE: PETSC_FALSE;
+  }
+  if (ctx->nmat>1 && (allseq || allmpi)) {
+    ctx->fused = PETSC_TRUE;
+    ctx->mpi   = allmpi;
+    PetscCall(PetscCalloc1(ctx->nmat,&ctx->cmap));
+    PetscCall(PetscCalloc2(ctx->nmat,&ctx->c,ctx->nmat,&ctx->nzstate));
+    PetscCall(PetscCalloc2(ctx->nmat,&ctx->Ad,ctx->nmat,&ctx->Ao));
+    PetscCall(PetscCalloc6(ctx->nmat,&ctx->di,ctx->nmat,&ctx->dj,ctx->nmat,&ctx->oi,ctx->nmat,&ctx->oj,ctx->nmat,&ctx->da,ctx->nmat,&ctx->oa));
+  }
   PetscCall(MatCreateShell(PetscObjectComm((PetscObject)st),m,n,M,N,(void*)ctx,mat));
   PetscCall(MatShellSetOperation(*mat,MATOP_MULT,(void(*)(void))MatMult_Shell));
   PetscCall(MatShellSetOperation(*mat,MATOP_MULT_TRANSPOSE,(void(*)(void))MatMultTranspose_Shell));
@@ -178,6 +178,170 @@ PetscErrorCode STMatMultHermitianTranspose(ST st,PetscInt k,Vec x,Vec y)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   Solves P x = b with the KSP, followed by steps of iterative refinement
+   x = x + inv(P)*(b - P x) where the residual is computed in working precision.
+   Uses work vectors 1 and 2, since work[0] may be b
+*/
+static PetscErrorCode STMatSolve_Refine(ST st,Vec b,Vec x)
+{
+  PetscInt  i;
+  PetscReal tol,nb,nr;
+  Vec       r,d;
+
+  PetscFunctionBegin;
+  tol = (st->refinetol==(PetscReal)PETSC_DETERMINE)? st->defrefinetol: st->refinetol;
+  PetscCall(STSetWorkVecs(st,3));
+  r = st->work[1];
+  d = st->work[2];
+  PetscCall(KSPSolve(st->ksp,b,x));
+  PetscCall(VecNorm(b,NORM_2,&nb));
+  for (i=0;;i++) {
+    PetscCall(MatMult(st->P,x,r));
+    PetscCall(VecAYPX(r,-1.0,b));
+    PetscCall(VecNorm(r,NORM_2,&nr));
+    if (nr<=tol*nb || i==st->refineits) break;
+    PetscCall(KSPSolve(st->ksp,r,d));
+    PetscCall(VecAXPY(x,1.0,d));
+  }
+  PetscCall(PetscInfo(st,"Iterative refinement: %" PetscInt_FMT " steps, relative residual %g\n",i,(double)(nb>0.0?nr/nb:nr)));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   Same as STMatSolve_Refine() for several right-hand sides, the refinement
+   stops when all columns satisfy the tolerance
+*/
+static PetscErrorCode STMatMatSolve_Refine(ST st,Mat B,Mat X)
+{
+  PetscInt  i,j,k;
+  PetscReal tol,*nb,*nr,rmax;
+  PetscBool done;
+  Mat       R=NULL,D;
+
+  PetscFunctionBegin;
+  tol = (st->refinetol==(PetscReal)PETSC_DETERMINE)? st->defrefinetol: st->refinetol;
+  PetscCall(KSPMatSolve(st->ksp,B,X));
+  PetscCall(MatGetSize(B,NULL,&k));
+  PetscCall(PetscMalloc2(k,&nb,k,&nr));
+  PetscCall(MatGetColumnNorms(B,NORM_2,nb));
+  PetscCall(MatDuplicate(X,MAT_DO_NOT_COPY_VALUES,&D));
+  for (i=0;;i++) {
+    PetscCall(MatMatMult(st->P,X,R?MAT_REUSE_MATRIX:MAT_INITIAL_MATRIX,PETSC_DETERMINE,&R));
+    PetscCall(MatAYPX(R,-1.0,B,SAME_NONZERO_PATTERN));
+    PetscCall(MatGetColumnNorms(R,NORM_2,nr));
+    done = PETSC_TRUE;
+    rmax = 0.0;
+    for (j=0;j<k;j++) {
+      if (nr[j]>tol*nb[j]) done = PETSC_FALSE;
+      rmax = PetscMax(rmax,nb[j]>0.0?nr[j]/nb[j]:nr[j]);
+    }
+    if (done || i==st->refineits) break;
+    PetscCall(KSPMatSolve(st->ksp,R,D));
+    PetscCall(MatAXPY(X,1.0,D,SAME_NONZERO_PATTERN));
+  }
+  PetscCall(PetscInfo(st,"Iterative refinement: %" PetscInt_FMT " steps, maximum relative residual %g\n",i,(double)rmax));
+  PetscCall(PetscFree2(nb,nr));
+  PetscCall(MatDestroy(&R));
+  PetscCall(MatDestroy(&D));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   Solves P X = B taking as initial guess X0 = Z*Q'*B, where Q is an orthonormal
+   basis of the right-hand sides of the previous call and Z = inv(P)*Q, so that
+   X0 minimizes the residual norm of each column in span(Z). Afterwards, Q and Z
+   are replaced by the current right-hand sides and solutions
+*/
+static PetscErrorCode STMatMatSolve_Recycle(ST st,Mat B,Mat X)
+{
+  PetscInt         j,k,nc,m,n;
+  PetscReal        norm;
+  PetscScalar      *h;
+  PetscBool        lindep,guess;
+  PetscObjectId    id;
+  PetscObjectState state;
+  Mat              M;
+
+  PetscFunctionBegin;
+  PetscCall(MatGetSize(B,NULL,&k));
+  PetscCall(PetscObjectGetId((PetscObject)st->P,&id));
+  PetscCall(PetscObjectStateGet((PetscObject)st->P,&state));
+  if (st->rk && (st->rPid!=id || st->rPstate!=state)) st->rk = 0;  /* P has changed, discard */
+
+  if (st->rk) {
+    /* the work objects are kept in the ST while the number of columns does not change */
+    if (st->rW) {
+      PetscCall(BVGetSizes(st->rW,NULL,NULL,&j));
+      if (j!=k) PetscCall(BVDestroy(&st->rW));
+    }
+    if (!st->rW) PetscCall(BVDuplicateResize(st->rQ,k,&st->rW));
+    PetscCall(BVGetSizes(st->rQ,NULL,NULL,&j));
+    if (st->rH) {
+      PetscCall(MatGetSize(st->rH,&m,&n));
+      if (m!=j || n!=k) PetscCall(MatDestroy(&st->rH));
+    }
+    if (!st->rH) PetscCall(MatCreateSeqDense(PETSC_COMM_SELF,j,k,NULL,&st->rH));
+    PetscCall(BVGetMat(st->rW,&M));
+    PetscCall(MatCopy(B,M,SAME_NONZERO_PATTERN));
+    PetscCall(BVRestoreMat(st->rW,&M));
+    PetscCall(BVSetActiveColumns(st->rQ,0,st->rk));
+    PetscCall(BVSetActiveColumns(st->rZ,0,st->rk));
+    PetscCall(BVDot(st->rW,st->rQ,st->rH));
+    PetscCall(BVMult(st->rW,1.0,0.0,st->rZ,st->rH));
+    PetscCall(BVGetMat(st->rW,&M));
+    PetscCall(MatCopy(M,X,SAME_NONZERO_PATTERN));
+    PetscCall(BVRestoreMat(st->rW,&M));
+    PetscCall(KSPGetInitialGuessNonzero(st->ksp,&guess));
+    PetscCall(KSPSetInitialGuessNonzero(st->ksp,PETSC_TRUE));
+    PetscCall(KSPMatSolve(st->ksp,B,X));
+    PetscCall(KSPSetInitialGuessNonzero(st->ksp,guess));
+  } else PetscCall(KSPMatSolve(st->ksp,B,X));
+
+  /* store the new right-hand sides and solutions, discarding linearly dependent columns */
+  if (st->rQ) {
+    PetscCall(BVGetSizes(st->rQ,NULL,NULL,&j));
+    if (j!=k) {
+      PetscCall(BVDestroy(&st->rQ));
+      PetscCall(BVDestroy(&st->rZ));
+    }
+  }
+  if (!st->rQ) {
+    PetscCall(BVCreateFromMat(B,&st->rQ));
+    PetscCall(BVSetOptionsPrefix(st->rQ,((PetscObject)st)->prefix));
+    PetscCall(BVAppendOptionsPrefix(st->rQ,"st_recycle_"));
+    PetscCall(PetscObjectSetOptions((PetscObject)st->rQ,((PetscObject)st)->options));
+    PetscCall(BVSetFromOptions(st->rQ));
+    PetscCall(BVDuplicate(st->rQ,&st->rZ));
+  }
+  PetscCall(BVSetActiveColumns(st->rQ,0,k));
+  PetscCall(BVSetActiveColumns(st->rZ,0,k));
+  PetscCall(BVGetMat(st->rQ,&M));
+  PetscCall(MatCopy(B,M,SAME_NONZERO_PATTERN));
+  PetscCall(BVRestoreMat(st->rQ,&M));
+  PetscCall(BVGetMat(st->rZ,&M));
+  PetscCall(MatCopy(X,M,SAME_NONZERO_PATTERN));
+  PetscCall(BVRestoreMat(st->rZ,&M));
+  PetscCall(PetscMalloc1(k+1,&h));
+  for (nc=0,j=0;j<k;j++) {
+    if (nc<j) {
+      PetscCall(BVCopyColumn(st->rQ,j,nc));
+      PetscCall(BVCopyColumn(st->rZ,j,nc));
+    }
+    PetscCall(BVOrthogonalizeColumn(st->rQ,nc,h,&norm,&lindep));
+    if (lindep || norm==0.0) continue;
+    PetscCall(BVMultColumn(st->rZ,-1.0,1.0,nc,h));
+    PetscCall(BVScaleColumn(st->rQ,nc,1.0/norm));
+    PetscCall(BVScaleColumn(st->rZ,nc,1.0/norm));
+    nc++;
+  }
+  PetscCall(PetscFree(h));
+  st->rk      = nc;
+  st->rPid    = id;
+  st->rPstate = state;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@
    STMatSolve - Solves P x = b, where P is the preconditioner matrix of
    the spectral transformation, using a KSP object stored internally.
@@ -209,6 +373,7 @@ PetscErrorCode STMatSolve(ST st,Vec b,Vec x)
   PetscCall(VecLockReadPush(b));
   PetscCall(PetscLogEventBegin(ST_MatSolve,st,b,x,0));
   if (!st->P) PetscCall(VecCopy(b,x)); /* P=NULL means identity matrix */
+  else if (st->refineits) PetscCall(STMatSolve_Refine(st,b,x));
   else PetscCall(KSPSolve(st->ksp,b,x));
   PetscCall(PetscLogEventEnd(ST_MatSolve,st,b,x,0));
   PetscCall(VecLockReadPop(b));
@@ -228,12 +393,20 @@ PetscErrorCode STMatSolve(ST st,Vec b,Vec x)
    Output Parameter:
 .  X - computed solutions
 
+   Note:
+   The KSP object is kept across calls, so block Krylov solvers such as
+   KSPHPDDM preserve their internal state, including the recycled subspace if
+   recycling has been activated in the KSP. See also STSetMatSolveRecycle().
+
    Level: developer
 
-.seealso: STMatSolve()
+.seealso: STMatSolve(), STGetMatSolveStatistics()
 @*/
 PetscErrorCode STMatMatSolve(ST st,Mat B,Mat X)
 {
+  PetscInt  k,its0,its1;
+  PetscBool flg;
+
   PetscFunctionBegin;
   PetscValidHeaderSpecific(st,ST_CLASSID,1);
   PetscValidHeaderSpecific(B,MAT_CLASSID,2);
@@ -243,11 +416,136 @@ PetscErrorCode STMatMatSolve(ST st,Mat B,Mat X)
   if (st->state!=ST_STATE_SETUP) PetscCall(STSetUp(st));
   PetscCall(PetscLogEventBegin(ST_MatSolve,st,B,X,0));
   if (!st->P) PetscCall(MatCopy(B,X,SAME_NONZERO_PATTERN)); /* P=NULL means identity matrix */
-  else PetscCall(KSPMatSolve(st->ksp,B,X));
+  else {
+    PetscCall(KSPGetTotalIterations(st->ksp,&its0));
+    if (st->refineits) PetscCall(STMatMatSolve_Refine(st,B,X));
+    else {
+      PetscCall(PetscObjectTypeCompare((PetscObject)st->ksp,KSPPREONLY,&flg));
+      if (st->recycle && !flg) PetscCall(STMatMatSolve_Recycle(st,B,X));
+      else PetscCall(KSPMatSolve(st->ksp,B,X));
+    }
+    PetscCall(KSPGetTotalIterations(st->ksp,&its1));
+    PetscCall(MatGetSize(B,NULL,&k));
+    st->mscalls++;
+    st->msrhs    += k;
+    st->mslastits = its1-its0;
+    st->msits    += st->mslastits;
+  }
   PetscCall(PetscLogEventEnd(ST_MatSolve,st,B,X,0));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*@
+   STSetMatSolveRecycle - Activates the reuse of the solutions of the previous
+   block linear solve to compute the initial guess of the next one.
+
+   Logically Collective
+
+   Input Parameters:
++  st  - the spectral transformation context
+-  flg - whether the previous solutions are recycled or not
+
+   Options Database Key:
+.  -st_matsolve_recycle <flg> - Activates recycling
+
+   Notes:
+   Preconditioned block eigensolvers such as LOBPCG call STMatMatSolve()
+   (via STApplyMat()) once per outer iteration with right-hand sides that
+   change slowly. If recycling is active, the ST keeps an orthonormal basis Q
+   of the previous right-hand sides together with Z = inv(P)*Q, and the next
+   solve starts from X0 = Z*Q'*B, which minimizes the residual of each column
+   in the recycled subspace at the cost of one block inner product. The
+   recycled data are discarded when the matrix P changes, for instance after
+   a change of shift. The basis is created with the options prefix of the ST
+   followed by st_recycle_, e.g., -st_recycle_bv_type.
+
+   Only the initial guess is obtained from the recycled data: the subspace is
+   not used to deflate or augment the Krylov iteration, and it contains only
+   the right-hand sides and solutions of the last call, not an accumulation
+   of previous ones. The number of iterations is reduced only to the extent
+   that the new right-hand sides are close to the span of the previous ones.
+
+   This has no effect with direct solvers (KSPPREONLY) nor when iterative
+   refinement is active, see STSetSolveRefinement(). Recycling of Krylov
+   subspaces inside the block solver itself can be activated in the KSP,
+   e.g., with -st_ksp_hpddm_type gcrodr -st_ksp_hpddm_recycle <k> for KSPHPDDM.
+
+   Level: advanced
+
+.seealso: STGetMatSolveRecycle(), STMatMatSolve(), STGetMatSolveStatistics()
+@*/
+PetscErrorCode STSetMatSolveRecycle(ST st,PetscBool flg)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(st,ST_CLASSID,1);
+  PetscValidLogicalCollectiveBool(st,flg,2);
+  if (flg!=st->recycle) {
+    st->recycle = flg;
+    st->rk      = 0;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   STGetMatSolveRecycle - Gets the flag indicating whether the solutions of
+   the previous block linear solve are recycled.
+
+   Not Collective
+
+   Input Parameter:
+.  st - the spectral transformation context
+
+   Output Parameter:
+.  flg - the flag
+
+   Level: advanced
+
+.seealso: STSetMatSolveRecycle()
+@*/
+PetscErrorCode STGetMatSolveRecycle(ST st,PetscBool *flg)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(st,ST_CLASSID,1);
+  PetscAssertPointer(flg,2);
+  *flg = st->recycle;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   STGetMatSolveStatistics - Gets statistics of the block linear solves
+   done in STMatMatSolve() since the last STReset().
+
+   Not Collective
+
+   Input Parameter:
+.  st - the spectral transformation context
+
+   Output Parameters:
++  ncalls  - number of calls to STMatMatSolve() that solved a linear system
+.  nrhs    - total number of right-hand sides
+.  its     - total number of iterations of the linear solver
+-  lastits - number of iterations in the last call
+
+   Note:
+   Iterations are counted with KSPGetTotalIterations(), so they include the
+   steps of iterative refinement, and with KSP types lacking a block solver
+   they are the sum over all columns.
+
+   Level: advanced
+
+.seealso: STMatMatSolve(), STSetMatSolveRecycle()
+@*/
+PetscErrorCode STGetMatSolveStatistics(ST st,PetscInt *ncalls,PetscInt *nrhs,PetscInt *its,PetscInt *lastits)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(st,ST_CLASSID,1);
+  if (ncalls) *ncalls = st->mscalls;
+  if (nrhs) *nrhs = st->msrhs;
+  if (its) *its = st->msits;
+  if (lastits) *lastits = st->mslastits;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@
    STMatSolveTranspose - Solves P^T x = b, where P is the preconditioner matrix of
    the spectral transformation, using a KSP object stored internally.
@@ -350,6 +648,462 @@ PetscErrorCode STCheckFactorPackage(ST st)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   Checks whether the current configuration allows caching factorizations:
+   direct solver for A-sigma*B built explicitly from the ST matrices
+*/
+static PetscErrorCode STFactorCacheApplicable(ST st,PetscBool *flg)
+{
+  PC            pc;
+  MatSolverType stype;
+  PetscBool     preonly;
+
+  PetscFunctionBegin;
+  *flg = PETSC_FALSE;
+  if (!st->fcmax || !st->ksp || !st->P || st->P!=st->T[1] || st->nmat>2 || st->matmode!=ST_MATMODE_COPY || st->Pmat || st->Psplit) PetscFunctionReturn(PETSC_SUCCESS);
+  PetscCall(PetscObjectTypeCompare((PetscObject)st->ksp,KSPPREONLY,&preonly));
+  if (!preonly) PetscFunctionReturn(PETSC_SUCCESS);
+  PetscCall(KSPGetPC(st->ksp,&pc));
+  PetscCall(PCFactorGetMatSolverType(pc,&stype));
+  *flg = stype? PETSC_TRUE: PETSC_FALSE;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   Creates a new PC object with the same configuration as the one of the ST's KSP
+*/
+static PetscErrorCode STFactorCacheNewPC(ST st,PC pc,PC *newpc)
+{
+  PCType             ptype;
+  MatSolverType      stype;
+  MatFactorShiftType shifttype;
+  PetscReal          amount,zeropivot;
+  const char         *prefix;
+
+  PetscFunctionBegin;
+  PetscCall(PCCreate(PetscObjectComm((PetscObject)st),newpc));
+  PetscCall(PetscObjectIncrementTabLevel((PetscObject)*newpc,(PetscObject)st->ksp,0));
+  PetscCall(PCGetOptionsPrefix(pc,&prefix));
+  PetscCall(PCSetOptionsPrefix(*newpc,prefix));
+  PetscCall(PetscObjectSetOptions((PetscObject)*newpc,((PetscObject)st)->options));
+  PetscCall(PCGetType(pc,&ptype));
+  PetscCall(PCSetType(*newpc,ptype));
+  PetscCall(PCFactorGetMatSolverType(pc,&stype));
+  PetscCall(PCFactorSetMatSolverType(*newpc,stype));
+  PetscCall(PCFactorGetShiftType(pc,&shifttype));
+  PetscCall(PCFactorSetShiftType(*newpc,shifttype));
+  PetscCall(PCFactorGetShiftAmount(pc,&amount));
+  PetscCall(PCFactorSetShiftAmount(*newpc,amount));
+  PetscCall(PCFactorGetZeroPivot(pc,&zeropivot));
+  PetscCall(PCFactorSetZeroPivot(*newpc,zeropivot));
+  PetscCall(PCSetFromOptions(*newpc));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   STFactorCacheSetUpPC - Called once the operators of a PC created by the cache
+   have been set, to copy the parameters of the factored matrix (e.g., those set
+   with MatMumpsSetIcntl() for inertia computation) from the PC it replaces
+*/
+PetscErrorCode STFactorCacheSetUpPC(ST st)
+{
+#if defined(PETSC_HAVE_MUMPS)
+  PC             pc;
+  Mat            F0,F;
+  MatSolverType  stype;
+  PetscBool      ismumps;
+  PetscInt       i,ival;
+  PetscReal      rval;
+  const PetscInt icntl[] = {7,8,12,13,14,23,24,28,29,35},cntl[] = {1,3,4,5,7};
+#endif
+
+  PetscFunctionBegin;
+#if defined(PETSC_HAVE_MUMPS)
+  PetscCall(PCFactorGetMatSolverType(st->fcsrc,&stype));
+  PetscCall(PetscStrcmp(stype,MATSOLVERMUMPS,&ismumps));
+  if (ismumps) {
+    PetscCall(KSPGetPC(st->ksp,&pc));
+    PetscCall(PCFactorSetUpMatSolverType(pc));
+    PetscCall(PCFactorGetMatrix(st->fcsrc,&F0));
+    PetscCall(PCFactorGetMatrix(pc,&F));
+    for (i=0;i<(PetscInt)PETSC_STATIC_ARRAY_LENGTH(icntl);i++) {
+      PetscCall(MatMumpsGetIcntl(F0,icntl[i],&ival));
+      PetscCall(MatMumpsSetIcntl(F,icntl[i],ival));
+    }
+    for (i=0;i<(PetscInt)PETSC_STATIC_ARRAY_LENGTH(cntl);i++) {
+      PetscCall(MatMumpsGetCntl(F0,cntl[i],&rval));
+      PetscCall(MatMumpsSetCntl(F,cntl[i],rval));
+    }
+  }
+#endif
+  PetscCall(PCDestroy(&st->fcsrc));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   Computes the memory of the factored matrix held by a cached PC, in megabytes.
+   If the factorization package does not provide it, the number of nonzeros
+   of the factors is used to estimate it
+*/
+static PetscErrorCode STFactorCacheMemory(PC pc,PetscReal *mem)
+{
+  Mat       F;
+  MatInfo   info;
+  PetscBool flg;
+
+  PetscFunctionBegin;
+  *mem = 0.0;
+  PetscCall(PCFactorGetMatrix(pc,&F));
+  if (!F) PetscFunctionReturn(PETSC_SUCCESS);
+  PetscCall(MatHasOperation(F,MATOP_GET_INFO,&flg));
+  if (!flg) PetscFunctionReturn(PETSC_SUCCESS);
+  PetscCall(MatGetInfo(F,MAT_GLOBAL_SUM,&info));
+  *mem = (info.memory>0.0)? info.memory: info.nz_used*(sizeof(PetscScalar)+sizeof(PetscInt));
+  *mem /= 1048576.0;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   Removes the i-th entry of the cache
+*/
+static PetscErrorCode STFactorCacheEvict(ST st,PetscInt i)
+{
+  PetscFunctionBegin;
+  PetscCall(PCDestroy(&st->fc[i].pc));
+  PetscCall(MatDestroy(&st->fc[i].P));
+  PetscCall(PetscFree(st->fc[i].Astate));
+  st->fc[i] = st->fc[--st->fcn];
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   Discards the least recently used entries until the cache fits in the memory budget
+*/
+static PetscErrorCode STFactorCacheFit(ST st)
+{
+  PetscInt  i,lru;
+  PetscReal mem;
+
+  PetscFunctionBegin;
+  if (st->fcmaxmem<=0.0) PetscFunctionReturn(PETSC_SUCCESS);
+  for (mem=0.0,i=0;i<st->fcn;i++) mem += st->fc[i].mem;
+  while (st->fcn && mem>st->fcmaxmem) {
+    for (lru=0,i=1;i<st->fcn;i++) if (st->fc[i].stamp<st->fc[lru].stamp) lru = i;
+    PetscCall(PetscInfo(st,"Discarding cached factorization for shift %g to fit in the memory budget\n",(double)PetscRealPart(st->fc[lru].sigma)));
+    mem -= st->fc[lru].mem;
+    PetscCall(STFactorCacheEvict(st,lru));
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   STFactorCacheSwap - Called by ST types that factorize A-sigma*B, before
+   changing the shift to a new value. The KSP of the ST is always kept, and
+   the PC holding the current factorization is stored in the cache. If a
+   factorization for the new shift is available, its PC is installed in the
+   KSP, in which case hit is set to true. Otherwise, the ST is left without P
+   matrix and the KSP gets a new PC with the same configuration, for the
+   caller to build the matrix and factorize it.
+*/
+PetscErrorCode STFactorCacheSwap(ST st,PetscScalar newshift,PetscBool *hit)
+{
+  PetscInt           i,j,idx=-1,lru=-1;
+  PetscBool          flg,valid;
+  STFactorCacheEntry *e;
+  PC                 pc,newpc;
+  Mat                P;
+
+  PetscFunctionBegin;
+  *hit = PETSC_FALSE;
+  PetscCall(STFactorCacheApplicable(st,&flg));
+  if (!flg) PetscFunctionReturn(PETSC_SUCCESS);
+
+  /* discard entries computed with matrices that have been modified */
+  for (i=0;i<st->fcn;i++) {
+    valid = PETSC_TRUE;
+    for (j=0;j<st->nmat;j++) if (st->fc[i].Astate[j]!=st->Astate[j]) valid = PETSC_FALSE;
+    if (!valid) PetscCall(STFactorCacheEvict(st,i--));
+  }
+  for (i=0;i<st->fcn && idx==-1;i++) if (st->fc[i].sigma==newshift) idx = i;
+  PetscCall(KSPGetPC(st->ksp,&pc));
+  PetscCall(PetscObjectReference((PetscObject)pc));
+
+  if (idx>=0) {  /* hit: exchange the current factorization with the cached one */
+    PetscCall(PetscLogEventBegin(ST_FactorCacheHit,st,0,0,0));
+    e = st->fc+idx;
+    PetscCall(KSPSetPC(st->ksp,e->pc));
+    PetscCall(PCDestroy(&e->pc));
+    e->pc = pc;
+    P = st->P;
+    PetscCall(MatDestroy(&st->T[1]));
+    st->P = e->P;
+    PetscCall(PetscObjectReference((PetscObject)st->P));
+    st->T[1] = st->P;
+    e->P = P;
+    e->sigma = st->sigma;
+    e->stamp = st->fcclock++;
+    PetscCall(STFactorCacheMemory(pc,&e->mem));
+    st->fchits++;
+    *hit = PETSC_TRUE;
+    PetscCall(PetscInfo(st,"Reusing cached factorization for shift %g\n",(double)PetscRealPart(newshift)));
+    PetscCall(PetscLogEventEnd(ST_FactorCacheHit,st,0,0,0));
+  } else {  /* miss: store the current factorization, evicting the least recently used */
+    PetscCall(PetscLogEventBegin(ST_FactorCacheMiss,st,0,0,0));
+    if (st->fcn<st->fcmax) {
+      if (!st->fc) PetscCall(PetscCalloc1(st->fcmax,&st->fc));
+      e = st->fc+st->fcn++;
+      PetscCall(PetscMalloc1(st->nmat,&e->Astate));
+    } else {
+      for (i=0;i<st->fcn;i++) if (lru==-1 || st->fc[i].stamp<st->fc[lru].stamp) lru = i;
+      e = st->fc+lru;
+      PetscCall(PCDestroy(&e->pc));
+      PetscCall(MatDestroy(&e->P));
+    }
+    e->sigma = st->sigma;
+    e->stamp = st->fcclock++;
+    PetscCall(PetscArraycpy(e->Astate,st->Astate,st->nmat));
+    e->pc = pc;
+    PetscCall(STFactorCacheMemory(pc,&e->mem));
+    PetscCall(STFactorCacheNewPC(st,pc,&newpc));
+    PetscCall(KSPSetPC(st->ksp,newpc));
+    PetscCall(PCDestroy(&newpc));
+    PetscCall(PCDestroy(&st->fcsrc));
+    PetscCall(PetscObjectReference((PetscObject)pc));
+    st->fcsrc = pc;
+    e->P = st->P;
+    st->P = NULL;
+    PetscCall(MatDestroy(&st->T[1]));
+    st->fcmisses++;
+    PetscCall(PetscLogEventEnd(ST_FactorCacheMiss,st,0,0,0));
+  }
+  PetscCall(STFactorCacheFit(st));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   STFactorCacheReset - Destroys all cached factorizations
+*/
+PetscErrorCode STFactorCacheReset(ST st)
+{
+  PetscInt i;
+
+  PetscFunctionBegin;
+  for (i=0;i<st->fcn;i++) {
+    PetscCall(PCDestroy(&st->fc[i].pc));
+    PetscCall(MatDestroy(&st->fc[i].P));
+    PetscCall(PetscFree(st->fc[i].Astate));
+  }
+  PetscCall(PetscFree(st->fc));
+  PetscCall(PCDestroy(&st->fcsrc));
+  st->fcn = 0;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   STSetFactorCache - Sets the maximum number of factorizations that are
+   kept in memory for previously used shifts, and the memory they may take.
+
+   Logically Collective
+
+   Input Parameters:
++  st     - the spectral transformation context
+.  nmax   - maximum number of cached factorizations
+-  maxmem - memory budget of the cache, in megabytes
+
+   Options Database Keys:
++  -st_factor_cache <nmax> - Sets the maximum number of entries of the cache
+-  -st_factor_cache_memory <maxmem> - Sets the memory budget of the cache
+
+   Notes:
+   Some solvers, such as spectrum slicing in Krylov-Schur, may set the same
+   shift several times. With a nonzero cache size, the shift-and-invert and
+   Cayley transformations keep the direct solvers of the last nmax shifts
+   (other than the current one), and reuse them if the same shift is set again
+   and the matrices have not been modified, instead of computing a new
+   factorization. When the cache is full, the least recently used factorization
+   is discarded.
+
+   Each cached entry holds a complete factorization. Its memory is obtained with
+   MatGetInfo() on the factored matrix (estimated from the number of nonzeros if
+   the package does not report it), and if the cached factorizations exceed
+   maxmem, the least recently used ones are discarded until they fit. The current
+   factorization is not counted. Use PETSC_DETERMINE or 0 for maxmem to limit only
+   the number of entries, or PETSC_CURRENT to leave it unchanged.
+
+   The cache is only active if the linear solver is KSPPREONLY with a
+   factorization preconditioner, and with ST_MATMODE_COPY. The KSP returned by
+   STGetKSP() is kept, and the cache stores the PC objects holding each
+   factorization, which are installed in the KSP with KSPSetPC(). Hence the PC
+   must be retrieved with KSPGetPC() after changing the shift. New PC objects
+   are created with the same type, factorization package, shift and zero pivot
+   settings, and options prefix as the current one. With MUMPS, the parameters
+   of the factored matrix that are relevant for ordering and null pivot detection
+   (e.g., ICNTL(13) and ICNTL(24), set with MatMumpsSetIcntl() to compute the
+   inertia) are copied as well.
+
+   The default is zero, i.e., no factorizations are cached.
+
+   Level: advanced
+
+.seealso: STGetFactorCache(), STSetShift(), STGetKSP()
+@*/
+PetscErrorCode STSetFactorCache(ST st,PetscInt nmax,PetscReal maxmem)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(st,ST_CLASSID,1);
+  PetscValidLogicalCollectiveInt(st,nmax,2);
+  PetscValidLogicalCollectiveReal(st,maxmem,3);
+  PetscCheck(nmax>=0,PetscObjectComm((PetscObject)st),PETSC_ERR_ARG_OUTOFRANGE,"The cache size must be non-negative");
+  if (nmax!=st->fcmax) {
+    PetscCall(STFactorCacheReset(st));
+    st->fcmax = nmax;
+  }
+  if (maxmem == (PetscReal)PETSC_DETERMINE || maxmem == (PetscReal)PETSC_DECIDE) st->fcmaxmem = 0.0;
+  else if (maxmem != (PetscReal)PETSC_CURRENT) {
+    PetscCheck(maxmem>=0.0,PetscObjectComm((PetscObject)st),PETSC_ERR_ARG_OUTOFRANGE,"The memory budget must be non-negative");
+    st->fcmaxmem = maxmem;
+    PetscCall(STFactorCacheFit(st));
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   STGetFactorCache - Gets the size of the cache of factorizations, together
+   with the number of times a cached factorization was reused or not.
+
+   Not Collective
+
+   Input Parameter:
+.  st - the spectral transformation context
+
+   Output Parameters:
++  nmax   - maximum number of cached factorizations
+.  maxmem - memory budget of the cache in megabytes (0 if unlimited)
+.  hits   - number of shift changes that reused a cached factorization
+-  misses - number of shift changes that required a new factorization
+
+   Level: advanced
+
+.seealso: STSetFactorCache()
+@*/
+PetscErrorCode STGetFactorCache(ST st,PetscInt *nmax,PetscReal *maxmem,PetscInt *hits,PetscInt *misses)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(st,ST_CLASSID,1);
+  if (nmax) *nmax = st->fcmax;
+  if (maxmem) *maxmem = st->fcmaxmem;
+  if (hits) *hits = st->fchits;
+  if (misses) *misses = st->fcmisses;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   STSetSolveRefinement - Sets the parameters of the iterative refinement
+   applied in the solution of linear systems with the preconditioner matrix
+   of the spectral transformation.
+
+   Logically Collective
+
+   Input Parameters:
++  st  - the spectral transformation context
+.  its - maximum number of refinement steps
+-  tol - relative tolerance for the residual of the refined solution
+
+   Options Database Keys:
++  -st_refine_its <its> - Sets the maximum number of refinement steps
+-  -st_refine_tol <tol> - Sets the tolerance
+
+   Notes:
+   When its is positive, the solution x of P x = b computed by the KSP object
+   is improved with steps x = x + inv(P)*(b - P x), where the residual is
+   computed in the working precision with the matrix P, until the residual
+   norm is below tol*norm(b) or its steps have been done.
+
+   This is intended for linear solvers that compute an inexpensive but less
+   accurate factorization, for instance an external package configured to
+   factorize in single precision, which reduces the memory and time of the
+   factorization. A few refinement steps recover the accuracy required by
+   the eigensolver. It is applied in STMatSolve() and STMatMatSolve(), and
+   requires the matrix P explicitly, so it is not available in
+   ST_MATMODE_SHELL.
+
+   Use PETSC_DETERMINE for tol to take the value from the eigensolver
+   tolerance, or PETSC_CURRENT to keep the current value. The default is
+   its=0, i.e., no refinement.
+
+   Level: advanced
+
+.seealso: STGetSolveRefinement(), STMatSolve(), STMatMatSolve(), STGetKSP()
+@*/
+PetscErrorCode STSetSolveRefinement(ST st,PetscInt its,PetscReal tol)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(st,ST_CLASSID,1);
+  PetscValidLogicalCollectiveInt(st,its,2);
+  PetscValidLogicalCollectiveReal(st,tol,3);
+  PetscCheck(its>=0,PetscObjectComm((PetscObject)st),PETSC_ERR_ARG_OUTOFRANGE,"The number of refinement steps must be non-negative");
+  st->refineits = its;
+  if (tol == (PetscReal)PETSC_DETERMINE) st->refinetol = PETSC_DETERMINE;
+  else if (tol != (PetscReal)PETSC_CURRENT) {
+    PetscCheck(tol>0.0,PetscObjectComm((PetscObject)st),PETSC_ERR_ARG_OUTOFRANGE,"Illegal value of tol. Must be > 0");
+    st->refinetol = tol;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   STGetSolveRefinement - Gets the parameters of the iterative refinement
+   applied in the solution of linear systems.
+
+   Not Collective
+
+   Input Parameter:
+.  st - the spectral transformation context
+
+   Output Parameters:
++  its - maximum number of refinement steps
+-  tol - relative tolerance for the residual of the refined solution
+
+   Level: advanced
+
+.seealso: STSetSolveRefinement()
+@*/
+PetscErrorCode STGetSolveRefinement(ST st,PetscInt *its,PetscReal *tol)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(st,ST_CLASSID,1);
+  if (its) *its = st->refineits;
+  if (tol) *tol = (st->refinetol==(PetscReal)PETSC_DETERMINE)? st->defrefinetol: st->refinetol;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   STSetDefaultSolveRefinementTol - Sets the tolerance used in the iterative
+   refinement of linear solves if the user did not set one explicitly.
+
+   Logically Collective
+
+   Input Parameters:
++  st  - the spectral transformation context
+-  tol - the tolerance
+
+   Note:
+   This function is intended to be called by the eigensolvers, to tie the
+   accuracy of the linear solves to the requested tolerance of the eigenpairs.
+
+   Level: developer
+
+.seealso: STSetSolveRefinement(), STSetDefaultShift()
+@*/
+PetscErrorCode STSetDefaultSolveRefinementTol(ST st,PetscReal tol)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(st,ST_CLASSID,1);
+  PetscValidLogicalCollectiveReal(st,tol,2);
+  st->defrefinetol = tol;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@
    STSetKSP - Sets the KSP object associated with the spectral
    transformation.
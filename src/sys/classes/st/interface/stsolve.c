@@ -316,7 +316,8 @@ static PetscErrorCode MatMatMult_STOperator(Mat Op,Mat B,Mat C,void *ctx)
   PetscCall(MatShellGetContext(Op,&st));
   PetscCall(STSetUp(st));
   PetscCall(PetscLogEventBegin(ST_Apply,st,B,C,0));
-  PetscCall(STApplyMat_Generic(st,B,C));
+  if (st->ops->applymat) PetscUseTypeMethod(st,applymat,B,C);
+  else PetscCall(STApplyMat_Generic(st,B,C));
   PetscCall(PetscLogEventEnd(ST_Apply,st,B,C,0));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -341,7 +342,7 @@ PetscErrorCode STGetOperator_Private(ST st,Mat *Op)
 #else
     PetscCall(MatShellSetOperation(st->Op,MATOP_MULT_HERMITIAN_TRANSPOSE,(void(*)(void))MatMultTranspose_STOperator));
 #endif
-    if (!st->D && st->ops->apply==STApply_Generic) {
+    if (!st->D && (st->ops->apply==STApply_Generic || st->ops->applymat)) {
       PetscCall(MatShellSetMatProductOperation(st->Op,MATPRODUCT_AB,NULL,MatMatMult_STOperator,NULL,MATDENSE,MATDENSE));
       PetscCall(MatShellSetMatProductOperation(st->Op,MATPRODUCT_AB,NULL,MatMatMult_STOperator,NULL,MATDENSECUDA,MATDENSECUDA));
       PetscCall(MatShellSetMatProductOperation(st->Op,MATPRODUCT_AB,NULL,MatMatMult_STOperator,NULL,MATDENSEHIP,MATDENSEHIP));
@@ -539,6 +540,7 @@ PetscErrorCode STSetUp(ST st)
     PetscCheck(n==k,PetscObjectComm((PetscObject)st),PETSC_ERR_ARG_SIZ,"Balance matrix has wrong dimension %" PetscInt_FMT " (should be %" PetscInt_FMT ")",k,n);
     if (!st->wb) PetscCall(VecDuplicate(st->D,&st->wb));
   }
+  PetscCheck(!st->refineits || st->matmode!=ST_MATMODE_SHELL,PetscObjectComm((PetscObject)st),PETSC_ERR_SUP,"Iterative refinement of linear solves is not available in ST_MATMODE_SHELL");
   if (st->nmat<3 && st->transform) PetscCall(STComputeOperator(st));
   else {
     if (!st->T) PetscCall(PetscCalloc1(PetscMax(2,st->nmat),&st->T));
@@ -549,6 +551,257 @@ PetscErrorCode STSetUp(ST st)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   Data attached to a matrix S = Sum_i w_i*A_i built with the union of the
+   sparsity patterns of all A_i, so that new coefficients w_i only require
+   overwriting the values of S in place
+*/
+typedef struct {
+  PetscInt         nmat;        /* number of matrices A_i */
+  PetscObjectId    *id;         /* identifiers of the A_i */
+  PetscObjectState *nzstate;    /* nonzero state of the A_i when the maps were built */
+  PetscInt         *dnz,*onz;   /* number of nonzeros in the diagonal/off-diagonal blocks of A_i */
+  PetscInt         **dmap;      /* position in the diagonal block of S of each entry of A_i */
+  PetscInt         **omap;      /* position in the off-diagonal block of S of each entry of A_i */
+  PetscInt         snzd,snzo;   /* number of nonzeros in the diagonal/off-diagonal blocks of S */
+} STUnionPattern;
+
+static PetscErrorCode STUnionPatternDestroy(void **ptr)
+{
+  STUnionPattern *up = (STUnionPattern*)*ptr;
+  PetscInt       i;
+
+  PetscFunctionBegin;
+  for (i=0;i<up->nmat;i++) PetscCall(PetscFree2(up->dmap[i],up->omap[i]));
+  PetscCall(PetscFree6(up->id,up->nzstate,up->dnz,up->onz,up->dmap,up->omap));
+  PetscCall(PetscFree(up));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   Returns the diagonal and off-diagonal blocks of a SEQAIJ or MPIAIJ matrix,
+   the off-diagonal block is NULL in the sequential case
+*/
+static PetscErrorCode STUnionPatternGetBlocks(Mat A,PetscBool mpi,Mat *Ad,Mat *Ao,const PetscInt **garray)
+{
+  PetscFunctionBegin;
+  if (mpi) PetscCall(MatMPIAIJGetSeqAIJ(A,Ad,Ao,garray));
+  else {
+    *Ad = A; *Ao = NULL;
+    if (garray) *garray = NULL;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   Checks whether the union pattern can be used for the combination of the
+   matrices A[0..nmat-1], i.e., all of them are SEQAIJ or all are MPIAIJ
+*/
+static PetscErrorCode STUnionPatternApplicable(PetscInt nmat,Mat *A,PetscBool *flg,PetscBool *mpi)
+{
+  PetscInt  i;
+  PetscBool seq=PETSC_TRUE,par=PETSC_TRUE,is;
+
+  PetscFunctionBegin;
+  for (i=0;i<nmat;i++) {
+    PetscCall(PetscObjectTypeCompare((PetscObject)A[i],MATSEQAIJ,&is));
+    seq = (PetscBool)(seq && is);
+    PetscCall(PetscObjectTypeCompare((PetscObject)A[i],MATMPIAIJ,&is));
+    par = (PetscBool)(par && is);
+  }
+  *flg = (PetscBool)(nmat>1 && (seq || par));
+  *mpi = par;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   Checks whether S carries valid index maps for the matrices A[0..nmat-1]
+*/
+static PetscErrorCode STUnionPatternValid(Mat S,PetscInt nmat,Mat *A,STUnionPattern **up)
+{
+  PetscContainer   container;
+  STUnionPattern   *ctx;
+  PetscObjectId    id;
+  PetscObjectState nzstate;
+  PetscInt         i;
+
+  PetscFunctionBegin;
+  *up = NULL;
+  if (!S) PetscFunctionReturn(PETSC_SUCCESS);
+  PetscCall(PetscObjectQuery((PetscObject)S,"STUnionPattern",(PetscObject*)&container));
+  if (!container) PetscFunctionReturn(PETSC_SUCCESS);
+  PetscCall(PetscContainerGetPointer(container,(void**)&ctx));
+  if (ctx->nmat!=nmat) PetscFunctionReturn(PETSC_SUCCESS);
+  for (i=0;i<nmat;i++) {
+    PetscCall(PetscObjectGetId((PetscObject)A[i],&id));
+    PetscCall(MatGetNonzeroState(A[i],&nzstate));
+    if (id!=ctx->id[i] || nzstate!=ctx->nzstate[i]) PetscFunctionReturn(PETSC_SUCCESS);
+  }
+  *up = ctx;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   Computes the position in the rows of the block S of each entry of the block A,
+   colmap translates the column indices of A to those of S (NULL if they coincide)
+*/
+static PetscErrorCode STUnionPatternBlockMap(Mat A,Mat S,const PetscInt *colmap,PetscInt *map)
+{
+  PetscInt       n,ns,i,j,c,loc;
+  const PetscInt *ia,*ja,*sia,*sja;
+  PetscBool      done;
+
+  PetscFunctionBegin;
+  PetscCall(MatGetRowIJ(A,0,PETSC_FALSE,PETSC_FALSE,&n,&ia,&ja,&done));
+  PetscCheck(done,PetscObjectComm((PetscObject)A),PETSC_ERR_SUP,"Cannot get the sparsity pattern of the matrix");
+  PetscCall(MatGetRowIJ(S,0,PETSC_FALSE,PETSC_FALSE,&ns,&sia,&sja,&done));
+  PetscCheck(done,PetscObjectComm((PetscObject)S),PETSC_ERR_SUP,"Cannot get the sparsity pattern of the matrix");
+  for (i=0;i<n;i++) {
+    for (j=ia[i];j<ia[i+1];j++) {
+      c = colmap? colmap[ja[j]]: ja[j];
+      PetscCall(PetscFindInt(c,sia[i+1]-sia[i],sja+sia[i],&loc));
+      PetscCheck(loc>=0,PETSC_COMM_SELF,PETSC_ERR_PLIB,"Entry not found in the union pattern");
+      map[j] = sia[i]+loc;
+    }
+  }
+  PetscCall(MatRestoreRowIJ(S,0,PETSC_FALSE,PETSC_FALSE,&ns,&sia,&sja,&done));
+  PetscCall(MatRestoreRowIJ(A,0,PETSC_FALSE,PETSC_FALSE,&n,&ia,&ja,&done));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   Creates a matrix S with the union of the sparsity patterns of A[0..nmat-1]
+   and attaches the index maps from each A_i into S
+*/
+static PetscErrorCode STUnionPatternCreate(PetscInt nmat,Mat *A,PetscBool mpi,Mat *S)
+{
+  STUnionPattern *up;
+  Mat            Ad,Ao,Sd,So;
+  PetscInt       i,j,r,m,nr,nz,cstart,*ii,*jj,*cmap,ng,loc;
+  const PetscInt **dia,**dja,**oia,**oja,**garray,*gS,*sia,*sja;
+  PetscBool      done;
+  PetscLayout    rmap,cmap0;
+
+  PetscFunctionBegin;
+  PetscCall(MatGetLocalSize(A[0],&m,NULL));
+  PetscCall(MatGetOwnershipRangeColumn(A[0],&cstart,NULL));
+  PetscCall(PetscMalloc5(nmat,&dia,nmat,&dja,nmat,&oia,nmat,&oja,nmat,&garray));
+
+  /* merge the rows of all matrices, with global column indices */
+  nz = 0;
+  for (i=0;i<nmat;i++) {
+    PetscCall(STUnionPatternGetBlocks(A[i],mpi,&Ad,&Ao,&garray[i]));
+    PetscCall(MatGetRowIJ(Ad,0,PETSC_FALSE,PETSC_FALSE,&nr,&dia[i],&dja[i],&done));
+    PetscCheck(done,PetscObjectComm((PetscObject)A[i]),PETSC_ERR_SUP,"Cannot get the sparsity pattern of the matrix");
+    nz += dia[i][m];
+    oia[i] = oja[i] = NULL;
+    if (Ao) {
+      PetscCall(MatGetRowIJ(Ao,0,PETSC_FALSE,PETSC_FALSE,&nr,&oia[i],&oja[i],&done));
+      PetscCheck(done,PetscObjectComm((PetscObject)A[i]),PETSC_ERR_SUP,"Cannot get the sparsity pattern of the matrix");
+      nz += oia[i][m];
+    }
+  }
+  PetscCall(PetscMalloc2(m+1,&ii,nz,&jj));
+  ii[0] = 0;
+  for (r=0;r<m;r++) {
+    nr = 0;
+    for (i=0;i<nmat;i++) {
+      for (j=dia[i][r];j<dia[i][r+1];j++) jj[ii[r]+nr++] = dja[i][j]+cstart;
+      if (oia[i]) for (j=oia[i][r];j<oia[i][r+1];j++) jj[ii[r]+nr++] = garray[i][oja[i][j]];
+    }
+    PetscCall(PetscSortRemoveDupsInt(&nr,jj+ii[r]));
+    ii[r+1] = ii[r]+nr;
+  }
+
+  /* create S with the union pattern, all values are set to zero */
+  PetscCall(MatCreate(PetscObjectComm((PetscObject)A[0]),S));
+  PetscCall(MatGetLayouts(A[0],&rmap,&cmap0));
+  PetscCall(MatSetLayouts(*S,rmap,cmap0));
+  PetscCall(MatSetType(*S,mpi?MATMPIAIJ:MATSEQAIJ));
+  PetscCall(MatSeqAIJSetPreallocationCSR(*S,ii,jj,NULL));
+  PetscCall(MatMPIAIJSetPreallocationCSR(*S,ii,jj,NULL));
+  PetscCall(PetscFree2(ii,jj));
+
+  /* compute the index maps */
+  PetscCall(PetscNew(&up));
+  up->nmat = nmat;
+  PetscCall(PetscMalloc6(nmat,&up->id,nmat,&up->nzstate,nmat,&up->dnz,nmat,&up->onz,nmat,&up->dmap,nmat,&up->omap));
+  PetscCall(STUnionPatternGetBlocks(*S,mpi,&Sd,&So,&gS));
+  PetscCall(MatGetRowIJ(Sd,0,PETSC_FALSE,PETSC_FALSE,&nr,&sia,&sja,&done));
+  up->snzd = sia[m];
+  PetscCall(MatRestoreRowIJ(Sd,0,PETSC_FALSE,PETSC_FALSE,&nr,&sia,&sja,&done));
+  ng = 0; up->snzo = 0;
+  if (So) {
+    PetscCall(MatGetSize(So,NULL,&ng));
+    PetscCall(MatGetRowIJ(So,0,PETSC_FALSE,PETSC_FALSE,&nr,&sia,&sja,&done));
+    up->snzo = sia[m];
+    PetscCall(MatRestoreRowIJ(So,0,PETSC_FALSE,PETSC_FALSE,&nr,&sia,&sja,&done));
+  }
+  for (i=0;i<nmat;i++) {
+    PetscCall(PetscObjectGetId((PetscObject)A[i],&up->id[i]));
+    PetscCall(MatGetNonzeroState(A[i],&up->nzstate[i]));
+    up->dnz[i] = dia[i][m];
+    up->onz[i] = oia[i]? oia[i][m]: 0;
+    PetscCall(PetscMalloc2(up->dnz[i],&up->dmap[i],up->onz[i],&up->omap[i]));
+    PetscCall(STUnionPatternGetBlocks(A[i],mpi,&Ad,&Ao,NULL));
+    PetscCall(MatRestoreRowIJ(Ad,0,PETSC_FALSE,PETSC_FALSE,&nr,&dia[i],&dja[i],&done));
+    PetscCall(STUnionPatternBlockMap(Ad,Sd,NULL,up->dmap[i]));
+    if (Ao) {
+      PetscCall(MatRestoreRowIJ(Ao,0,PETSC_FALSE,PETSC_FALSE,&nr,&oia[i],&oja[i],&done));
+      PetscCall(MatGetSize(Ao,NULL,&nr));
+      PetscCall(PetscMalloc1(nr,&cmap));
+      for (j=0;j<nr;j++) {
+        PetscCall(PetscFindInt(garray[i][j],ng,gS,&loc));
+        PetscCheck(loc>=0,PETSC_COMM_SELF,PETSC_ERR_PLIB,"Column not found in the union pattern");
+        cmap[j] = loc;
+      }
+      PetscCall(STUnionPatternBlockMap(Ao,So,cmap,up->omap[i]));
+      PetscCall(PetscFree(cmap));
+    }
+  }
+  PetscCall(PetscFree5(dia,dja,oia,oja,garray));
+  PetscCall(PetscObjectContainerCompose((PetscObject)*S,"STUnionPattern",up,STUnionPatternDestroy));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   Overwrites the values of S = Sum_i w[i]*A_i, where S has been created with
+   STUnionPatternCreate()
+*/
+static PetscErrorCode STUnionPatternAXPY(STUnionPattern *up,PetscInt nmat,Mat *A,PetscBool mpi,PetscScalar *w,Mat S)
+{
+  Mat               Ad,Ao,Sd,So;
+  PetscInt          i,j;
+  PetscScalar       *sd,*so=NULL;
+  const PetscScalar *a;
+
+  PetscFunctionBegin;
+  PetscCall(STUnionPatternGetBlocks(S,mpi,&Sd,&So,NULL));
+  PetscCall(MatSeqAIJGetArrayWrite(Sd,&sd));
+  PetscCall(PetscArrayzero(sd,up->snzd));
+  if (So) {
+    PetscCall(MatSeqAIJGetArrayWrite(So,&so));
+    PetscCall(PetscArrayzero(so,up->snzo));
+  }
+  for (i=0;i<nmat;i++) {
+    if (w[i]==0.0) continue;
+    PetscCall(STUnionPatternGetBlocks(A[i],mpi,&Ad,&Ao,NULL));
+    PetscCall(MatSeqAIJGetArrayRead(Ad,&a));
+    for (j=0;j<up->dnz[i];j++) sd[up->dmap[i][j]] += w[i]*a[j];
+    PetscCall(MatSeqAIJRestoreArrayRead(Ad,&a));
+    if (Ao) {
+      PetscCall(MatSeqAIJGetArrayRead(Ao,&a));
+      for (j=0;j<up->onz[i];j++) so[up->omap[i][j]] += w[i]*a[j];
+      PetscCall(MatSeqAIJRestoreArrayRead(Ao,&a));
+    }
+    PetscCall(PetscLogFlops(2.0*(up->dnz[i]+up->onz[i])));
+  }
+  PetscCall(MatSeqAIJRestoreArrayWrite(Sd,&sd));
+  if (So) PetscCall(MatSeqAIJRestoreArrayWrite(So,&so));
+  if (mpi) PetscCall(PetscObjectStateIncrease((PetscObject)S));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*
    Computes coefficients for the transformed polynomial,
    and stores the result in argument S.
@@ -563,8 +816,9 @@ PetscErrorCode STSetUp(ST st)
 PetscErrorCode STMatMAXPY_Private(ST st,PetscScalar alpha,PetscScalar beta,PetscInt k,PetscScalar *coeffs,PetscBool initial,PetscBool precond,Mat *S)
 {
   PetscInt       *matIdx=NULL,nmat,i,ini=-1;
-  PetscScalar    t=1.0,ta,gamma;
-  PetscBool      nz=PETSC_FALSE;
+  PetscScalar    t=1.0,ta,gamma,*w;
+  PetscBool      nz=PETSC_FALSE,uni=PETSC_FALSE,mpi=PETSC_FALSE;
+  STUnionPattern *up;
   Mat            *A=precond?st->Psplit:st->A;
   MatStructure   str=precond?st->strp:st->str;
 
@@ -604,10 +858,26 @@ PetscErrorCode STMatMAXPY_Private(ST st,PetscScalar alpha,PetscScalar beta,Petsc
       if (coeffs[ini] != 1.0) nz = PETSC_TRUE;
       for (i=ini+1;i<nmat&&!nz;i++) if (coeffs[i]!=0.0) nz = PETSC_TRUE;
     } else { nz = PETSC_TRUE; ini = 0; }
+    if (st->nmat>1 && str!=SAME_NONZERO_PATTERN) PetscCall(STUnionPatternApplicable(nmat,A+k,&uni,&mpi));
     if ((alpha == 0.0 || !nz) && t==1.0) {
       PetscCall(PetscObjectReference((PetscObject)A[k+ini]));
       PetscCall(MatDestroy(S));
       *S = A[k+ini];
+    } else if (uni) {
+      /* reuse the union pattern and overwrite the values in place */
+      PetscCall(STUnionPatternValid(*S,nmat,A+k,&up));
+      if (!up) {
+        PetscCall(MatDestroy(S));
+        PetscCall(STUnionPatternCreate(nmat,A+k,mpi,S));
+        PetscCall(STUnionPatternValid(*S,nmat,A+k,&up));
+      }
+      PetscCall(PetscMalloc1(nmat,&w));
+      for (i=0,ta=1.0;i<nmat;i++) {
+        w[i] = coeffs? ta*coeffs[i]: ta;
+        ta *= alpha;
+      }
+      PetscCall(STUnionPatternAXPY(up,nmat,A+k,mpi,w,*S));
+      PetscCall(PetscFree(w));
     } else {
       if (*S && *S!=A[k+ini]) {
         PetscCall(MatSetOption(*S,MAT_NEW_NONZERO_ALLOCATION_ERR,PETSC_FALSE));
@@ -0,0 +1,129 @@
+/*
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+   SLEPc - Scalable Library for Eigenvalue Problem Computations
+   Copyright (c) 2002-, Universitat Politecnica de Valencia, Spain
+
+   This file is part of SLEPc.
+   SLEPc is distributed under a 2-clause BSD license (see LICENSE).
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+*/
+
+static char help[] = "Test the cache of factorizations in ST when revisiting shifts.\n\n";
+
+#include <slepcst.h>
+
+int main(int argc,char **argv)
+{
+  Mat                A,B,mat[2];
+  ST                 st;
+  KSP                ksp,ksp0;
+  PC                 pc;
+  MatFactorShiftType shtype;
+  Vec                v,w,*x;
+  PetscScalar        shifts[] = {0.1,0.5,0.1,0.5,0.3,0.1,0.7,0.3};
+  PetscInt           n=30,i,j,Istart,Iend,nmax,hits,misses,ns=8,first[8];
+  PetscReal          norm,maxerr=0.0;
+
+  PetscFunctionBeginUser;
+  PetscCall(SlepcInitialize(&argc,&argv,NULL,help));
+  PetscCall(PetscOptionsGetInt(NULL,NULL,"-n",&n,NULL));
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD,"\nGeneralized 1-D Laplacian, n=%" PetscInt_FMT "\n\n",n));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                 Compute the matrices of the pencil (A,B)
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+  PetscCall(MatCreate(PETSC_COMM_WORLD,&A));
+  PetscCall(MatSetSizes(A,PETSC_DECIDE,PETSC_DECIDE,n,n));
+  PetscCall(MatSetFromOptions(A));
+  PetscCall(MatCreate(PETSC_COMM_WORLD,&B));
+  PetscCall(MatSetSizes(B,PETSC_DECIDE,PETSC_DECIDE,n,n));
+  PetscCall(MatSetFromOptions(B));
+
+  PetscCall(MatGetOwnershipRange(A,&Istart,&Iend));
+  for (i=Istart;i<Iend;i++) {
+    if (i>0) PetscCall(MatSetValue(A,i,i-1,-1.0,INSERT_VALUES));
+    if (i<n-1) PetscCall(MatSetValue(A,i,i+1,-1.0,INSERT_VALUES));
+    PetscCall(MatSetValue(A,i,i,2.0,INSERT_VALUES));
+    PetscCall(MatSetValue(B,i,i,1.0+i/(PetscReal)n,INSERT_VALUES));
+  }
+  PetscCall(MatAssemblyBegin(A,MAT_FINAL_ASSEMBLY));
+  PetscCall(MatAssemblyEnd(A,MAT_FINAL_ASSEMBLY));
+  PetscCall(MatAssemblyBegin(B,MAT_FINAL_ASSEMBLY));
+  PetscCall(MatAssemblyEnd(B,MAT_FINAL_ASSEMBLY));
+  PetscCall(MatCreateVecs(A,&v,&w));
+  PetscCall(VecSet(v,1.0));
+  PetscCall(VecDuplicateVecs(v,ns,&x));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                Create the spectral transformation object
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+  PetscCall(STCreate(PETSC_COMM_WORLD,&st));
+  mat[0] = A;
+  mat[1] = B;
+  PetscCall(STSetMatrices(st,2,mat));
+  PetscCall(STSetType(st,STSINVERT));
+  PetscCall(STSetTransform(st,PETSC_TRUE));
+  PetscCall(STSetFactorCache(st,2,PETSC_DETERMINE));
+  PetscCall(STSetShift(st,shifts[0]));
+  PetscCall(STGetKSP(st,&ksp0));
+  PetscCall(KSPSetType(ksp0,KSPPREONLY));
+  PetscCall(KSPGetPC(ksp0,&pc));
+  PetscCall(PCSetType(pc,PCLU));
+  PetscCall(PCFactorSetShiftType(pc,MAT_SHIFT_NONZERO));
+  PetscCall(STSetFromOptions(st));
+  PetscCall(STSetUp(st));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+       Apply the operator for a sequence of shifts with repetitions and
+       compare with the result obtained the first time
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+  for (i=0;i<ns;i++) {
+    PetscCall(STSetShift(st,shifts[i]));
+    PetscCall(STApply(st,v,x[i]));
+    first[i] = i;
+    for (j=0;j<i;j++) if (shifts[j]==shifts[i]) { first[i] = j; break; }
+    if (first[i]<i) {
+      PetscCall(VecWAXPY(w,-1.0,x[first[i]],x[i]));
+      PetscCall(VecNorm(w,NORM_2,&norm));
+      maxerr = PetscMax(maxerr,norm);
+    }
+  }
+  PetscCall(STGetFactorCache(st,&nmax,NULL,&hits,&misses));
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD,"Cache of %" PetscInt_FMT " factorizations: %" PetscInt_FMT " hits, %" PetscInt_FMT " misses\n",nmax,hits,misses));
+  if (maxerr<100*PETSC_MACHINE_EPSILON) PetscCall(PetscPrintf(PETSC_COMM_WORLD,"Results for repeated shifts coincide\n"));
+  else PetscCall(PetscPrintf(PETSC_COMM_WORLD,"Results for repeated shifts differ by %g\n",(double)maxerr));
+
+  /* the KSP of the ST and the settings of its PC must survive the shift changes */
+  PetscCall(STGetKSP(st,&ksp));
+  PetscCall(KSPGetPC(ksp,&pc));
+  PetscCall(PCFactorGetShiftType(pc,&shtype));
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD,"KSP %s, factor shift type %s\n",(ksp==ksp0)?"kept":"replaced",MatFactorShiftTypes[shtype]));
+
+  PetscCall(STDestroy(&st));
+  PetscCall(MatDestroy(&A));
+  PetscCall(MatDestroy(&B));
+  PetscCall(VecDestroy(&v));
+  PetscCall(VecDestroy(&w));
+  PetscCall(VecDestroyVecs(ns,&x));
+  PetscCall(SlepcFinalize());
+  return 0;
+}
+
+/*TEST
+
+   test:
+      suffix: 1
+      args: -st_type {{sinvert cayley}}
+      output_file: output/test10_1.out
+      requires: !single
+
+   test:
+      suffix: 2
+      args: -st_type {{sinvert cayley}} -st_factor_cache_memory 1e-9
+      output_file: output/test10_2.out
+      requires: !single
+
+TEST*/
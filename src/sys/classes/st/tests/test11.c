@@ -0,0 +1,108 @@
+/*
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+   SLEPc - Scalable Library for Eigenvalue Problem Computations
+   Copyright (c) 2002-, Universitat Politecnica de Valencia, Spain
+
+   This file is part of SLEPc.
+   SLEPc is distributed under a 2-clause BSD license (see LICENSE).
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+*/
+
+static char help[] = "Test STApplyMat() with polynomial filters.\n\n";
+
+#include <slepcst.h>
+
+int main(int argc,char **argv)
+{
+  Mat            A,X,Y;
+  ST             st;
+  Vec            x,y,w;
+  PetscInt       n=50,k=4,i,Istart,Iend,degree;
+  PetscReal      norm,nrmy,maxerr=0.0;
+  PetscRandom    rand;
+
+  PetscFunctionBeginUser;
+  PetscCall(SlepcInitialize(&argc,&argv,NULL,help));
+  PetscCall(PetscOptionsGetInt(NULL,NULL,"-n",&n,NULL));
+  PetscCall(PetscOptionsGetInt(NULL,NULL,"-k",&k,NULL));
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD,"\n1-D Laplacian, n=%" PetscInt_FMT ", applying the filter to %" PetscInt_FMT " vectors\n\n",n,k));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                     Compute the operator matrix
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+  PetscCall(MatCreate(PETSC_COMM_WORLD,&A));
+  PetscCall(MatSetSizes(A,PETSC_DECIDE,PETSC_DECIDE,n,n));
+  PetscCall(MatSetFromOptions(A));
+  PetscCall(MatGetOwnershipRange(A,&Istart,&Iend));
+  for (i=Istart;i<Iend;i++) {
+    if (i>0) PetscCall(MatSetValue(A,i,i-1,-1.0,INSERT_VALUES));
+    if (i<n-1) PetscCall(MatSetValue(A,i,i+1,-1.0,INSERT_VALUES));
+    PetscCall(MatSetValue(A,i,i,2.0,INSERT_VALUES));
+  }
+  PetscCall(MatAssemblyBegin(A,MAT_FINAL_ASSEMBLY));
+  PetscCall(MatAssemblyEnd(A,MAT_FINAL_ASSEMBLY));
+
+  /* block of random vectors */
+  PetscCall(PetscRandomCreate(PETSC_COMM_WORLD,&rand));
+  PetscCall(PetscRandomSetFromOptions(rand));
+  PetscCall(MatCreateDense(PETSC_COMM_WORLD,Iend-Istart,PETSC_DECIDE,n,k,NULL,&X));
+  PetscCall(MatSetRandom(X,rand));
+  PetscCall(MatDuplicate(X,MAT_DO_NOT_COPY_VALUES,&Y));
+  PetscCall(MatCreateVecs(A,&w,NULL));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                Create the spectral transformation object
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+  PetscCall(STCreate(PETSC_COMM_WORLD,&st));
+  PetscCall(STSetMatrices(st,1,&A));
+  PetscCall(STSetType(st,STFILTER));
+  PetscCall(STSetTransform(st,PETSC_TRUE));
+  PetscCall(STFilterSetInterval(st,0.5,1.5));
+  PetscCall(STFilterSetRange(st,0.0,4.0));
+  PetscCall(STFilterSetDegree(st,20));
+  PetscCall(STSetFromOptions(st));
+  PetscCall(STSetUp(st));
+  PetscCall(STFilterGetDegree(st,&degree));
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD,"Filter degree: %" PetscInt_FMT "\n",degree));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+      Apply the filter to the block and compare with STApply() for each
+      of the columns
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+  PetscCall(STApplyMat(st,X,Y));
+  for (i=0;i<k;i++) {
+    PetscCall(MatDenseGetColumnVecRead(X,i,&x));
+    PetscCall(MatDenseGetColumnVecRead(Y,i,&y));
+    PetscCall(STApply(st,x,w));
+    PetscCall(VecNorm(y,NORM_2,&nrmy));
+    PetscCall(VecAXPY(w,-1.0,y));
+    PetscCall(VecNorm(w,NORM_2,&norm));
+    maxerr = PetscMax(maxerr,norm/nrmy);
+    PetscCall(MatDenseRestoreColumnVecRead(Y,i,&y));
+    PetscCall(MatDenseRestoreColumnVecRead(X,i,&x));
+  }
+  if (maxerr<100*PETSC_SQRT_MACHINE_EPSILON) PetscCall(PetscPrintf(PETSC_COMM_WORLD,"Block and vector applications of the filter coincide\n"));
+  else PetscCall(PetscPrintf(PETSC_COMM_WORLD,"Block and vector applications of the filter differ by %g\n",(double)maxerr));
+
+  PetscCall(STDestroy(&st));
+  PetscCall(MatDestroy(&A));
+  PetscCall(MatDestroy(&X));
+  PetscCall(MatDestroy(&Y));
+  PetscCall(VecDestroy(&w));
+  PetscCall(PetscRandomDestroy(&rand));
+  PetscCall(SlepcFinalize());
+  return 0;
+}
+
+/*TEST
+
+   test:
+      suffix: 1
+      args: -st_filter_type {{filtlan chebyshev}}
+      output_file: output/test11_1.out
+      requires: !single
+
+TEST*/
@@ -0,0 +1,162 @@
+/*
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+   SLEPc - Scalable Library for Eigenvalue Problem Computations
+   Copyright (c) 2002-, Universitat Politecnica de Valencia, Spain
+
+   This file is part of SLEPc.
+   SLEPc is distributed under a 2-clause BSD license (see LICENSE).
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+*/
+
+static char help[] = "Test the products with the shell matrices of ST, with AIJ and dense matrices.\n\n"
+  "The command line options are:\n"
+  "  -n <n>, where <n> = matrix dimension.\n"
+  "  -nmat <nmat>, where <nmat> = number of matrices (2 or 3).\n\n";
+
+#include <slepcst.h>
+
+/*
+   Creates an ST of type shift with the given matrices, in shell mode
+*/
+static PetscErrorCode CreateST(PetscInt nmat,Mat *mat,PetscScalar sigma,ST *st)
+{
+  KSP            ksp;
+  PC             pc;
+
+  PetscFunctionBeginUser;
+  PetscCall(STCreate(PETSC_COMM_WORLD,st));
+  PetscCall(STSetMatrices(*st,nmat,mat));
+  PetscCall(STSetType(*st,STSHIFT));
+  PetscCall(STSetTransform(*st,PETSC_TRUE));
+  PetscCall(STSetMatMode(*st,ST_MATMODE_SHELL));
+  PetscCall(STSetShift(*st,sigma));
+  PetscCall(STGetKSP(*st,&ksp));
+  PetscCall(KSPSetType(ksp,KSPBCGS));
+  PetscCall(KSPGetPC(ksp,&pc));
+  PetscCall(PCSetType(pc,PCJACOBI));
+  PetscCall(STSetUp(*st));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+int main(int argc,char **argv)
+{
+  Mat            A[3],D[3],T,S;
+  ST             st,std;
+  Vec            x,y,z;
+  PetscScalar    sigma=0.7,im=0.0;
+  PetscInt       n=40,nmat=2,i,k,op,Istart,Iend;
+  PetscReal      nrm,err;
+  const char     *opname[] = { "MatMult", "MatMultTranspose", "MatMultHermitianTranspose" };
+
+  PetscFunctionBeginUser;
+  PetscCall(SlepcInitialize(&argc,&argv,NULL,help));
+  PetscCall(PetscOptionsGetInt(NULL,NULL,"-n",&n,NULL));
+  PetscCall(PetscOptionsGetInt(NULL,NULL,"-nmat",&nmat,NULL));
+  PetscCheck(nmat==2 || nmat==3,PETSC_COMM_WORLD,PETSC_ERR_ARG_OUTOFRANGE,"The number of matrices must be 2 or 3");
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD,"\nShell matrices of ST with %" PetscInt_FMT " matrices, n=%" PetscInt_FMT "\n\n",nmat,n));
+#if defined(PETSC_USE_COMPLEX)
+  sigma = PetscCMPLX(0.7,0.2);
+  im    = PETSC_i;
+#endif
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        Nonsymmetric AIJ matrices with different nonzero patterns, so
+          that each one has its own off-diagonal columns in parallel
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+  for (k=0;k<nmat;k++) {
+    PetscCall(MatCreate(PETSC_COMM_WORLD,&A[k]));
+    PetscCall(MatSetSizes(A[k],PETSC_DECIDE,PETSC_DECIDE,n,n));
+    PetscCall(MatSetFromOptions(A[k]));
+  }
+  PetscCall(MatGetOwnershipRange(A[0],&Istart,&Iend));
+  for (i=Istart;i<Iend;i++) {
+    if (i>1) PetscCall(MatSetValue(A[0],i,i-2,-1.0+0.5*im,INSERT_VALUES));
+    if (i<n-1) PetscCall(MatSetValue(A[0],i,i+1,-2.0,INSERT_VALUES));
+    PetscCall(MatSetValue(A[0],i,i,4.0,INSERT_VALUES));
+    if (i>0) PetscCall(MatSetValue(A[1],i,i-1,0.3,INSERT_VALUES));
+    if (i<n-3) PetscCall(MatSetValue(A[1],i,i+3,0.2-0.1*im,INSERT_VALUES));
+    PetscCall(MatSetValue(A[1],i,i,2.0,INSERT_VALUES));
+    if (nmat>2) {
+      if (i!=n-1-i) PetscCall(MatSetValue(A[2],i,n-1-i,0.5+0.5*im,INSERT_VALUES));
+      PetscCall(MatSetValue(A[2],i,i,1.0,INSERT_VALUES));
+    }
+  }
+  for (k=0;k<nmat;k++) {
+    PetscCall(MatAssemblyBegin(A[k],MAT_FINAL_ASSEMBLY));
+    PetscCall(MatAssemblyEnd(A[k],MAT_FINAL_ASSEMBLY));
+    PetscCall(MatConvert(A[k],MATDENSE,MAT_INITIAL_MATRIX,&D[k]));
+  }
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+      With AIJ matrices the shell matrices use the fused kernels, while
+            with dense matrices they use one product per matrix
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+  PetscCall(CreateST(nmat,A,sigma,&st));
+  PetscCall(CreateST(nmat,D,sigma,&std));
+
+  PetscCall(MatCreateVecs(A[0],&x,&y));
+  PetscCall(VecDuplicate(y,&z));
+  PetscCall(VecSetRandom(x,NULL));
+  for (k=0;k<nmat-1;k++) {
+    PetscCall(STGetMatrixTransformed(st,k,&T));
+    PetscCall(STGetMatrixTransformed(std,k,&S));
+    for (op=0;op<3;op++) {
+      switch (op) {
+      case 0:
+        PetscCall(MatMult(T,x,y));
+        PetscCall(MatMult(S,x,z));
+        break;
+      case 1:
+        PetscCall(MatMultTranspose(T,x,y));
+        PetscCall(MatMultTranspose(S,x,z));
+        break;
+      case 2:
+        PetscCall(MatMultHermitianTranspose(T,x,y));
+        PetscCall(MatMultHermitianTranspose(S,x,z));
+        break;
+      }
+      PetscCall(VecNorm(z,NORM_2,&nrm));
+      PetscCall(VecAXPY(y,-1.0,z));
+      PetscCall(VecNorm(y,NORM_2,&err));
+      if (err<100*PETSC_MACHINE_EPSILON*nrm) PetscCall(PetscPrintf(PETSC_COMM_WORLD," %s with T[%" PetscInt_FMT "]: results coincide\n",opname[op],k));
+      else PetscCall(PetscPrintf(PETSC_COMM_WORLD," %s with T[%" PetscInt_FMT "]: results differ by %g\n",opname[op],k,(double)(err/nrm)));
+    }
+  }
+
+  PetscCall(STDestroy(&st));
+  PetscCall(STDestroy(&std));
+  for (k=0;k<nmat;k++) {
+    PetscCall(MatDestroy(&A[k]));
+    PetscCall(MatDestroy(&D[k]));
+  }
+  PetscCall(VecDestroy(&x));
+  PetscCall(VecDestroy(&y));
+  PetscCall(VecDestroy(&z));
+  PetscCall(SlepcFinalize());
+  return 0;
+}
+
+/*TEST
+
+   testset:
+      requires: !single
+      output_file: output/test12_1.out
+      test:
+         suffix: 1
+      test:
+         suffix: 1_par
+         nsize: 2
+
+   testset:
+      args: -nmat 3
+      requires: !single
+      output_file: output/test12_2.out
+      test:
+         suffix: 2
+      test:
+         suffix: 2_par
+         nsize: 3
+
+TEST*/
@@ -168,4 +168,10 @@ int main(int argc,char **argv)
       suffix: 2
       args: -st_matmode {{copy shell}}
 
+   test:
+      suffix: 3
+      args: -st_transform -st_matstructure different
+      output_file: output/test4_1.out
+      requires: !single
+
 TEST*/